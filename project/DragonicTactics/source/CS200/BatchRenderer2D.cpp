@@ -7,7 +7,9 @@
  */
 #include "BatchRenderer2D.h"
 
+#include "Engine/AllocationTracker.h"
 #include "Engine/Path.h"
+#include "Engine/Profiler.h"
 #include "OpenGL/Buffer.h"
 #include "OpenGL/GL.h"
 #include "OpenGL/VertexArray.h"
@@ -443,6 +445,8 @@ namespace CS200
 
 	void BatchRenderer2D::flush()
 	{
+		PROFILE_SCOPE("BatchRenderer2D::flush");
+		ALLOCATION_SCOPE(Renderer);
 		if (indexCount > 0)
 		{
 			// upload our vertices(vertex buffer is dynamic)
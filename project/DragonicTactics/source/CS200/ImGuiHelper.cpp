@@ -9,8 +9,10 @@
  */
 #include "ImGuiHelper.h"
 
+#include <SDL.h>
 #include <backends/imgui_impl_opengl3.h>
 #include <backends/imgui_impl_sdl2.h>
+#include <imgui.h>
 #include <imgui_internal.h> // for DockBuilderGetCentralNode until they stabilize make DockBuilder
 
 namespace
@@ -7,7 +7,9 @@
  */
 #include "InstancedRenderer2D.h"
 
+#include "Engine/AllocationTracker.h"
 #include "Engine/Path.h"
+#include "Engine/Profiler.h"
 
 #include "OpenGL/Buffer.h"
 #include "OpenGL/GL.h"
@@ -343,6 +345,8 @@ namespace CS200
 
 	void InstancedRenderer2D::flush()
 	{
+		PROFILE_SCOPE("InstancedRenderer2D::flush");
+		ALLOCATION_SCOPE(Renderer);
 		if (!instanceData.empty()) [[unlikely]]
 		{
 			GL::BindBuffer(GL_ARRAY_BUFFER, instanceBufferHandle);
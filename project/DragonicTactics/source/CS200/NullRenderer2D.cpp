@@ -0,0 +1,81 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "NullRenderer2D.h"
+#include "Engine/Matrix.h"
+
+namespace CS200
+{
+	void NullRenderer2D::Init()
+	{
+		draw_calls	  = 0;
+		texture_draws = 0;
+	}
+
+	void NullRenderer2D::Shutdown()
+	{
+	}
+
+	void NullRenderer2D::BeginScene([[maybe_unused]] const Math::TransformationMatrix& view_projection)
+	{
+		draw_calls	  = 0;
+		texture_draws = 0;
+	}
+
+	void NullRenderer2D::EndScene()
+	{
+	}
+
+	void NullRenderer2D::DrawQuad(
+		const Math::TransformationMatrix& transform, [[maybe_unused]] OpenGL::TextureHandle texture, [[maybe_unused]] Math::vec2 texture_coord_bl,
+		[[maybe_unused]] Math::vec2 texture_coord_tr, [[maybe_unused]] CS200::RGBA tintColor, [[maybe_unused]] float depth)
+	{
+		++draw_calls;
+		++texture_draws;
+		checksum += transform[0][2] + transform[1][2];
+	}
+
+	void NullRenderer2D::DrawCircle(
+		const Math::TransformationMatrix& transform, [[maybe_unused]] CS200::RGBA fill_color, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width,
+		[[maybe_unused]] float depth)
+	{
+		++draw_calls;
+		checksum += transform[0][2] + transform[1][2];
+	}
+
+	void NullRenderer2D::DrawRectangle(
+		const Math::TransformationMatrix& transform, [[maybe_unused]] CS200::RGBA fill_color, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width,
+		[[maybe_unused]] float depth)
+	{
+		++draw_calls;
+		checksum += transform[0][2] + transform[1][2];
+	}
+
+	void NullRenderer2D::DrawLine(
+		const Math::TransformationMatrix& transform, Math::vec2 startPoint, Math::vec2 endPoint, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width,
+		[[maybe_unused]] float depth)
+	{
+		++draw_calls;
+		checksum += transform[0][2] + startPoint.x + endPoint.y;
+	}
+
+	void NullRenderer2D::DrawLine(Math::vec2 start_point, Math::vec2 end_point, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width, [[maybe_unused]] float depth)
+	{
+		++draw_calls;
+		checksum += start_point.x + end_point.y;
+	}
+
+	size_t NullRenderer2D::GetDrawCallCounter()
+	{
+		return draw_calls;
+	}
+
+	size_t NullRenderer2D::GetDrawTextureCounter()
+	{
+		return texture_draws;
+	}
+}
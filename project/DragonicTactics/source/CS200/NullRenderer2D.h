@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+
+#include "IRenderer2D.h"
+
+namespace CS200
+{
+	/**
+	 * \brief Renderer that records draw submissions without touching OpenGL
+	 *
+	 * Used by headless builds (benchmarks, battle simulation) where no window or GL
+	 * context exists. Game code still runs its full Draw() path - transforms, texture
+	 * coordinate math, per-tile branching - so the CPU cost of drawing can be measured,
+	 * but every primitive is only counted.
+	 *
+	 * Counters are reset by BeginScene() and can be read after EndScene().
+	 */
+	class NullRenderer2D : public IRenderer2D
+	{
+	public:
+		void Init() override;
+		void Shutdown() override;
+		void BeginScene(const Math::TransformationMatrix& view_projection) override;
+		void EndScene() override;
+
+		void DrawQuad(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl = Math::vec2{ 0.0, 0.0 },
+			Math::vec2 texture_coord_tr = Math::vec2{ 1.0, 1.0 }, CS200::RGBA tintColor = CS200::WHITE, float depth = DrawDepth::CHARACTER) override;
+		void DrawCircle(
+			const Math::TransformationMatrix& transform, CS200::RGBA fill_color = CS200::CLEAR, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0,
+			float depth = DrawDepth::CHARACTER) override;
+		void DrawRectangle(
+			const Math::TransformationMatrix& transform, CS200::RGBA fill_color = CS200::CLEAR, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0,
+			float depth = DrawDepth::CHARACTER) override;
+		void DrawLine(
+			const Math::TransformationMatrix& transform, Math::vec2 startPoint, Math::vec2 endPoint, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0,
+			float depth = DrawDepth::CHARACTER) override;
+		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0, float depth = DrawDepth::CHARACTER) override;
+
+		/// \brief Primitives submitted since the last BeginScene()
+		size_t GetDrawCallCounter() override;
+		/// \brief Textured quads submitted since the last BeginScene()
+		size_t GetDrawTextureCounter() override;
+
+	private:
+		size_t draw_calls	 = 0;
+		size_t texture_draws = 0;
+		double checksum		 = 0.0; // keeps the transform inputs observable so the caller's math is not optimized away
+	};
+}
@@ -0,0 +1,212 @@
+#include "pch.h"
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace CS230
+{
+  namespace
+  {
+	struct ThreadCounters
+	{
+	  AllocationTracker::TagCounters counters{};
+	  AllocationTag					 tag = AllocationTag::Other;
+	};
+
+	// 상수 초기화라 operator new 가 스레드 시작 직후나 종료 중에 불려도 안전하다
+	constinit thread_local ThreadCounters t_counters{};
+
+	// 프레임 통계 — MarkFrame 을 부르는 스레드만 쓰고 읽는다
+	AllocationTracker::TagCounters g_frame_start{};
+	AllocationTracker::TagCounters g_last_frame{};
+	AllocationTracker::TagCounters g_peak_frame{};
+	bool						   g_frame_started		 = false;
+	std::uint64_t				   g_frame_budget		 = 0;
+	std::uint64_t				   g_frames_over_budget = 0;
+  }
+
+  const char* AllocationTracker::TagName(AllocationTag tag)
+  {
+	switch (tag)
+	{
+	  case AllocationTag::Pathfinding: return "Pathfinding";
+	  case AllocationTag::AI: return "AI";
+	  case AllocationTag::EventBus: return "EventBus";
+	  case AllocationTag::UIText: return "UI Text";
+	  case AllocationTag::Renderer: return "Renderer";
+	  case AllocationTag::Other:
+	  case AllocationTag::Count:
+	  default: return "Other";
+	}
+  }
+
+  AllocationTracker::TagCounters AllocationTracker::ThisThread()
+  {
+	return t_counters.counters;
+  }
+
+  AllocationTracker::TagCounters AllocationTracker::Difference(const TagCounters& later, const TagCounters& earlier)
+  {
+	TagCounters result{};
+	for (std::size_t i = 0; i < TAG_COUNT; ++i)
+	{
+	  result[i].allocations = later[i].allocations - earlier[i].allocations;
+	  result[i].bytes		= later[i].bytes - earlier[i].bytes;
+	  result[i].frees		= later[i].frees - earlier[i].frees;
+	}
+	return result;
+  }
+
+  AllocationCounters AllocationTracker::Sum(const TagCounters& counters)
+  {
+	AllocationCounters total;
+	for (const AllocationCounters& counter : counters)
+	{
+	  total.allocations += counter.allocations;
+	  total.bytes += counter.bytes;
+	  total.frees += counter.frees;
+	}
+	return total;
+  }
+
+  void AllocationTracker::MarkFrame()
+  {
+	const TagCounters now = ThisThread();
+	if (!g_frame_started)
+	{
+	  // 첫 경계 전까지는 시작 로딩이라 프레임으로 치지 않는다
+	  g_frame_started = true;
+	  g_frame_start	  = now;
+	  return;
+	}
+	g_last_frame  = Difference(now, g_frame_start);
+	g_frame_start = now;
+	for (std::size_t i = 0; i < TAG_COUNT; ++i)
+	{
+	  g_peak_frame[i].allocations = std::max(g_peak_frame[i].allocations, g_last_frame[i].allocations);
+	  g_peak_frame[i].bytes		  = std::max(g_peak_frame[i].bytes, g_last_frame[i].bytes);
+	  g_peak_frame[i].frees		  = std::max(g_peak_frame[i].frees, g_last_frame[i].frees);
+	}
+	if (g_frame_budget != 0 && Sum(g_last_frame).allocations > g_frame_budget)
+	  ++g_frames_over_budget;
+  }
+
+  const AllocationTracker::TagCounters& AllocationTracker::GetLastFrame()
+  {
+	return g_last_frame;
+  }
+
+  const AllocationTracker::TagCounters& AllocationTracker::GetPeakFrame()
+  {
+	return g_peak_frame;
+  }
+
+  void AllocationTracker::ResetPeak()
+  {
+	g_peak_frame		 = {};
+	g_frames_over_budget = 0;
+  }
+
+  void AllocationTracker::SetFrameBudget(std::uint64_t allocations)
+  {
+	g_frame_budget = allocations;
+  }
+
+  std::uint64_t AllocationTracker::GetFrameBudget()
+  {
+	return g_frame_budget;
+  }
+
+  std::uint64_t AllocationTracker::GetFramesOverBudget()
+  {
+	return g_frames_over_budget;
+  }
+
+  void AllocationTracker::OnAllocate(std::size_t bytes) noexcept
+  {
+	AllocationCounters& counter = t_counters.counters[static_cast<std::size_t>(t_counters.tag)];
+	++counter.allocations;
+	counter.bytes += bytes;
+  }
+
+  void AllocationTracker::OnFree() noexcept
+  {
+	++t_counters.counters[static_cast<std::size_t>(t_counters.tag)].frees;
+  }
+
+  AllocationTag AllocationTracker::SetCurrentTag(AllocationTag tag) noexcept
+  {
+	const AllocationTag previous = t_counters.tag;
+	t_counters.tag				 = tag;
+	return previous;
+  }
+}
+
+#if defined(DRAGONIC_ALLOCATION_TRACKING)
+// 정렬 지정 operator new 와 nothrow 판은 표준 라이브러리 기본 구현을 그대로 쓴다 (nothrow 는 아래 것을 부른다)
+namespace
+{
+  void* TrackedAllocate(std::size_t size)
+  {
+	CS230::AllocationTracker::OnAllocate(size);
+	const std::size_t request = size == 0 ? 1 : size;
+	for (;;)
+	{
+	  if (void* memory = std::malloc(request))
+		return memory;
+	  const std::new_handler handler = std::get_new_handler();
+	  if (handler == nullptr)
+		throw std::bad_alloc();
+	  handler();
+	}
+  }
+
+  void TrackedFree(void* memory) noexcept
+  {
+	if (memory == nullptr)
+	  return;
+	CS230::AllocationTracker::OnFree();
+	std::free(memory);
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  return TrackedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return TrackedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+  TrackedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+  TrackedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+  TrackedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+  TrackedFree(memory);
+}
+#endif
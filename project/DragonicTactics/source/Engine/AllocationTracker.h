@@ -0,0 +1,106 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace CS230
+{
+  /// 할당을 묶어 볼 하위 시스템. 안쪽 ALLOCATION_SCOPE 가 바깥 것을 덮는다 (UI 글자는 Renderer 안에서도 UIText)
+  enum class AllocationTag : std::uint8_t
+  {
+	Other,
+	Pathfinding,
+	AI,
+	EventBus,
+	UIText,
+	Renderer,
+	Count
+  };
+
+  struct AllocationCounters
+  {
+	std::uint64_t allocations = 0;
+	std::uint64_t bytes		  = 0; // 요청한 크기의 합 (해제된 크기는 모른다)
+	std::uint64_t frees		  = 0;
+  };
+
+  /// @brief 전역 operator new/delete 를 가로채 스레드별, 태그별로 할당을 센다
+  ///
+  /// 카운터는 thread_local 이라 할당 경로에 락이나 원자 연산이 없다. 그래서 다른 스레드의 할당은
+  /// 그 스레드에서 ThisThread() 로만 볼 수 있다. 프레임 통계는 MarkFrame 을 부르는 스레드(메인) 기준.
+  /// DRAGONIC_ALLOCATION_TRACKING 이 정의되지 않으면 operator new 를 바꾸지 않고 모든 값이 0 이다.
+  class AllocationTracker
+  {
+	public:
+	static constexpr std::size_t TAG_COUNT = static_cast<std::size_t>(AllocationTag::Count);
+	using TagCounters					   = std::array<AllocationCounters, TAG_COUNT>;
+
+	static constexpr bool IsCompiledIn()
+	{
+#if defined(DRAGONIC_ALLOCATION_TRACKING)
+	  return true;
+#else
+	  return false;
+#endif
+	}
+
+	static const char* TagName(AllocationTag tag);
+
+	/// 이 스레드가 지금까지 한 할당 (태그별 누적). 두 번 읽은 차이가 그 사이의 할당
+	static TagCounters		  ThisThread();
+	static TagCounters		  Difference(const TagCounters& later, const TagCounters& earlier);
+	static AllocationCounters Sum(const TagCounters& counters);
+
+	/// 프레임 경계 — Engine::Update 가 매 프레임 시작에 부른다. 직전 프레임의 태그별 할당을 확정한다
+	static void				  MarkFrame();
+	static const TagCounters& GetLastFrame();
+	static const TagCounters& GetPeakFrame(); // 태그마다 따로 잰 프레임당 최대값
+	static void				  ResetPeak();
+
+	/// 프레임당 할당 수 예산 (0 이면 검사하지 않음). 넘은 프레임 수를 센다
+	static void			 SetFrameBudget(std::uint64_t allocations);
+	static std::uint64_t GetFrameBudget();
+	static std::uint64_t GetFramesOverBudget();
+
+	// operator new/delete 와 AllocationScope 용
+	static void			 OnAllocate(std::size_t bytes) noexcept;
+	static void			 OnFree() noexcept;
+	static AllocationTag SetCurrentTag(AllocationTag tag) noexcept; // 이전 태그를 돌려준다
+  };
+
+  /// RAII 태그 스코프 — ALLOCATION_SCOPE 매크로로 쓴다
+  class AllocationScope
+  {
+	public:
+	explicit AllocationScope(AllocationTag tag) noexcept : previous_(AllocationTracker::SetCurrentTag(tag))
+	{
+	}
+
+	~AllocationScope()
+	{
+	  AllocationTracker::SetCurrentTag(previous_);
+	}
+
+	AllocationScope(const AllocationScope&)			   = delete;
+	AllocationScope& operator=(const AllocationScope&) = delete;
+
+	private:
+	AllocationTag previous_;
+  };
+}
+
+#define ALLOCATION_CONCAT_INNER(a, b) a##b
+#define ALLOCATION_CONCAT(a, b)		  ALLOCATION_CONCAT_INNER(a, b)
+
+#if defined(DRAGONIC_ALLOCATION_TRACKING)
+#define ALLOCATION_SCOPE(tag) const CS230::AllocationScope ALLOCATION_CONCAT(allocation_scope_, __LINE__)(CS230::AllocationTag::tag)
+#else
+#define ALLOCATION_SCOPE(tag) static_cast<void>(0)
+#endif
@@ -0,0 +1,631 @@
+#include "pch.h"
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "BinaryLog.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <iterator>
+#include <map>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace CS230
+{
+  namespace
+  {
+	constexpr std::uint8_t MAGIC[] = { 'D', 'T', 'L' };
+
+	// 0 은 미리 잡아 둔 세그먼트의 빈 자리 (0 으로 채워져 있다) — 읽기는 여기서 멈춘다
+	enum RecordType : std::uint8_t
+	{
+	  RECORD_END = 0,
+	  RECORD_TEMPLATE,	   // [번호][인자 수][인자 타입들][길이][형식 문자열]
+	  RECORD_STRING,	   // [번호][길이][문자열]
+	  RECORD_DROPPED,	   // [시각 차이][버린 수]
+	  RECORD_MESSAGE = 0x10 // + 레벨. [템플릿 번호][시각 차이][인자 값들]
+	};
+
+	void PutVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+	{
+	  while (value >= 0x80)
+	  {
+		out.push_back(static_cast<std::uint8_t>(value | 0x80));
+		value >>= 7;
+	  }
+	  out.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	void PutInt(std::vector<std::uint8_t>& out, std::int64_t value)
+	{
+	  PutVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+	}
+
+	template <typename T>
+	T ReadRaw(const std::uint8_t*& pos)
+	{
+	  T value;
+	  std::memcpy(&value, pos, sizeof(T));
+	  pos += sizeof(T);
+	  return value;
+	}
+
+	/// 읽다가 범위를 넘으면 ok 가 false 가 되고 이후 값은 모두 0
+	struct ByteReader
+	{
+	  const std::uint8_t* pos;
+	  const std::uint8_t* end;
+	  bool				  ok = true;
+
+	  std::uint8_t Byte()
+	  {
+		if (pos == end)
+		{
+		  ok = false;
+		  return 0;
+		}
+		return *pos++;
+	  }
+
+	  std::uint64_t Varint()
+	  {
+		std::uint64_t value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+		  if (pos == end)
+			break;
+		  const std::uint8_t byte = *pos++;
+		  value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		  if ((byte & 0x80) == 0)
+			return value;
+		}
+		ok = false;
+		return 0;
+	  }
+
+	  std::int64_t Int()
+	  {
+		const std::uint64_t raw = Varint();
+		return static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+	  }
+
+	  std::string String()
+	  {
+		const std::uint64_t size = Varint();
+		if (!ok || size > static_cast<std::uint64_t>(end - pos))
+		{
+		  ok = false;
+		  return {};
+		}
+		std::string text(reinterpret_cast<const char*>(pos), static_cast<std::size_t>(size));
+		pos += size;
+		return text;
+	  }
+
+	  double Double()
+	  {
+		if (end - pos < static_cast<std::ptrdiff_t>(sizeof(double)))
+		{
+		  ok = false;
+		  return 0.0;
+		}
+		return ReadRaw<double>(pos);
+	  }
+	};
+
+	/// 인자 하나를 텍스트 로그와 같은 표기로 (Logger.cpp 의 AppendFormatted 와 맞춘다)
+	std::string ReadArgument(ByteReader& in, Logger::ArgumentType type, const std::vector<std::string>& strings)
+	{
+	  char number[32];
+	  switch (type)
+	  {
+		case Logger::ArgumentType::Int: return std::to_string(in.Int());
+		case Logger::ArgumentType::UInt: return std::to_string(in.Varint());
+		case Logger::ArgumentType::Double:
+		  std::snprintf(number, sizeof(number), "%g", in.Double());
+		  return number;
+		case Logger::ArgumentType::Bool: return in.Byte() != 0 ? "true" : "false";
+		case Logger::ArgumentType::Char: return std::string(1, static_cast<char>(in.Byte()));
+		case Logger::ArgumentType::String:
+		{
+		  // 짝수면 [길이 * 2][바이트], 홀수면 번호를 붙여 둔 문자열 (번호 * 2 + 1)
+		  const std::uint64_t value = in.Varint();
+		  if ((value & 1) == 0)
+		  {
+			const std::uint64_t length = value >> 1;
+			if (!in.ok || length > static_cast<std::uint64_t>(in.end - in.pos))
+			  break;
+			std::string text(reinterpret_cast<const char*>(in.pos), static_cast<std::size_t>(length));
+			in.pos += length;
+			return text;
+		  }
+		  const std::size_t index = value >> 1;
+		  if (index < strings.size())
+			return strings[index];
+		  break;
+		}
+	  }
+	  in.ok = false;
+	  return {};
+	}
+  }
+
+  std::string BinaryLogMessage::Text() const
+  {
+	if (dropped != 0)
+	  return "Logger: " + std::to_string(dropped) + " messages dropped (ring buffer full)";
+
+	std::string out;
+	std::size_t next = 0;
+	for (std::size_t i = 0; i < format.size(); ++i)
+	{
+	  if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}' && next < arguments.size())
+	  {
+		out += arguments[next++];
+		++i;
+	  }
+	  else
+		out.push_back(format[i]);
+	}
+	return out;
+  }
+
+  /// 메모리 매핑된 세그먼트 파일 하나 (웹 빌드는 매핑 대신 메모리에 모았다가 닫을 때 쓴다)
+  class BinaryLogWriter::Segment
+  {
+	public:
+	~Segment()
+	{
+	  Close();
+	}
+
+	bool Open(const std::string& path, std::size_t capacity)
+	{
+	  capacity_ = capacity;
+	  used_		= 0;
+#if defined(_WIN32)
+	  file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	  if (file_ == INVALID_HANDLE_VALUE)
+		return false;
+	  const std::uint64_t size = capacity;
+	  mapping_				   = CreateFileMappingA(file_, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFu), nullptr);
+	  if (mapping_ != nullptr)
+		data_ = static_cast<std::uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_WRITE, 0, 0, capacity));
+	  if (data_ == nullptr)
+	  {
+		Close();
+		return false;
+	  }
+#elif !defined(__EMSCRIPTEN__)
+	  fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	  if (fd_ < 0)
+		return false;
+	  if (::ftruncate(fd_, static_cast<off_t>(capacity)) != 0)
+	  {
+		Close();
+		return false;
+	  }
+	  void* data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+	  if (data == MAP_FAILED)
+	  {
+		Close();
+		return false;
+	  }
+	  data_ = static_cast<std::uint8_t*>(data);
+#else
+	  path_ = path;
+	  buffer_.assign(capacity, 0);
+	  data_ = buffer_.data();
+#endif
+	  return true;
+	}
+
+	void Close()
+	{
+#if defined(_WIN32)
+	  if (data_ != nullptr)
+		UnmapViewOfFile(data_);
+	  if (mapping_ != nullptr)
+		CloseHandle(mapping_);
+	  if (file_ != INVALID_HANDLE_VALUE)
+	  {
+		// 미리 잡아 둔 뒷부분(0) 을 잘라낸다
+		LARGE_INTEGER length;
+		length.QuadPart = static_cast<LONGLONG>(used_);
+		SetFilePointerEx(file_, length, nullptr, FILE_BEGIN);
+		SetEndOfFile(file_);
+		CloseHandle(file_);
+	  }
+	  mapping_ = nullptr;
+	  file_	   = INVALID_HANDLE_VALUE;
+#elif !defined(__EMSCRIPTEN__)
+	  if (data_ != nullptr)
+		::munmap(data_, capacity_);
+	  if (fd_ >= 0)
+	  {
+		[[maybe_unused]] const int result = ::ftruncate(fd_, static_cast<off_t>(used_));
+		::close(fd_);
+	  }
+	  fd_ = -1;
+#else
+	  if (data_ != nullptr)
+	  {
+		std::ofstream file(path_, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(used_));
+	  }
+	  buffer_.clear();
+#endif
+	  data_ = nullptr;
+	}
+
+	bool Fits(std::size_t size) const
+	{
+	  return used_ + size < capacity_; // 마지막 바이트는 RECORD_END 자리로 남긴다
+	}
+
+	void Append(const std::uint8_t* bytes, std::size_t size)
+	{
+	  std::memcpy(data_ + used_, bytes, size);
+	  used_ += size;
+	}
+
+	private:
+	std::uint8_t* data_		= nullptr;
+	std::size_t	  capacity_ = 0;
+	std::size_t	  used_		= 0;
+#if defined(_WIN32)
+	HANDLE file_	= INVALID_HANDLE_VALUE;
+	HANDLE mapping_ = nullptr;
+#elif !defined(__EMSCRIPTEN__)
+	int fd_ = -1;
+#else
+	std::string				  path_;
+	std::vector<std::uint8_t> buffer_;
+#endif
+  };
+
+  BinaryLogWriter::BinaryLogWriter()  = default;
+  BinaryLogWriter::~BinaryLogWriter() = default;
+
+  bool BinaryLogWriter::Open(const std::string& path_prefix, std::size_t segment_bytes, int max_segments)
+  {
+	Close();
+	prefix_		   = path_prefix;
+	segment_bytes_ = std::max(segment_bytes, MIN_SEGMENT_BYTES);
+	max_segments_  = std::max(1, max_segments);
+	bytes_written_ = 0;
+	return OpenSegment(0);
+  }
+
+  bool BinaryLogWriter::IsOpen() const
+  {
+	return segment_ != nullptr;
+  }
+
+  void BinaryLogWriter::Close()
+  {
+	segment_.reset();
+	index_ = -1;
+  }
+
+  bool BinaryLogWriter::OpenSegment(int index)
+  {
+	segment_.reset();
+	index_ = index;
+	templates_.clear();
+	strings_.clear();
+	template_count_ = 0;
+	last_time_		= 0;
+
+	if (index >= max_segments_)
+	{
+	  std::error_code ignored;
+	  std::filesystem::remove(SegmentPath(prefix_, index - max_segments_), ignored);
+	}
+
+	auto segment = std::make_unique<Segment>();
+	if (!segment->Open(SegmentPath(prefix_, index), segment_bytes_))
+	  return false;
+	segment_ = std::move(segment);
+
+	record_.assign(std::begin(MAGIC), std::end(MAGIC));
+	record_.push_back(VERSION);
+	PutVarint(record_, static_cast<std::uint64_t>(index));
+	Append(record_);
+	return true;
+  }
+
+  void BinaryLogWriter::Append(const std::vector<std::uint8_t>& bytes)
+  {
+	segment_->Append(bytes.data(), bytes.size());
+	bytes_written_ += bytes.size();
+  }
+
+  void BinaryLogWriter::WriteMessage(std::int64_t nanoseconds, Logger::Severity severity, const char* format, const std::uint8_t* arguments, std::size_t size)
+  {
+	if (!IsOpen())
+	  return;
+
+	// 정의 레코드(템플릿, 문자열) + 메시지를 한 덩어리로 만들어 보고,
+	// 세그먼트에 안 들어가면 다음 세그먼트에서 (표를 비우고) 다시 만든다
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+	  record_.clear();
+	  // "{}" 는 문자열로 미리 조립된 예전 방식 로그 — 거의 다시 나오지 않으므로 번호를 붙이지 않는다
+	  intern_strings_ = std::strcmp(format, "{}") != 0;
+	  PutArguments(arguments, size);
+
+	  std::vector<TemplateEntry>& entries = templates_[format];
+	  auto						  it	  = std::find_if(entries.begin(), entries.end(), [this](const TemplateEntry& entry) { return entry.signature == signature_; });
+	  if (it == entries.end())
+	  {
+		it						 = entries.insert(entries.end(), TemplateEntry{ signature_, template_count_++ });
+		const std::size_t length = std::strlen(format);
+		record_.push_back(RECORD_TEMPLATE);
+		PutVarint(record_, it->id);
+		record_.push_back(static_cast<std::uint8_t>(signature_.size()));
+		record_.insert(record_.end(), signature_.begin(), signature_.end());
+		PutVarint(record_, length);
+		record_.insert(record_.end(), format, format + length);
+	  }
+
+	  const std::int64_t micros = nanoseconds / 1000;
+	  record_.push_back(static_cast<std::uint8_t>(RECORD_MESSAGE + static_cast<std::uint8_t>(severity)));
+	  PutVarint(record_, it->id);
+	  PutInt(record_, micros - last_time_);
+	  record_.insert(record_.end(), values_.begin(), values_.end());
+
+	  if (segment_->Fits(record_.size()))
+	  {
+		Append(record_);
+		last_time_ = micros;
+		return;
+	  }
+	  if (!OpenSegment(index_ + 1))
+		return;
+	}
+  }
+
+  void BinaryLogWriter::PutArguments(const std::uint8_t* arguments, std::size_t size)
+  {
+	// Logger 의 인자 인코딩([타입][8바이트 값]...) 을 타입(signature_) 과 값(values_) 으로 나눠 줄인다
+	signature_.clear();
+	values_.clear();
+	const std::uint8_t* pos = arguments;
+	const std::uint8_t* end = arguments + size;
+	while (pos < end)
+	{
+	  const auto type = static_cast<Logger::ArgumentType>(*pos++);
+	  signature_.push_back(static_cast<char>(type));
+	  switch (type)
+	  {
+		case Logger::ArgumentType::Int: PutInt(values_, ReadRaw<long long>(pos)); break;
+		case Logger::ArgumentType::UInt: PutVarint(values_, ReadRaw<unsigned long long>(pos)); break;
+		case Logger::ArgumentType::Double:
+		  values_.insert(values_.end(), pos, pos + sizeof(double));
+		  pos += sizeof(double);
+		  break;
+		case Logger::ArgumentType::Bool:
+		case Logger::ArgumentType::Char: values_.push_back(*pos++); break;
+		case Logger::ArgumentType::String:
+		{
+		  const std::uint16_t length = ReadRaw<std::uint16_t>(pos);
+		  PutString(std::string_view(reinterpret_cast<const char*>(pos), length));
+		  pos += length;
+		  break;
+		}
+	  }
+	}
+  }
+
+  void BinaryLogWriter::PutString(std::string_view text)
+  {
+	if (intern_strings_ && text.size() <= MAX_INTERNED_LENGTH)
+	{
+	  auto it = strings_.find(text);
+	  if (it == strings_.end() && strings_.size() < MAX_INTERNED_STRINGS)
+	  {
+		it = strings_.emplace(std::string(text), static_cast<std::uint32_t>(strings_.size())).first;
+		record_.push_back(RECORD_STRING);
+		PutVarint(record_, it->second);
+		PutVarint(record_, text.size());
+		record_.insert(record_.end(), text.begin(), text.end());
+	  }
+	  if (it != strings_.end())
+	  {
+		PutVarint(values_, (static_cast<std::uint64_t>(it->second) << 1) | 1);
+		return;
+	  }
+	}
+	PutVarint(values_, text.size() << 1);
+	values_.insert(values_.end(), text.begin(), text.end());
+  }
+
+  void BinaryLogWriter::WriteDropped(std::int64_t nanoseconds, std::uint64_t count)
+  {
+	if (!IsOpen())
+	  return;
+	const std::int64_t micros = nanoseconds / 1000;
+	record_.clear();
+	record_.push_back(RECORD_DROPPED);
+	PutInt(record_, micros - last_time_);
+	PutVarint(record_, count);
+	if (!segment_->Fits(record_.size()) && !OpenSegment(index_ + 1))
+	  return;
+	Append(record_);
+	last_time_ = micros;
+  }
+
+  std::uint64_t BinaryLogWriter::GetBytesWritten() const
+  {
+	return bytes_written_;
+  }
+
+  int BinaryLogWriter::GetSegmentIndex() const
+  {
+	return index_;
+  }
+
+  std::string BinaryLogWriter::SegmentPath(const std::string& path_prefix, int index)
+  {
+	char suffix[32];
+	std::snprintf(suffix, sizeof(suffix), ".%04d.dtl", index);
+	return path_prefix + suffix;
+  }
+
+  bool BinaryLogReader::ReadSegment(const std::string& path, std::vector<BinaryLogMessage>& out, std::string& error)
+  {
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open())
+	{
+	  error = "cannot open " + path;
+	  return false;
+	}
+	const std::vector<std::uint8_t> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	return Parse(bytes, out, error);
+  }
+
+  bool BinaryLogReader::Parse(const std::vector<std::uint8_t>& bytes, std::vector<BinaryLogMessage>& out, std::string& error)
+  {
+	if (bytes.size() < 4 || !std::equal(std::begin(MAGIC), std::end(MAGIC), bytes.begin()))
+	{
+	  error = "not a binary log segment";
+	  return false;
+	}
+	if (bytes[3] != BinaryLogWriter::VERSION)
+	{
+	  error = "unsupported binary log version " + std::to_string(bytes[3]);
+	  return false;
+	}
+
+	struct Template
+	{
+	  std::string format;
+	  std::string types;
+	};
+
+	ByteReader in{ bytes.data() + 4, bytes.data() + bytes.size() };
+	in.Varint(); // 세그먼트 번호
+	std::vector<Template>	 templates;
+	std::vector<std::string> strings;
+	std::int64_t			 micros = 0;
+	while (in.ok && in.pos != in.end)
+	{
+	  const std::uint8_t type = in.Byte();
+	  if (type == RECORD_END)
+		break;
+
+	  // 레코드 도중에 끝나면 (기록 중 크래시) 그 레코드만 버린다
+	  BinaryLogMessage message;
+	  if (type == RECORD_TEMPLATE)
+	  {
+		const std::uint64_t id = in.Varint();
+		Template			entry;
+		for (std::uint8_t count = in.Byte(); in.ok && count > 0; --count)
+		  entry.types.push_back(static_cast<char>(in.Byte()));
+		entry.format = in.String();
+		if (!in.ok)
+		  return true;
+		if (id != templates.size())
+		{
+		  error = "template ids out of order";
+		  return false;
+		}
+		templates.push_back(std::move(entry));
+		continue;
+	  }
+	  if (type == RECORD_STRING)
+	  {
+		const std::uint64_t id	 = in.Varint();
+		std::string			text = in.String();
+		if (!in.ok)
+		  return true;
+		if (id != strings.size())
+		{
+		  error = "string ids out of order";
+		  return false;
+		}
+		strings.push_back(std::move(text));
+		continue;
+	  }
+	  if (type == RECORD_DROPPED)
+	  {
+		micros += in.Int();
+		message.dropped	 = in.Varint();
+		message.severity = Logger::Severity::Error;
+	  }
+	  else if (type >= RECORD_MESSAGE && type <= RECORD_MESSAGE + static_cast<std::uint8_t>(Logger::Severity::Error))
+	  {
+		message.severity	= static_cast<Logger::Severity>(type - RECORD_MESSAGE);
+		message.template_id = static_cast<std::uint32_t>(in.Varint());
+		micros += in.Int();
+		if (in.ok && message.template_id >= templates.size())
+		{
+		  error = "message refers to undefined template " + std::to_string(message.template_id);
+		  return false;
+		}
+		if (in.ok)
+		{
+		  const Template& entry = templates[message.template_id];
+		  message.format		= entry.format;
+		  for (const char argument_type : entry.types)
+			message.arguments.push_back(ReadArgument(in, static_cast<Logger::ArgumentType>(argument_type), strings));
+		}
+	  }
+	  else
+	  {
+		error = "unknown record type " + std::to_string(type);
+		return false;
+	  }
+	  if (!in.ok)
+		return true;
+	  message.nanoseconds = micros * 1000;
+	  out.push_back(std::move(message));
+	}
+	return true;
+  }
+
+  std::vector<std::string> BinaryLogReader::ListSegments(const std::string& path_prefix)
+  {
+	// 회전으로 앞 번호가 지워졌을 수 있으니 디렉터리에서 prefix.NNNN.dtl 을 모은다
+	const std::filesystem::path prefix(path_prefix);
+	const std::filesystem::path directory = prefix.has_parent_path() ? prefix.parent_path() : std::filesystem::path(".");
+	const std::string			stem	  = prefix.filename().string() + ".";
+
+	std::map<int, std::string> found;
+	std::error_code			   ignored;
+	for (const auto& entry : std::filesystem::directory_iterator(directory, ignored))
+	{
+	  const std::string name = entry.path().filename().string();
+	  if (name.size() != stem.size() + 8 || name.compare(0, stem.size(), stem) != 0 || name.compare(name.size() - 4, 4, ".dtl") != 0)
+		continue;
+	  const std::string digits = name.substr(stem.size(), 4);
+	  if (digits.find_first_not_of("0123456789") != std::string::npos)
+		continue;
+	  found[std::stoi(digits)] = entry.path().string();
+	}
+
+	std::vector<std::string> paths;
+	for (const auto& [index, path] : found)
+	  paths.push_back(path);
+	return paths;
+  }
+}
@@ -0,0 +1,124 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Logger.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CS230
+{
+  /// 바이너리 로그에서 읽은 메시지 하나
+  struct BinaryLogMessage
+  {
+	std::int64_t			 nanoseconds = 0; // Logger 시작부터
+	Logger::Severity		 severity	 = Logger::Severity::Event;
+	std::uint32_t			 template_id = 0; // 세그먼트 안에서만 유효
+	std::string				 format;		  // "{}" 자리 표시가 있는 형식 문자열
+	std::vector<std::string> arguments;		  // 인자를 문자열로 푼 것 (텍스트 로그와 같은 표기)
+	std::uint64_t			 dropped = 0;	  // 0 이 아니면 "링 버퍼가 가득 차 버림" 알림 레코드
+
+	/// 텍스트 로그(Trace.log)의 메시지 부분과 같은 문자열
+	std::string Text() const;
+  };
+
+  /// @brief 바이너리 로그 세그먼트(.dtl) 기록기
+  ///
+  /// 형식 문자열은 세그먼트에서 처음 나올 때 한 번만 [템플릿 번호, 인자 타입들, 문자열] 로 쓰고,
+  /// 메시지는 [레벨][템플릿 번호][시각 차이(μs)][인자 값들] 만 쓴다 (정수는 zigzag varint).
+  /// 짧은 문자열 인자(캐릭터 이름, 주문 ID 등)도 세그먼트마다 한 번만 쓰고 이후에는 번호로 가리킨다.
+  /// 세그먼트 파일은 segment_bytes 크기로 미리 잡아 메모리 매핑하고 그 위에 이어 쓴다.
+  /// 다 차면 다음 번호의 세그먼트로 넘어가고 max_segments 개보다 오래된 것은 지운다.
+  /// 세그먼트마다 템플릿 표를 새로 시작하므로 어느 세그먼트든 혼자 디코딩된다.
+  /// 매핑된 페이지는 프로세스가 죽어도 OS 가 파일에 쓰므로 마지막 메시지까지 남는다.
+  class BinaryLogWriter
+  {
+	public:
+	static constexpr std::uint8_t VERSION			   = 1;
+	static constexpr std::size_t  MIN_SEGMENT_BYTES	   = 64 * 1024;
+	static constexpr std::size_t  DEFAULT_SEGMENT_BYTES = 8 * 1024 * 1024;
+	static constexpr std::size_t  MAX_INTERNED_LENGTH	  = 32;	  // 이보다 긴 문자열 인자는 매번 그대로 쓴다
+	static constexpr std::size_t  MAX_INTERNED_STRINGS  = 4096; // 세그먼트당
+
+	BinaryLogWriter();
+	~BinaryLogWriter();
+
+	BinaryLogWriter(const BinaryLogWriter&)			   = delete;
+	BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+	/// path_prefix.0000.dtl 부터 쓴다 (같은 이름의 이전 세그먼트는 덮어쓴다)
+	bool Open(const std::string& path_prefix, std::size_t segment_bytes = DEFAULT_SEGMENT_BYTES, int max_segments = 8);
+	bool IsOpen() const;
+	/// 쓴 길이로 파일을 잘라 닫는다
+	void Close();
+
+	/// arguments 는 Logger 의 인자 인코딩 ([ArgumentType][값] 반복)
+	void WriteMessage(std::int64_t nanoseconds, Logger::Severity severity, const char* format, const std::uint8_t* arguments, std::size_t size);
+	void WriteDropped(std::int64_t nanoseconds, std::uint64_t count);
+
+	std::uint64_t GetBytesWritten() const;
+	int			  GetSegmentIndex() const;
+
+	static std::string SegmentPath(const std::string& path_prefix, int index);
+
+	private:
+	bool OpenSegment(int index);
+	void Append(const std::vector<std::uint8_t>& bytes);
+	void PutArguments(const std::uint8_t* arguments, std::size_t size);
+	void PutString(std::string_view text);
+
+	class Segment;
+
+	/// 같은 형식 문자열이라도 호출한 곳마다 인자 타입이 다를 수 있어 (형식, 타입들) 로 구분한다
+	struct TemplateEntry
+	{
+	  std::string	signature;
+	  std::uint32_t id;
+	};
+
+	struct StringHash
+	{
+	  using is_transparent = void;
+	  std::size_t operator()(std::string_view text) const
+	  {
+		return std::hash<std::string_view>{}(text);
+	  }
+	};
+
+	std::unique_ptr<Segment>												 segment_;
+	std::string																 prefix_;
+	std::size_t																 segment_bytes_	 = DEFAULT_SEGMENT_BYTES;
+	int																		 max_segments_	 = 8;
+	int																		 index_			 = -1;
+	std::int64_t															 last_time_		 = 0;
+	std::uint64_t															 bytes_written_	 = 0;
+	std::uint32_t															 template_count_ = 0;
+	std::unordered_map<const char*, std::vector<TemplateEntry>>				 templates_; // 형식 문자열 포인터 → 이 세그먼트의 템플릿
+	std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> strings_;	 // 이 세그먼트에서 번호를 붙인 문자열 인자
+	std::string																 signature_; // 작성 중인 메시지의 인자 타입들
+	std::vector<std::uint8_t>												 record_;	 // 작성 중인 정의 레코드 + 메시지
+	std::vector<std::uint8_t>												 values_;	 // 작성 중인 메시지의 인자 값들
+	bool																	 intern_strings_ = true;
+  };
+
+  /// @brief 바이너리 로그 세그먼트 읽기 (dragonic_logdecode 가 쓴다)
+  class BinaryLogReader
+  {
+	public:
+	/// 세그먼트 하나를 읽는다. 형식이 틀리면 false 와 error. 끝이 잘린 세그먼트(기록 중 크래시)는 그 앞까지 읽고 true
+	static bool ReadSegment(const std::string& path, std::vector<BinaryLogMessage>& out, std::string& error);
+	static bool Parse(const std::vector<std::uint8_t>& bytes, std::vector<BinaryLogMessage>& out, std::string& error);
+
+	/// path_prefix 의 세그먼트 파일들을 번호 순으로 (회전으로 지워진 앞 번호는 건너뛴다)
+	static std::vector<std::string> ListSegments(const std::string& path_prefix);
+  };
+}
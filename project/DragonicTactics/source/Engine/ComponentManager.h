@@ -9,6 +9,8 @@ Created:    May 17, 2025
 */
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -17,6 +19,41 @@ Created:    May 17, 2025
 
 namespace CS230
 {
+  // 컴포넌트 타입마다 0 부터 촘촘하게 붙는 번호. 타입별로 처음 쓰일 때 한 번 정해지고 이후 바뀌지 않는다
+  // (템플릿 인스턴스의 정적 지역 변수라 TU 가 달라도 같은 값)
+  class ComponentTypeId
+  {
+public:
+	template <typename T>
+	static std::size_t Of()
+	{
+	  static const std::size_t id = Next();
+	  return id;
+	}
+
+	static std::size_t Count()
+	{
+	  return counter().load(std::memory_order_relaxed);
+	}
+
+private:
+	static std::size_t Next()
+	{
+	  return counter().fetch_add(1, std::memory_order_relaxed);
+	}
+
+	static std::atomic<std::size_t>& counter()
+	{
+	  static std::atomic<std::size_t> next{ 0 };
+	  return next;
+	}
+  };
+
+  // GetComponent<T> 는 타입 번호로 바로 찾는 표를 먼저 본다 (배열 접근 한 번).
+  // 표가 비어 있는 타입만 예전처럼 dynamic_cast 로 훑고, 그 결과(없음 포함)를 표에 기억한다 —
+  // 파생 타입으로 등록된 컴포넌트를 기반 타입으로 찾는 경우(Collision 등)도 처음 한 번만 느리다.
+  // 추가/제거 시 표를 비우므로 결과는 항상 선형 탐색과 같다 (같은 타입이 여럿이면 먼저 추가된 것).
+  // 한 ComponentManager 를 여러 스레드가 동시에 조회하면 안 된다 (조회가 표를 채운다).
   class ComponentManager
   {
 public:
@@ -32,10 +69,23 @@ public:
 	void AddComponent(Component* component)
 	{
 	  components.emplace_back(component);
+	  InvalidateLookup();
 	}
 
 	template <typename T>
 	T* GetComponent()
+	{
+	  const std::size_t id = ComponentTypeId::Of<T>();
+	  if (id < lookup.size() && lookup[id].resolved)
+	  {
+		return static_cast<T*>(lookup[id].component);
+	  }
+	  return ResolveComponent<T>(id);
+	}
+
+	// 느린 경로 — 표를 거치지 않고 매번 dynamic_cast 로 훑는다 (표 검증/벤치마크용)
+	template <typename T>
+	T* FindComponentPolymorphic() const
 	{
 	  for (const auto& component : components)
 	  {
@@ -56,15 +106,41 @@ public:
 	  if (it != components.end())
 	  {
 		components.erase(it);
+		InvalidateLookup();
 	  }
 	}
 
 	void Clear()
 	{
 	  components.clear();
+	  InvalidateLookup();
 	}
 
 private:
+	struct LookupSlot
+	{
+	  void* component = nullptr; // T* (타입 번호마다 T 가 정해져 있으므로 void* 로 보관)
+	  bool	resolved  = false;
+	};
+
+	template <typename T>
+	T* ResolveComponent(std::size_t id)
+	{
+	  T* found = FindComponentPolymorphic<T>();
+	  if (id >= lookup.size())
+	  {
+		lookup.resize(std::max(id + 1, ComponentTypeId::Count()));
+	  }
+	  lookup[id] = { found, true };
+	  return found;
+	}
+
+	void InvalidateLookup()
+	{
+	  std::fill(lookup.begin(), lookup.end(), LookupSlot{});
+	}
+
 	std::vector<std::unique_ptr<Component>> components;
+	std::vector<LookupSlot>				  lookup; // 타입 번호 → 찾은 컴포넌트
   };
 }
@@ -8,8 +8,8 @@
  */
 #pragma once
 
+#include "FrameStats.h"
 #include "Vec2.h"
-#include <SDL.h>
 #include <filesystem>
 #include <gsl/gsl>
 #include <memory>
@@ -18,6 +18,7 @@
 namespace CS230
 {
   class Logger;
+  class Profiler;
   class Window;
   class Input;
   class GameState;
@@ -34,6 +35,9 @@ namespace CS200
 
 class TextManager;
 class SoundManager;
+
+typedef union SDL_Event SDL_Event;
+
 /**
  * \brief Runtime information about the window and application state
  *
@@ -47,6 +51,8 @@ class SoundManager;
  * - ElapsedTime: Total time since application started (for animations and effects)
  * - FrameCount: Total number of frames rendered (for debugging and profiling)
  * - FPS: Current frames per second (for performance monitoring)
+ * - FrameTimes: Frame time percentiles, hitches and update/draw/swap breakdown
+ *   over the recent frames (FPS averages spikes away; these do not)
  *
  * Display Information:
  * - DisplaySize: Current viewport dimensions in pixels (for coordinate calculations)
@@ -64,6 +70,7 @@ struct WindowEnvironment
   double	 DeltaTime	 = 0.0; ///< Time in seconds since last frame
   double	 ElapsedTime = 0.0; ///< Total time in seconds since application start
   Math::vec2 DisplaySize{};		///< Current viewport size in pixels
+  util::FrameTimeSummary FrameTimes{}; ///< Recent frame time statistics (see util::FrameStats)
 };
 
 /**
@@ -149,6 +156,9 @@ class Engine
    * - Display mode and resolution control
    * - Event system integration
    * - Cross-platform window handling
+   *
+   * Defined in EngineWindow.cpp, which only the game executable links; headless
+   * tools have no window.
    */
   static CS230::Window& GetWindow();
 
@@ -182,11 +192,21 @@ class Engine
    * - Delta time for frame-rate independent movement
    * - Total elapsed time for animations and effects
    * - Current FPS for performance monitoring
+   * - Frame time percentiles and hitch counts for spotting spikes
    * - Frame count for debugging and profiling
    * - Current viewport size for coordinate calculations
    */
   static const WindowEnvironment& GetWindowEnvironment();
 
+  /**
+   * \brief Access the per-frame timing history
+   * \return Reference to FrameStats holding the recent frames' durations
+   *
+   * WindowEnvironment::FrameTimes is its summary over the whole ring. Use this
+   * for histograms, custom windows, or FrameStats::WriteCsv in performance runs.
+   */
+  static util::FrameStats& GetFrameStats();
+
   /**
    * \brief Access the game state management system
    * \return Reference to GameStateManager for application state control
@@ -205,6 +225,16 @@ class Engine
    */
   static CS230::GameStateManager& GetGameStateManager();
 
+  /**
+   * \brief Route GetGameStateManager() on the calling thread to another manager
+   * \param manager Manager owned by the caller, or nullptr to restore the engine's own
+   *
+   * Lets headless tools run isolated battles on worker threads: every GetGSComponent
+   * lookup made on that thread resolves against the worker's own state stack.
+   * The logger and texture cache stay shared and are safe to use concurrently.
+   */
+  static void SetThreadGameStateManager(CS230::GameStateManager* manager);
+
   /**
    * \brief Access the 2D rendering system
    * \return Reference to IRenderer2D for all 2D graphics operations
@@ -244,8 +274,19 @@ class Engine
 
   static SoundManager& GetSoundManager();
 
+  // GetWindow() 처럼 게임 실행 파일에만 있다
   static TextManager& GetTextManager();
 
+  /**
+   * \brief Access the CPU scope profiler
+   * \return Reference to the Profiler that PROFILE_SCOPE records into
+   *
+   * Scopes are only compiled in when DRAGONIC_PROFILER is defined (developer
+   * builds, or ENABLE_PROFILER=ON). The profiler itself always exists so the
+   * debug panel and tools can query it.
+   */
+  static CS230::Profiler& GetProfiler();
+
   public:
   /**
    * \brief Initialize and start the engine with all subsystems
@@ -274,6 +315,26 @@ class Engine
    */
   void Start(std::string_view window_title);
 
+  /**
+   * \brief Initialize the engine without a window, OpenGL context, ImGui or audio
+   *
+   * Used by command-line tools (benchmarks, battle simulation) that only need the
+   * logger, the game state manager and the state components. Textures are loaded
+   * for their size only and drawing goes to CS200::NullRenderer2D, so GameState::Draw
+   * still runs its CPU side. SoundManager uses its null backend. Update() must not be called in this mode; tools drive
+   * their states directly.
+   *
+   * This and everything else the tools touch lives in the dragonic_tactics_core library,
+   * which does not link SDL, OpenGL, ImGui or OpenAL. Start(), Update(), OnEvent(),
+   * HasGameEnded(), GetWindow() and GetTextManager() are only in the game executable.
+   */
+  void StartHeadless();
+
+  /**
+   * \brief Check whether the engine was started with StartHeadless()
+   */
+  static bool IsHeadless();
+
   /**
    * \brief Shutdown the engine and clean up all resources
    *
@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \author Rudy Castan
+ * \author Jonathan Holmes
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+
+#include "Engine.h"
+
+#include "FPS.h"
+#include "FrameStats.h"
+#include "GameStateManager.h"
+#include "Input.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include "SoundManager.h"
+#include "TextureManager.h"
+#include "Timer.h"
+
+#include <chrono>
+#include <memory>
+
+// Engine.cpp (헤드리스 도구와 게임이 같이 쓰는 부분) 와 EngineWindow.cpp (게임 실행 파일에만 있는 창/GL/ImGui 부분) 가 공유하는 Pimpl
+
+/**
+ * \brief Services that only exist when the engine was started with a window
+ *
+ * Engine::Start() creates the implementation (window, ImGui viewport, text manager) in
+ * EngineWindow.cpp, which is linked into the game executable only. The headless core
+ * never names those types and only destroys the object through this base.
+ */
+class EnginePlatform
+{
+  public:
+  virtual ~EnginePlatform() = default;
+  virtual void Shutdown()	= 0;
+};
+
+// Pimpl implementation class
+class Engine::Impl
+{
+  public:
+  Impl()
+	  :
+#ifdef DEVELOPER_VERSION
+		logger(CS230::Logger::Severity::Debug, true, std::chrono::system_clock::now())
+#else
+		logger(CS230::Logger::Severity::Debug, true, std::chrono::system_clock::now())
+#endif
+		,
+		input{}
+  {
+  }
+
+  CS230::Profiler				  profiler{}; // 다른 멤버의 소멸자 안의 스코프도 기록되도록 가장 먼저 만들고 가장 늦게 없앤다
+  CS230::Logger					  logger;
+  std::unique_ptr<EnginePlatform> platform{}; // Start() 전과 헤드리스에서는 nullptr. 텍스처보다 늦게 없애야 GL 컨텍스트가 남아 있다
+  CS230::Input					  input{};
+  util::FPS						  fps{};
+  util::FrameStats				  frameStats{};
+  util::Timer					  timer{};
+  WindowEnvironment				  environment{};
+  CS230::GameStateManager		  gameStateManager{};
+  CS230::TextureManager			  textureManager{};
+  std::unique_ptr<SoundManager>	  soundmanager = std::make_unique<NullSoundManager>(); // Start() 가 OpenAL 구현으로 바꾼다
+  bool							  headless	   = false;
+};
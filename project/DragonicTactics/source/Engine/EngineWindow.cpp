@@ -0,0 +1,253 @@
+#include "pch.h"
+
+/**
+ * \file
+ * \author Rudy Castan
+ * \author Jonathan Holmes
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "Engine.h"
+#include "EngineImpl.h"
+
+#include "AllocationTracker.h"
+
+#include "CS200/ImGuiHelper.h"
+#include "CS200/RenderingAPI.h"
+#include "OpenALSoundManager.h"
+#include "Path.h"
+#include "TextManager.h"
+#include "Window.h"
+
+#include <SDL.h>
+
+// Engine 중 창 / OpenGL / ImGui / OpenAL 을 쓰는 부분 — 게임 실행 파일(dragonic_tactics)에만 링크된다.
+// 헤드리스 도구는 Engine.cpp 의 StartHeadless() 만 쓴다.
+
+namespace
+{
+  CS230::Input::Keys convert_sdl_to_cs230(SDL_Scancode scancode)
+  {
+	switch (scancode)
+	{
+	  case SDL_SCANCODE_TAB: return CS230::Input::Keys::Tab;
+	  case SDL_SCANCODE_LEFT: return CS230::Input::Keys::Left;
+	  case SDL_SCANCODE_RIGHT: return CS230::Input::Keys::Right;
+	  case SDL_SCANCODE_UP: return CS230::Input::Keys::Up;
+	  case SDL_SCANCODE_DOWN: return CS230::Input::Keys::Down;
+
+	  case SDL_SCANCODE_SPACE: return CS230::Input::Keys::Space;
+	  case SDL_SCANCODE_RETURN: return CS230::Input::Keys::Enter;
+	  case SDL_SCANCODE_ESCAPE: return CS230::Input::Keys::Escape;
+
+	  case SDL_SCANCODE_A: return CS230::Input::Keys::A;
+	  case SDL_SCANCODE_B: return CS230::Input::Keys::B;
+	  case SDL_SCANCODE_C: return CS230::Input::Keys::C;
+	  case SDL_SCANCODE_D: return CS230::Input::Keys::D;
+	  case SDL_SCANCODE_E: return CS230::Input::Keys::E;
+	  case SDL_SCANCODE_F: return CS230::Input::Keys::F;
+	  case SDL_SCANCODE_G: return CS230::Input::Keys::G;
+	  case SDL_SCANCODE_H: return CS230::Input::Keys::H;
+	  case SDL_SCANCODE_I: return CS230::Input::Keys::I;
+	  case SDL_SCANCODE_J: return CS230::Input::Keys::J;
+	  case SDL_SCANCODE_K: return CS230::Input::Keys::K;
+	  case SDL_SCANCODE_L: return CS230::Input::Keys::L;
+	  case SDL_SCANCODE_M: return CS230::Input::Keys::M;
+	  case SDL_SCANCODE_N: return CS230::Input::Keys::N;
+	  case SDL_SCANCODE_O: return CS230::Input::Keys::O;
+	  case SDL_SCANCODE_P: return CS230::Input::Keys::P;
+	  case SDL_SCANCODE_Q: return CS230::Input::Keys::Q;
+	  case SDL_SCANCODE_R: return CS230::Input::Keys::R;
+	  case SDL_SCANCODE_S: return CS230::Input::Keys::S;
+	  case SDL_SCANCODE_T: return CS230::Input::Keys::T;
+	  case SDL_SCANCODE_U: return CS230::Input::Keys::U;
+	  case SDL_SCANCODE_V: return CS230::Input::Keys::V;
+	  case SDL_SCANCODE_W: return CS230::Input::Keys::W;
+	  case SDL_SCANCODE_X: return CS230::Input::Keys::X;
+	  case SDL_SCANCODE_Y: return CS230::Input::Keys::Y;
+	  case SDL_SCANCODE_Z: return CS230::Input::Keys::Z;
+	  case SDL_SCANCODE_F1:  return CS230::Input::Keys::F1;
+	  case SDL_SCANCODE_F2:  return CS230::Input::Keys::F2;
+	  case SDL_SCANCODE_F3:  return CS230::Input::Keys::F3;
+	  case SDL_SCANCODE_F4:  return CS230::Input::Keys::F4;
+	  case SDL_SCANCODE_F5:  return CS230::Input::Keys::F5;
+	  case SDL_SCANCODE_F6:  return CS230::Input::Keys::F6;
+	  case SDL_SCANCODE_F7:  return CS230::Input::Keys::F7;
+	  case SDL_SCANCODE_F8:  return CS230::Input::Keys::F8;
+	  case SDL_SCANCODE_F9:  return CS230::Input::Keys::F9;
+	  case SDL_SCANCODE_F10: return CS230::Input::Keys::F10;
+	  case SDL_SCANCODE_F11: return CS230::Input::Keys::F11;
+	  case SDL_SCANCODE_F12: return CS230::Input::Keys::F12;
+	  case SDL_SCANCODE_GRAVE: return CS230::Input::Keys::Backtick;
+	  default: return CS230::Input::Keys::Count;
+	}
+  }
+
+  // 창을 띄운 게임에만 있는 서비스 — 헤드리스 도구는 이 파일을 링크하지 않는다
+  class WindowPlatform final : public EnginePlatform
+  {
+	public:
+	void Shutdown() override
+	{
+	  ImGuiHelper::Shutdown();
+	}
+
+	CS230::Window		  window{};
+	ImGuiHelper::Viewport viewport{};
+	TextManager			  textManager{};
+  };
+
+  WindowPlatform& windowed(EnginePlatform& platform)
+  {
+	return static_cast<WindowPlatform&>(platform);
+  }
+}
+
+CS230::Window& Engine::GetWindow()
+{
+  return windowed(*Instance().impl->platform).window;
+}
+
+TextManager& Engine::GetTextManager()
+{
+  return windowed(*Instance().impl->platform).textManager;
+}
+
+void Engine::OnEvent(const SDL_Event& event)
+{
+  ImGuiHelper::FeedEvent(event);
+
+  switch (event.type)
+  {
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+	  {
+		CS230::Input::Keys key = convert_sdl_to_cs230(event.key.keysym.scancode);
+		if (key != CS230::Input::Keys::Count)
+		{
+		  if (event.type == SDL_KEYDOWN)
+			impl->input.SetKeyPressed(key);
+		  else
+			impl->input.SetKeyReleased(key);
+		}
+	  }
+	  break;
+
+	case SDL_MOUSEBUTTONDOWN:
+	  if (event.button.button >= 1 && event.button.button <= 3)
+		impl->input.SetMousePressed(event.button.button - 1);
+	  break;
+	case SDL_MOUSEBUTTONUP:
+	  if (event.button.button >= 1 && event.button.button <= 3)
+		impl->input.SetMouseReleased(event.button.button - 1);
+	  break;
+
+	case SDL_MOUSEMOTION:
+	  impl->input.SetMousePos({ static_cast<double>(event.motion.x), static_cast<double>(event.motion.y) }, windowed(*impl->platform).window.GetSize().y);
+	  break;
+
+	case SDL_MOUSEWHEEL: impl->input.SetMouseScroll(static_cast<double>(event.wheel.y)); break;
+
+	default: break;
+  }
+}
+
+void Engine::Start(std::string_view window_title)
+{
+  impl->logger.LogEvent("Engine Started");
+#if defined(DEVELOPER_VERSION)
+  impl->logger.LogEvent("Developer Build");
+#endif
+  // 작업 디렉터리 밖에서 실행해도 Assets 를 찾도록 실행 파일 폴더를 알려 둔다
+  if (char* base_path = SDL_GetBasePath(); base_path != nullptr)
+  {
+	assets::set_fallback_directory(base_path);
+	SDL_free(base_path);
+  }
+  impl->platform = std::make_unique<WindowPlatform>();
+  auto& platform = windowed(*impl->platform);
+  platform.window.Start(window_title);
+  auto& window = platform.window;
+
+  const auto window_size = window.GetSize();
+  platform.viewport		 = { 0, 0, window_size.x, window_size.y };
+  CS200::RenderingAPI::SetViewport(window_size);
+  impl->environment.DisplaySize = { static_cast<double>(window_size.x), static_cast<double>(window_size.y) };
+  ImGuiHelper::Initialize(window.GetSDLWindow(), window.GetGLContext());
+  window.SetEventCallback([this](const SDL_Event& event) { this->OnEvent(event); });
+  impl->textureManager.Init();
+  // impl->renderer2D.Init();
+  impl->timer.ResetTimeStamp();
+  platform.textManager.Init();
+  impl->soundmanager = std::make_unique<OpenALSoundManager>();
+  impl->soundmanager->Init();
+
+  Engine::GetSoundManager().LoadBGM(SoundManager::BGM_MAIN_MENU);
+  Engine::GetSoundManager().LoadBGM(SoundManager::BGM_BATTLE);
+  Engine::GetSoundManager().LoadBGM(SoundManager::SFX_HIT);
+}
+
+void Engine::Update()
+{
+#if defined(DRAGONIC_PROFILER)
+  impl->profiler.MarkFrame();
+#endif
+  CS230::AllocationTracker::MarkFrame();
+  PROFILE_SCOPE("Engine::Update");
+  updateEnvironment();
+
+  // service update
+  auto& environment = impl->environment;
+  auto& frame_stats = impl->frameStats;
+  impl->input.Update();
+  util::Timer phase_timer;
+  {
+	PROFILE_SCOPE("Window::Update (swap)");
+	windowed(*impl->platform).window.Update();
+  }
+  frame_stats.AddPhaseTime(util::FrameStats::Phase::Swap, phase_timer.GetElapsedSeconds());
+
+  auto& state_manager = impl->gameStateManager;
+  phase_timer.ResetTimeStamp();
+  state_manager.Update(environment.DeltaTime);
+  frame_stats.AddPhaseTime(util::FrameStats::Phase::Update, phase_timer.GetElapsedSeconds());
+
+  phase_timer.ResetTimeStamp();
+  auto&				platform	  = windowed(*impl->platform);
+  const auto		viewport	  = platform.viewport;
+  const Math::ivec2 viewport_size = { viewport.width, viewport.height };
+  CS200::RenderingAPI::SetViewport(viewport_size, { viewport.x, viewport.y });
+  state_manager.Draw();
+  {
+	PROFILE_SCOPE("ImGui");
+	platform.viewport = ImGuiHelper::Begin();
+	state_manager.DrawImGui();
+	ImGuiHelper::End();
+  }
+  frame_stats.AddPhaseTime(util::FrameStats::Phase::Draw, phase_timer.GetElapsedSeconds());
+}
+
+bool Engine::HasGameEnded()
+{
+  return windowed(*impl->platform).window.IsClosed() || impl->gameStateManager.HasGameEnded();
+}
+
+void Engine::updateEnvironment()
+{
+  auto& environment		= impl->environment;
+  environment.DeltaTime = impl->timer.GetElapsedSeconds();
+  impl->timer.ResetTimeStamp();
+  environment.ElapsedTime += environment.DeltaTime;
+  ++environment.FrameCount;
+  impl->fps.Update(environment.DeltaTime);
+  environment.FPS				= impl->fps;
+  // 첫 프레임은 Start 의 로딩 시간까지 들어 있어 통계에서 뺀다
+  if (environment.FrameCount > 1)
+  {
+	impl->frameStats.EndFrame(environment.DeltaTime);
+	environment.FrameTimes = impl->frameStats.Summarize();
+  }
+  const auto viewport			= windowed(*impl->platform).viewport;
+  impl->environment.DisplaySize = { static_cast<double>(viewport.width), static_cast<double>(viewport.height) };
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "FrameStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace util
+{
+  namespace
+  {
+	constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(FrameStats::Phase::Count);
+
+	/// 정렬된 값에서 nearest-rank 백분위
+	double Percentile(const float* sorted, std::size_t count, double percent)
+	{
+	  const auto rank = static_cast<std::size_t>(std::ceil(percent / 100.0 * static_cast<double>(count)));
+	  return static_cast<double>(sorted[std::clamp<std::size_t>(rank, 1, count) - 1]);
+	}
+  }
+
+  void FrameStats::AddPhaseTime(Phase phase, double seconds)
+  {
+	pending[static_cast<std::size_t>(phase)] += static_cast<float>(seconds * 1000.0);
+  }
+
+  void FrameStats::EndFrame(double delta_seconds)
+  {
+	Sample& sample	= sampleRing[head];
+	sample.total_ms = static_cast<float>(delta_seconds * 1000.0);
+	for (std::size_t i = 0; i < PHASE_COUNT; ++i)
+	{
+	  sample.phase_ms[i] = pending[i];
+	  pending[i]		 = 0.0f;
+	}
+	head  = (head + 1) % CAPACITY;
+	count = std::min(count + 1, CAPACITY);
+	++totalFrames;
+  }
+
+  const FrameStats::Sample& FrameStats::GetSample(std::size_t i) const
+  {
+	return sampleRing[(head + CAPACITY - count + i) % CAPACITY];
+  }
+
+  std::size_t FrameStats::GetCount() const
+  {
+	return count;
+  }
+
+  std::uint64_t FrameStats::GetTotalFrames() const
+  {
+	return totalFrames;
+  }
+
+  void FrameStats::SetFrameBudget(double milliseconds)
+  {
+	budgetMs = milliseconds;
+  }
+
+  double FrameStats::GetFrameBudget() const
+  {
+	return budgetMs;
+  }
+
+  void FrameStats::Clear()
+  {
+	head  = 0;
+	count = 0;
+	std::fill(std::begin(pending), std::end(pending), 0.0f);
+  }
+
+  FrameTimeSummary FrameStats::Summarize(std::size_t frames) const
+  {
+	FrameTimeSummary summary;
+	const std::size_t n = frames == 0 ? count : std::min(frames, count);
+	if (n == 0)
+	  return summary;
+
+	const std::size_t first = count - n;
+	double			  total = 0.0;
+	double			  phase_total[PHASE_COUNT]{};
+	for (std::size_t i = 0; i < n; ++i)
+	{
+	  const Sample& sample = GetSample(first + i);
+	  scratch[i]		   = sample.total_ms;
+	  total += static_cast<double>(sample.total_ms);
+	  for (std::size_t p = 0; p < PHASE_COUNT; ++p)
+		phase_total[p] += static_cast<double>(sample.phase_ms[p]);
+	}
+	std::sort(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(n));
+
+	const double inv = 1.0 / static_cast<double>(n);
+	summary.frames	 = static_cast<int>(n);
+	summary.mean_ms	 = total * inv;
+	summary.p50_ms	 = Percentile(scratch.data(), n, 50.0);
+	summary.p95_ms	 = Percentile(scratch.data(), n, 95.0);
+	summary.p99_ms	 = Percentile(scratch.data(), n, 99.0);
+	summary.max_ms	 = static_cast<double>(scratch[n - 1]);
+
+	// 정렬돼 있으니 뒤에서부터 문턱을 넘는 개수만 센다
+	const double over_ms  = budgetMs * BUDGET_SLACK;
+	const double hitch_ms = std::max(HITCH_FACTOR * summary.p50_ms, over_ms);
+	for (std::size_t i = n; i > 0 && static_cast<double>(scratch[i - 1]) > over_ms; --i)
+	{
+	  ++summary.over_budget;
+	  if (static_cast<double>(scratch[i - 1]) > hitch_ms)
+		++summary.hitches;
+	}
+
+	summary.update_ms = phase_total[static_cast<std::size_t>(Phase::Update)] * inv;
+	summary.draw_ms	  = phase_total[static_cast<std::size_t>(Phase::Draw)] * inv;
+	summary.swap_ms	  = phase_total[static_cast<std::size_t>(Phase::Swap)] * inv;
+	summary.other_ms  = std::max(0.0, summary.mean_ms - summary.update_ms - summary.draw_ms - summary.swap_ms);
+	return summary;
+  }
+
+  std::array<float, FrameStats::HISTOGRAM_BUCKETS> FrameStats::Histogram(std::size_t frames) const
+  {
+	std::array<float, HISTOGRAM_BUCKETS> buckets{};
+	const std::size_t					 n = frames == 0 ? count : std::min(frames, count);
+	for (std::size_t i = count - n; i < count; ++i)
+	{
+	  const double bucket = static_cast<double>(GetSample(i).total_ms) / HISTOGRAM_BUCKET_MS;
+	  buckets[std::min(static_cast<std::size_t>(std::max(bucket, 0.0)), HISTOGRAM_BUCKETS - 1)] += 1.0f;
+	}
+	return buckets;
+  }
+
+  bool FrameStats::WriteCsv(const std::string& path) const
+  {
+	std::ofstream out(path);
+	if (!out.is_open())
+	  return false;
+
+	out << "frame,total_ms,update_ms,draw_ms,swap_ms\n";
+	const std::uint64_t first_frame = totalFrames - count;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+	  const Sample& sample = GetSample(i);
+	  out << first_frame + i << ',' << sample.total_ms << ',' << sample.phase_ms[static_cast<std::size_t>(Phase::Update)] << ','
+		  << sample.phase_ms[static_cast<std::size_t>(Phase::Draw)] << ',' << sample.phase_ms[static_cast<std::size_t>(Phase::Swap)] << '\n';
+	}
+
+	const FrameTimeSummary summary = Summarize();
+	out << "# frames=" << summary.frames << " mean_ms=" << summary.mean_ms << " p50_ms=" << summary.p50_ms << " p95_ms=" << summary.p95_ms
+		<< " p99_ms=" << summary.p99_ms << " max_ms=" << summary.max_ms << " hitches=" << summary.hitches << " over_budget=" << summary.over_budget
+		<< " budget_ms=" << budgetMs << '\n';
+	return static_cast<bool>(out);
+  }
+}
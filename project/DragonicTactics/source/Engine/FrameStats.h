@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace util
+{
+  /// 최근 프레임 구간의 프레임 시간 통계 (모두 밀리초)
+  struct FrameTimeSummary
+  {
+	int	   frames	   = 0;
+	double mean_ms	   = 0.0;
+	double p50_ms	   = 0.0;
+	double p95_ms	   = 0.0;
+	double p99_ms	   = 0.0;
+	double max_ms	   = 0.0;
+	int	   hitches	   = 0;	  // 중앙값의 HITCH_FACTOR 배와 프레임 예산을 둘 다 넘은 프레임
+	int	   over_budget = 0;	  // 프레임 예산을 넘은 프레임 (히치 포함)
+	double update_ms   = 0.0; // 단계별 평균
+	double draw_ms	   = 0.0;
+	double swap_ms	   = 0.0;
+	double other_ms	   = 0.0; // 입력, 환경 갱신, 측정하지 않은 나머지
+  };
+
+  /// @brief 프레임마다의 시간을 고정 크기 링에 남기고 백분위/히치를 낸다
+  ///
+  /// util::FPS 는 1초 평균이라 한 프레임짜리 멈춤이 보이지 않는다.
+  /// Engine::Update 가 단계(update/draw/swap)마다 AddPhaseTime 을 부르고, 다음 프레임 시작에 EndFrame 으로
+  /// 프레임 전체 시간과 함께 한 칸을 채운다. 링이 차면 가장 오래된 프레임을 덮어쓴다 (기록 중 할당 없음).
+  class FrameStats
+  {
+	public:
+	static constexpr std::size_t CAPACITY			 = 1024; // 60Hz 로 약 17초
+	static constexpr std::size_t HISTOGRAM_BUCKETS	 = 40;	 // 1ms 씩, 마지막 칸은 그 이상 전부
+	static constexpr double		 HISTOGRAM_BUCKET_MS = 1.0;
+	static constexpr double		 HITCH_FACTOR		 = 2.0;
+	static constexpr double		 BUDGET_SLACK		 = 1.1; // vsync 흔들림 (16.7ms 가 16.9ms 로 재지는 것) 은 예산 초과로 치지 않는다
+
+	enum class Phase
+	{
+	  Update,
+	  Draw,
+	  Swap,
+	  Count
+	};
+
+	struct Sample
+	{
+	  float total_ms = 0.0f;
+	  float phase_ms[static_cast<std::size_t>(Phase::Count)]{};
+	};
+
+	/// 지금 프레임의 단계 시간을 더한다 (같은 단계를 여러 번 불러도 된다)
+	void AddPhaseTime(Phase phase, double seconds);
+
+	/// 직전 프레임을 delta_seconds 길이로 확정하고 쌓아 둔 단계 시간과 함께 링에 넣는다
+	void EndFrame(double delta_seconds);
+
+	/// 최근 frames 개 (0 이면 링 전체) 의 통계
+	FrameTimeSummary Summarize(std::size_t frames = 0) const;
+
+	/// 최근 frames 개의 프레임 시간 분포 — 칸 i 는 [i, i+1) ms
+	std::array<float, HISTOGRAM_BUCKETS> Histogram(std::size_t frames = 0) const;
+
+	/// 오래된 것부터 i 번째 프레임 (i < GetCount())
+	const Sample& GetSample(std::size_t i) const;
+	std::size_t	  GetCount() const;
+	std::uint64_t GetTotalFrames() const;
+
+	/// 히치 판정에 쓰는 프레임 예산 (기본 60Hz)
+	void   SetFrameBudget(double milliseconds);
+	double GetFrameBudget() const;
+
+	void Clear();
+
+	/// 링의 프레임들을 frame,total_ms,update_ms,draw_ms,swap_ms 줄로 쓰고 끝에 요약을 # 주석 줄로 붙인다
+	bool WriteCsv(const std::string& path) const;
+
+	private:
+	std::array<Sample, CAPACITY> sampleRing{};
+	std::size_t					 head		 = 0; // 다음에 쓸 칸
+	std::size_t					 count		 = 0;
+	std::uint64_t				 totalFrames = 0;
+	float						 pending[static_cast<std::size_t>(Phase::Count)]{};
+	double						 budgetMs = 1000.0 / 60.0;
+	mutable std::array<float, CAPACITY> scratch{}; // Summarize 정렬용 (매 프레임 불러도 할당하지 않게)
+  };
+}
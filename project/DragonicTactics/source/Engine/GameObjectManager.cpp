@@ -8,6 +8,7 @@
  */
 #include "GameObjectManager.h"
 #include "Logger.h"
+#include "Profiler.h"
 
 void CS230::GameObjectManager::Add(std::unique_ptr<GameObject> object)
 {
@@ -17,10 +18,12 @@ void CS230::GameObjectManager::Add(std::unique_ptr<GameObject> object)
 void CS230::GameObjectManager::Unload()
 {
   objects.clear();
+  destroyed.clear();
 }
 
 void CS230::GameObjectManager::UpdateAll(double dt)
 {
+  PROFILE_SCOPE("GameObjectManager::UpdateAll");
   // std::vector<GameObject*> destroy_objects;
   // for (GameObject* object : objects)
   // {
@@ -36,21 +39,19 @@ void CS230::GameObjectManager::UpdateAll(double dt)
   // 	delete destroy_object;
   // }
 
-  std::vector<std::list<std::unique_ptr<GameObject>>::iterator> destroy_iterators;
+  // 지난 프레임에 파괴된 오브젝트는 그 뒤의 DispatchDeferred 까지 끝났으니 이제 해제한다
+  destroyed.clear();
 
-  for (auto it = objects.begin(); it != objects.end(); ++it)
+  for (auto it = objects.begin(); it != objects.end();)
   {
-	(*it)->Update(dt);
-	if ((*it)->Destroyed())
+	const auto current = it++;
+	(*current)->Update(dt);
+	if ((*current)->Destroyed())
 	{
-	  destroy_iterators.push_back(it);
+	  // 같은 프레임에 발행된 이벤트가 아직 포인터를 들고 있으므로 목록에서만 뺀다
+	  destroyed.splice(destroyed.end(), objects, current);
 	}
   }
-
-  for (auto it : destroy_iterators)
-  {
-	objects.erase(it);
-  }
 }
 
 void CS230::GameObjectManager::SortForDraw()
@@ -60,6 +61,7 @@ void CS230::GameObjectManager::SortForDraw()
 
 void CS230::GameObjectManager::DrawAll(Math::TransformationMatrix camera_matrix)
 {
+  PROFILE_SCOPE("GameObjectManager::DrawAll");
   for (auto& object : objects)
   {
 	object->Draw(camera_matrix);
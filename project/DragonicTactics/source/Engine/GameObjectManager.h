@@ -25,6 +25,8 @@ public:
 	void Add(std::unique_ptr<GameObject> object);
 	void Unload();
 
+	/// Destroyed() 가 된 오브젝트는 목록에서 빼지만 해제는 다음 UpdateAll 시작까지 미룬다.
+	/// 그 사이 DispatchDeferred 로 전달되는 이벤트가 이번 프레임에 죽은 오브젝트를 가리켜도 유효하다
 	void UpdateAll(double dt);
 	void SortForDraw();
 	void DrawAll(Math::TransformationMatrix camera_matrix);
@@ -40,5 +42,6 @@ public:
 
 private:
 	std::list<std::unique_ptr<GameObject>> objects;
+	std::list<std::unique_ptr<GameObject>> destroyed; // 지난 UpdateAll 에서 파괴된 것 — 다음 UpdateAll 에서 해제
   };
 }
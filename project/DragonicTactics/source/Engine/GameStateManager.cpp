@@ -8,8 +8,10 @@
  * \par CS200 Computer Graphics I
  * \copyright DigiPen Institute of Technology
  */
+#include "AllocationTracker.h"
 #include "GameObjectManager.h"
 #include "GameStateManager.h"
+#include "Profiler.h"
 
 namespace CS230
 {
@@ -25,6 +27,7 @@ namespace CS230
 
   void GameStateManager::Update(double dt)
   {
+	PROFILE_SCOPE("GameStateManager::Update");
 	mToClear.clear();
 	mGameStateStack.back()->Update(dt);
 	if (!mGameStateStack.empty())
@@ -39,6 +42,8 @@ namespace CS230
 
   void GameStateManager::Draw()
   {
+	PROFILE_SCOPE("GameStateManager::Draw");
+	ALLOCATION_SCOPE(Renderer);
 	for (auto& game_state : mGameStateStack)
 	{
 	  game_state->Draw();
@@ -15,7 +15,6 @@
 #include "Engine.h"
 #include "Input.h"
 #include "Logger.h"
-#include "Window.h"
 
 namespace CS230
 {
@@ -116,9 +115,8 @@ namespace CS230
 	current_mouse_state[static_cast<std::size_t>(button)] = false;
   }
 
-  void Input::SetMousePos(Math::vec2 pos)
+  void Input::SetMousePos(Math::vec2 pos, int window_height)
   {
-	int window_height = Engine::GetWindow().GetSize().y;
 	mouse_position.x  = pos.x;
 	mouse_position.y  = window_height - pos.y;
   }
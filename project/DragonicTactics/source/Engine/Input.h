@@ -98,7 +98,8 @@ public:
 
 	void SetMousePressed(int button);
 	void SetMouseReleased(int button);
-	void SetMousePos(Math::vec2 pos);
+	// pos 는 창 좌표 (위가 0) — 아래가 0 이 되도록 window_height 로 뒤집어 저장한다
+	void SetMousePos(Math::vec2 pos, int window_height);
 	void SetMouseScroll(double offset);
 
 private:
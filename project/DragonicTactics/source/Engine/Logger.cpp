@@ -12,63 +12,399 @@
 
 #include "Logger.h"
 
+#include "BinaryLog.h"
+
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !defined(__EMSCRIPTEN__)
+#define LOGGER_ASYNC 1
+#else
+#define LOGGER_ASYNC 0 // 웹 빌드는 스레드가 없다
+#endif
+
 namespace CS230
 {
-  Logger::Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point _start_time) : min_level(severity), out_stream("Trace.log"), start_time(_start_time)
+  namespace
+  {
+	const char* SeverityName(Logger::Severity severity)
+	{
+	  switch (severity)
+	  {
+		case Logger::Severity::Verbose: return "Verbose";
+		case Logger::Severity::Debug: return "Debug";
+		case Logger::Severity::Event: return "Event";
+		case Logger::Severity::Error:
+		default: return "Error";
+	  }
+	}
+
+	// 링 버퍼: 64바이트 슬롯 4096개. 레코드 하나가 연속된 슬롯 여러 개를 쓸 수 있다 (긴 문자열 인자)
+	constexpr std::uint64_t SLOT_COUNT	 = 4096;
+	constexpr std::uint64_t SLOT_MASK	 = SLOT_COUNT - 1;
+	constexpr std::size_t	SLOT_PAYLOAD = 56;
+
+	/// sequence == 위치 이면 비어 있음, 위치 + 1 이면 채워짐 (Vyukov bounded queue)
+	struct alignas(64) Slot
+	{
+	  std::atomic<std::uint64_t> sequence{ 0 };
+	  std::uint8_t				 payload[SLOT_PAYLOAD];
+	};
+
+	struct RecordHeader
+	{
+	  std::int64_t	nanoseconds; // start_time 부터
+	  const char*	format;
+	  std::uint16_t argument_bytes;
+	  std::uint8_t	severity;
+	  std::uint8_t	argument_count;
+	  std::uint8_t	slot_count;
+	};
+
+	template <typename T>
+	T ReadValue(const std::uint8_t*& pos)
+	{
+	  T value;
+	  std::memcpy(&value, pos, sizeof(T));
+	  pos += sizeof(T);
+	  return value;
+	}
+
+	/// 형식 문자열의 "{}" 를 인자로 채운다. 인자가 모자라면 "{}" 를 그대로 둔다
+	void AppendFormatted(std::string& out, const char* format, const std::uint8_t* arguments, std::size_t size)
+	{
+	  const std::uint8_t* pos = arguments;
+	  const std::uint8_t* end = arguments + size;
+	  char				  number[32];
+	  for (const char* c = format; *c != '\0'; ++c)
+	  {
+		if (c[0] != '{' || c[1] != '}' || pos >= end)
+		{
+		  out.push_back(*c);
+		  continue;
+		}
+		++c;
+		switch (static_cast<Logger::ArgumentType>(*pos++))
+		{
+		  case Logger::ArgumentType::Int: out += std::to_string(ReadValue<long long>(pos)); break;
+		  case Logger::ArgumentType::UInt: out += std::to_string(ReadValue<unsigned long long>(pos)); break;
+		  case Logger::ArgumentType::Double:
+			std::snprintf(number, sizeof(number), "%g", ReadValue<double>(pos));
+			out += number;
+			break;
+		  case Logger::ArgumentType::Bool: out += ReadValue<bool>(pos) ? "true" : "false"; break;
+		  case Logger::ArgumentType::Char: out.push_back(ReadValue<char>(pos)); break;
+		  case Logger::ArgumentType::String:
+		  {
+			const std::uint16_t length = ReadValue<std::uint16_t>(pos);
+			out.append(reinterpret_cast<const char*>(pos), length);
+			pos += length;
+			break;
+		  }
+		}
+	  }
+	}
+  }
+
+  /// 링 버퍼와 로거 스레드
+  class Logger::Backend
   {
-	if (use_console == true)
+	public:
+	Backend(bool use_console) : file("Trace.log")
+	{
+	  if (use_console == true)
+		file.basic_ios<char>::rdbuf(std::cout.rdbuf());
+#if LOGGER_ASYNC
+	  slots = std::make_unique<Slot[]>(SLOT_COUNT);
+	  for (std::uint64_t i = 0; i < SLOT_COUNT; ++i)
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	  writer = std::thread(&Backend::WriterLoop, this);
+#endif
+	}
+
+	~Backend()
+	{
+#if LOGGER_ASYNC
+	  stop.store(true, std::memory_order_release);
+	  writer.join();
+#endif
+	}
+
+	bool OpenBinary(const std::string& path_prefix, std::size_t segment_bytes, int max_segments)
+	{
+	  Flush();
+	  auto next = std::make_unique<BinaryLogWriter>();
+	  if (!next->Open(path_prefix, segment_bytes, max_segments))
+		return false;
+	  const std::lock_guard lock(output_mutex);
+	  file.flush();
+	  binary = std::move(next);
+	  return true;
+	}
+
+	void CloseBinary()
+	{
+	  Flush();
+	  const std::lock_guard lock(output_mutex);
+	  binary.reset();
+	}
+
+	std::uint64_t GetBinaryBytes()
+	{
+	  const std::lock_guard lock(output_mutex);
+	  return binary != nullptr ? binary->GetBytesWritten() : 0;
+	}
+
+	/// 레코드를 넣고 그 레코드 끝 위치를 돌려준다 (버렸으면 0). must_deliver 면 가득 찼을 때 자리가 날 때까지 기다린다
+	std::uint64_t Push(const RecordHeader& header, const std::uint8_t* arguments, bool must_deliver)
+	{
+#if LOGGER_ASYNC
+	  const std::size_t record_bytes = sizeof(RecordHeader) + header.argument_bytes;
+	  const std::uint64_t count		   = (record_bytes + SLOT_PAYLOAD - 1) / SLOT_PAYLOAD;
+
+	  // 마지막 슬롯이 비었으면 앞 슬롯도 비어 있다 (로거 스레드는 순서대로 비운다)
+	  std::uint64_t pos = head.load(std::memory_order_relaxed);
+	  for (;;)
+	  {
+		const std::uint64_t last = pos + count - 1;
+		const std::int64_t	diff = static_cast<std::int64_t>(slots[last & SLOT_MASK].sequence.load(std::memory_order_acquire) - last);
+		if (diff == 0)
+		{
+		  if (head.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+			break;
+		}
+		else if (diff < 0)
+		{
+		  if (!must_deliver)
+		  {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return 0;
+		  }
+		  std::this_thread::yield();
+		  pos = head.load(std::memory_order_relaxed);
+		}
+		else
+		{
+		  pos = head.load(std::memory_order_relaxed);
+		}
+	  }
+
+	  // 헤더 + 인자 바이트를 슬롯들에 이어서 쓴 뒤 슬롯마다 채워짐을 알린다
+	  std::size_t written_bytes = 0;
+	  for (std::uint64_t i = 0; i < count; ++i)
+	  {
+		Slot&		slot = slots[(pos + i) & SLOT_MASK];
+		std::size_t used = 0;
+		while (used < SLOT_PAYLOAD && written_bytes < record_bytes)
+		{
+		  const std::size_t chunk = std::min(SLOT_PAYLOAD - used, written_bytes < sizeof(RecordHeader) ? sizeof(RecordHeader) - written_bytes : record_bytes - written_bytes);
+		  const std::uint8_t* source = written_bytes < sizeof(RecordHeader) ? reinterpret_cast<const std::uint8_t*>(&header) + written_bytes
+																			  : arguments + (written_bytes - sizeof(RecordHeader));
+		  std::memcpy(slot.payload + used, source, chunk);
+		  used += chunk;
+		  written_bytes += chunk;
+		}
+		slot.sequence.store(pos + i + 1, std::memory_order_release);
+	  }
+	  return pos + count;
+#else
+	  (void)must_deliver;
+	  const std::lock_guard lock(output_mutex);
+	  Write(header, arguments);
+	  file.flush();
+	  return 0;
+#endif
+	}
+
+	/// position 까지의 레코드가 쓰일 때까지 기다린다
+	void WaitWritten([[maybe_unused]] std::uint64_t position)
+	{
+#if LOGGER_ASYNC
+	  while (written.load(std::memory_order_acquire) < position)
+		std::this_thread::yield();
+#endif
+	}
+
+	void Flush()
+	{
+#if LOGGER_ASYNC
+	  WaitWritten(head.load(std::memory_order_acquire));
+#else
+	  file.flush();
+#endif
+	}
+
+	std::uint64_t GetDropped() const
+	{
+	  return dropped.load(std::memory_order_relaxed);
+	}
+
+	private:
+	void Write(const RecordHeader& header, const std::uint8_t* arguments)
+	{
+	  if (binary != nullptr)
+	  {
+		binary->WriteMessage(header.nanoseconds, static_cast<Logger::Severity>(header.severity), header.format, arguments, header.argument_bytes);
+		return;
+	  }
+	  char stamp[32];
+	  std::snprintf(stamp, sizeof(stamp), "[%.4f]\t", static_cast<double>(header.nanoseconds) * 1e-9);
+	  line = stamp;
+	  line += SeverityName(static_cast<Logger::Severity>(header.severity));
+	  line += '\t';
+	  AppendFormatted(line, header.format, arguments, header.argument_bytes);
+	  line += '\n';
+	  file << line;
+	}
+
+#if LOGGER_ASYNC
+	/// 레코드 하나를 꺼내 쓴다. 다음 레코드가 아직 없으면 false
+	bool WriteOne()
+	{
+	  if (slots[tail & SLOT_MASK].sequence.load(std::memory_order_acquire) != tail + 1)
+		return false;
+
+	  RecordHeader header;
+	  std::memcpy(&header, slots[tail & SLOT_MASK].payload, sizeof(RecordHeader));
+	  record.resize(header.slot_count * SLOT_PAYLOAD);
+	  for (std::uint64_t i = 0; i < header.slot_count; ++i)
+	  {
+		Slot& slot = slots[(tail + i) & SLOT_MASK];
+		while (slot.sequence.load(std::memory_order_acquire) != tail + i + 1)
+		  std::this_thread::yield(); // 같은 레코드의 뒷 슬롯을 생산자가 아직 쓰는 중
+		std::memcpy(record.data() + i * SLOT_PAYLOAD, slot.payload, SLOT_PAYLOAD);
+		slot.sequence.store(tail + i + SLOT_COUNT, std::memory_order_release);
+	  }
+	  tail += header.slot_count;
+	  last_nanoseconds = header.nanoseconds;
+	  Write(header, record.data() + sizeof(RecordHeader));
+	  return true;
+	}
+
+	void WriterLoop()
 	{
-	  out_stream.basic_ios<char>::rdbuf(std::cout.rdbuf());
-	  ;
+	  std::uint64_t reported_drops = 0;
+	  for (;;)
+	  {
+		bool any = false;
+		{
+		  const std::lock_guard lock(output_mutex);
+		  while (WriteOne())
+			any = true;
+
+		  const std::uint64_t drops = dropped.load(std::memory_order_relaxed);
+		  if (drops != reported_drops)
+		  {
+			if (binary != nullptr)
+			  binary->WriteDropped(last_nanoseconds, drops - reported_drops);
+			else
+			  file << "[-]\tError\tLogger: " << drops - reported_drops << " messages dropped (ring buffer full)\n";
+			reported_drops = drops;
+			any			   = true;
+		  }
+		  if (any && binary == nullptr)
+			file.flush();
+		}
+		if (any)
+		{
+		  written.store(tail, std::memory_order_release);
+		  continue;
+		}
+		if (stop.load(std::memory_order_acquire) && tail == head.load(std::memory_order_acquire))
+		  break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	  }
 	}
+
+	std::unique_ptr<Slot[]>				slots;
+	alignas(64) std::atomic<std::uint64_t> head{ 0 };	 // 생산자가 예약한 끝 위치
+	alignas(64) std::atomic<std::uint64_t> written{ 0 }; // 파일에 쓴 끝 위치
+	std::atomic<std::uint64_t>			   dropped{ 0 };
+	std::atomic<bool>					   stop{ false };
+	std::uint64_t						   tail				= 0; // 로거 스레드 전용
+	std::int64_t						   last_nanoseconds = 0;
+	std::vector<std::uint8_t>			   record;
+	std::thread							   writer;
+#else
+	std::atomic<std::uint64_t> dropped{ 0 };
+#endif
+	std::mutex						 output_mutex; // 로거 스레드와 출력 전환(OpenBinary/CloseBinary) 사이
+	std::ofstream					 file;
+	std::unique_ptr<BinaryLogWriter> binary; // 있으면 Trace.log 대신 여기로
+	std::string						 line;
+  };
+
+  Logger::Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point _start_time)
+	  : min_level(static_cast<int>(severity)), start_time(_start_time), backend(std::make_unique<Backend>(use_console))
+  {
   }
 
+  Logger::~Logger() = default;
+
   void Logger::LogError(std::string text)
   {
-	log(Severity::Error, text);
+	LogFormat(Severity::Error, "{}", text);
   }
 
   void Logger::LogEvent(std::string text)
   {
-	log(Severity::Event, text);
+	LogFormat(Severity::Event, "{}", text);
   }
 
   void Logger::LogDebug(std::string text)
   {
-	log(Severity::Debug, text);
+	LogFormat(Severity::Debug, "{}", text);
   }
 
   void Logger::LogVerbose(std::string text)
   {
-	log(Severity::Verbose, text);
+	LogFormat(Severity::Verbose, "{}", text);
   }
 
-  void Logger::log(Severity severity, std::string message)
+  void Logger::Submit(Severity severity, const char* format, const ArgumentWriter& arguments)
   {
-	std::map<CS230::Logger::Severity, std::string> get_error_level = {
-	  { CS230::Logger::Severity::Verbose, "Verbose" },
-	   {	 CS230::Logger::Severity::Debug,	 "Debug" },
-		{	  CS230::Logger::Severity::Event,	  "Event" },
-		 {   CS230::Logger::Severity::Error,   "Error" }
-	};
-	std::string answer = get_error_level[severity] + "\t" + message;
-	//===========map_version
+	RecordHeader header;
+	header.nanoseconds	  = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now() - start_time).count();
+	header.format		  = format;
+	header.argument_bytes = static_cast<std::uint16_t>(arguments.size);
+	header.severity		  = static_cast<std::uint8_t>(severity);
+	header.argument_count = arguments.count;
+	header.slot_count	  = static_cast<std::uint8_t>((sizeof(RecordHeader) + arguments.size + SLOT_PAYLOAD - 1) / SLOT_PAYLOAD);
 
+	// 링이 가득 차면 Debug/Verbose 는 버리고 (게임 스레드를 세우지 않는다) Event/Error 는 자리가 날 때까지 기다린다.
+	// 에러는 바로 뒤에 크래시가 나도 남도록 파일에 쓰일 때까지 기다린다
+	const std::uint64_t end = backend->Push(header, arguments.bytes, severity >= Severity::Event);
+	if (severity == Severity::Error)
+	  backend->WaitWritten(end);
+  }
 
-	if (int(CS230::Logger::min_level) <= int(severity))
-	{
-	  out_stream.precision(4);
-	  out_stream << '[' << std::fixed << seconds_since_start() << "]\t";
-	  out_stream << answer << "\n";
-	}
-	return;
+  void Logger::Flush()
+  {
+	backend->Flush();
+  }
+
+  std::uint64_t Logger::GetDroppedCount() const
+  {
+	return backend->GetDropped();
+  }
+
+  bool Logger::OpenBinaryLog(const std::string& path_prefix, std::size_t segment_bytes, int max_segments)
+  {
+	return backend->OpenBinary(path_prefix, segment_bytes, max_segments);
+  }
+
+  void Logger::CloseBinaryLog()
+  {
+	backend->CloseBinary();
   }
 
-  double Logger::seconds_since_start()
+  std::uint64_t Logger::GetBinaryBytesWritten() const
   {
-	return std::chrono::duration<double>(std::chrono::system_clock::now() - start_time).count();
+	return backend->GetBinaryBytes();
   }
 
   // note the proper way to redirect the rdbuf is `stream.basic_ios<char>::rdbuf(other_stream.rdbuf());`
-  // note that we don't need a destructor ~Logger() if all we are doing is closing the streams. The std stream classes impl Rule of 5 and will auto flush & close themselves
 }
@@ -9,13 +9,25 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
-#include <map>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace CS230
 {
+  /// @brief 로그 메시지
+  ///
+  /// 호출한 스레드는 고정 크기 레코드(시각, 레벨, 형식 문자열, 인자)를 lock-free 링 버퍼에 넣기만 하고,
+  /// 문자열 조립과 파일 쓰기는 로거 스레드가 한다. min_level 아래의 로그는 인자를 건드리기 전에 버린다.
+  /// 웹 빌드는 스레드가 없으므로 호출한 자리에서 바로 쓴다.
   class Logger
   {
 public:
@@ -26,7 +38,23 @@ public:
 	  Event,   // General event, like key press or state change
 	  Error	   // Errors, such as file load errors
 	};
+
+	/// 형식 문자열 — 레코드에는 포인터만 담기므로 문자열 리터럴만 받는다 ("{}" 자리에 인자가 순서대로 들어간다)
+	struct Format
+	{
+	  template <std::size_t N>
+	  consteval Format(const char (&literal)[N]) : text(literal)
+	  {
+	  }
+
+	  const char* text;
+	};
+
 	Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point start_time);
+	~Logger();
+
+	Logger(const Logger&)			 = delete;
+	Logger& operator=(const Logger&) = delete;
 
 	void LogError(std::string text);
 
@@ -36,11 +64,165 @@ public:
 
 	void LogVerbose(std::string text);
 
+	/// 꺼진 레벨이면 인자를 문자열로 만들지 않는다 — 매 행동마다 부르는 곳은 이쪽을 쓴다
+	///   Engine::GetLogger().LogDebug("Path found: {} steps, {} expanded", path.size(), expanded);
+	/// 인자: 정수, 실수, bool, char, 문자열 (const char*, std::string, std::string_view)
+	template <typename Arg, typename... Args>
+	void LogError(Format format, const Arg& arg, const Args&... args)
+	{
+	  LogFormat(Severity::Error, format, arg, args...);
+	}
+
+	template <typename Arg, typename... Args>
+	void LogEvent(Format format, const Arg& arg, const Args&... args)
+	{
+	  LogFormat(Severity::Event, format, arg, args...);
+	}
+
+	template <typename Arg, typename... Args>
+	void LogDebug(Format format, const Arg& arg, const Args&... args)
+	{
+	  LogFormat(Severity::Debug, format, arg, args...);
+	}
+
+	template <typename Arg, typename... Args>
+	void LogVerbose(Format format, const Arg& arg, const Args&... args)
+	{
+	  LogFormat(Severity::Verbose, format, arg, args...);
+	}
+
+	bool IsEnabled(Severity severity) const
+	{
+	  return static_cast<int>(severity) >= min_level.load(std::memory_order_relaxed);
+	}
+
+	// Messages below this level are dropped (headless tools raise it to Error)
+	void SetMinLevel(Severity severity)
+	{
+	  min_level.store(static_cast<int>(severity), std::memory_order_relaxed);
+	}
+
+	/// 지금까지 넣은 로그가 파일에 쓰일 때까지 기다린다
+	void Flush();
+
+	/// 이후 로그를 Trace.log 대신 바이너리 세그먼트(path_prefix.0000.dtl ...) 로 쓴다 — 긴 AI 대전용.
+	/// 형식 문자열은 세그먼트마다 한 번만 쓰고 메시지는 템플릿 번호 + 인자만 남는다. 읽기는 dragonic_logdecode
+	bool OpenBinaryLog(const std::string& path_prefix, std::size_t segment_bytes = 8 * 1024 * 1024, int max_segments = 8);
+	/// 바이너리 세그먼트를 닫고 Trace.log 로 돌아간다
+	void CloseBinaryLog();
+	std::uint64_t GetBinaryBytesWritten() const;
+
+	/// 링 버퍼가 가득 차서 버린 Debug/Verbose 로그 수 (Event/Error 는 버리지 않고 자리가 날 때까지 기다린다)
+	std::uint64_t GetDroppedCount() const;
+
+	/// 레코드 하나에 담을 수 있는 인자 바이트 — 넘는 문자열은 잘린다
+	static constexpr std::size_t MAX_ARGUMENT_BYTES = 2048;
+
+	/// 인자 인코딩: [종류 1바이트][값] — 로거 스레드가 형식 문자열에 맞춰 다시 풀어 쓴다
+	enum class ArgumentType : std::uint8_t
+	{
+	  Int,
+	  UInt,
+	  Double,
+	  Bool,
+	  Char,
+	  String // [길이 u16][바이트]
+	};
+
 private:
-	Severity							  min_level;
-	std::ofstream						  out_stream;
+	class ArgumentWriter
+	{
+	  public:
+	  void Write(long long value)
+	  {
+		Put(ArgumentType::Int, &value, sizeof(value));
+	  }
+
+	  void Write(unsigned long long value)
+	  {
+		Put(ArgumentType::UInt, &value, sizeof(value));
+	  }
+
+	  void Write(double value)
+	  {
+		Put(ArgumentType::Double, &value, sizeof(value));
+	  }
+
+	  void Write(bool value)
+	  {
+		Put(ArgumentType::Bool, &value, sizeof(value));
+	  }
+
+	  void Write(char value)
+	  {
+		Put(ArgumentType::Char, &value, sizeof(value));
+	  }
+
+	  void Write(std::string_view text)
+	  {
+		if (size + 1 + sizeof(std::uint16_t) > MAX_ARGUMENT_BYTES)
+		  return;
+		const std::uint16_t length = static_cast<std::uint16_t>(std::min(text.size(), MAX_ARGUMENT_BYTES - 1 - sizeof(std::uint16_t) - size));
+		Put(ArgumentType::String, &length, sizeof(length));
+		std::memcpy(bytes + size, text.data(), length);
+		size += length;
+	  }
+
+	  template <typename T>
+	  void Add(const T& value)
+	  {
+		if constexpr (std::is_same_v<T, bool>)
+		  Write(value);
+		else if constexpr (std::is_same_v<T, char>)
+		  Write(value);
+		else if constexpr (std::is_enum_v<T>)
+		  Write(static_cast<long long>(value));
+		else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+		  Write(static_cast<long long>(value));
+		else if constexpr (std::is_integral_v<T>)
+		  Write(static_cast<unsigned long long>(value));
+		else if constexpr (std::is_floating_point_v<T>)
+		  Write(static_cast<double>(value));
+		else if constexpr (std::is_array_v<T>)
+		  Write(std::string_view(value));
+		else if constexpr (std::is_convertible_v<T, const char*>)
+		  Write(std::string_view(value != nullptr ? static_cast<const char*>(value) : "(null)"));
+		else
+		  Write(std::string_view(value));
+		++count;
+	  }
+
+	  std::uint8_t bytes[MAX_ARGUMENT_BYTES];
+	  std::size_t  size	 = 0;
+	  std::uint8_t count = 0;
+
+	  private:
+	  void Put(ArgumentType type, const void* value, std::size_t value_size)
+	  {
+		if (size + 1 + value_size > MAX_ARGUMENT_BYTES)
+		  return;
+		bytes[size++] = static_cast<std::uint8_t>(type);
+		std::memcpy(bytes + size, value, value_size);
+		size += value_size;
+	  }
+	};
+
+	template <typename... Args>
+	void LogFormat(Severity severity, Format format, const Args&... args)
+	{
+	  if (!IsEnabled(severity))
+		return;
+	  ArgumentWriter writer;
+	  (writer.Add(args), ...);
+	  Submit(severity, format.text, writer);
+	}
+
+	void Submit(Severity severity, const char* format, const ArgumentWriter& arguments);
+
+	class Backend;
+
+	std::atomic<int>					  min_level;
 	std::chrono::system_clock::time_point start_time;
-	void								  log(Severity severity, std::string message);
-	double								  seconds_since_start();
+	std::unique_ptr<Backend>			  backend;
   };
 }
@@ -0,0 +1,63 @@
+/*
+Must Read!!!!!!!!!!!!!!!!!!!
+
+OGG - BGM
+Wav - SFX
+*/
+
+
+#pragma once
+
+#include "SoundManager.h"
+
+#include <al.h>
+#include <alc.h>
+#include <string>
+#include <map>
+
+// OpenAL 장치로 소리를 내는 SoundManager — Engine::Start 가 만든다 (게임 실행 파일에만 링크)
+class OpenALSoundManager final : public SoundManager
+{
+public:
+    OpenALSoundManager()           = default;
+    ~OpenALSoundManager() override = default;
+
+    void Init() override;
+    void Shutdown() override;
+    void LoadBGM(const std::string& ogg_path) override;
+    void PlayBGM(const std::string& ogg_path, bool loop) override;
+    void PauseBGM() override;
+    void ResumeBGM() override;
+    void StopBGM() override;
+    void SetBGMLoop(bool loop) override;
+    void SetBGMVolume(float volume) override;
+    void LoadSFX(const std::string& wav_path) override;
+    void PlaySFX(const std::string& wav_path) override;
+    void StopAllSFX() override;
+    void SetSFXVolume(float volume) override;
+
+    float GetBGMVolume() const override;
+    float GetSFXVolume() const override;
+    bool  IsBGMPlaying() const override;
+    bool  IsBGMPaused() const override;
+private:
+    ALCdevice*  al_device_  = nullptr;
+    ALCcontext* al_context_ = nullptr;
+
+    ALuint bgm_source_ = 0;
+    bool   bgm_loaded_ = false;
+
+    std::map<std::string, ALuint> bgm_cache_;
+    std::map<std::string, ALuint> sfx_cache_;
+
+    static constexpr int kSfxSourcePoolSize = 8;
+    ALuint               sfx_sources_[kSfxSourcePoolSize]{};
+
+    float bgm_volume_ = 1.0f;
+    float sfx_volume_ = 1.0f;
+
+    bool   LoadOGGToBuffer(const std::string& path, ALuint& out_buffer);
+    bool   LoadWAVToBuffer(const std::string& path, ALuint& out_buffer);
+    ALuint GetFreeSFXSource();
+    
+};
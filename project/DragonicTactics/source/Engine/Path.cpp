@@ -33,6 +33,12 @@ namespace
 
 	return std::nullopt;
   }
+
+  std::filesystem::path& fallback_directory()
+  {
+	static std::filesystem::path directory;
+	return directory;
+  }
 }
 
 namespace assets
@@ -47,16 +53,22 @@ namespace assets
 	  if (result)
 		return result.value();
 	  // try from the exe path rather than the current working directory
-	  const auto base_path = SDL_GetBasePath();
-	  result			   = try_get_asset_path(base_path);
-	  SDL_free(base_path);
-	  if (result)
-		return result.value();
+	  if (!fallback_directory().empty())
+	  {
+		result = try_get_asset_path(fallback_directory());
+		if (result)
+		  return result.value();
+	  }
 	  throw std::runtime_error{ "Failed to find Assets folder in parent folders" };
 	}();
 	return assets_folder;
   }
 
+  void set_fallback_directory(const std::filesystem::path& directory)
+  {
+	fallback_directory() = directory;
+  }
+
   std::filesystem::path locate_asset(const std::filesystem::path& asset_path)
   {
 	auto asset_filepath = asset_path;
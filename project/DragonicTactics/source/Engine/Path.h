@@ -13,5 +13,8 @@ namespace assets
 {
 
   std::filesystem::path get_base_path();
+  // 작업 디렉터리 위쪽에 Assets 가 없을 때 찾아볼 폴더 — 창을 띄우는 쪽(Engine::Start)이 실행 파일 폴더를 넣는다.
+  // get_base_path() 는 결과를 기억하므로 첫 호출 전에 불러야 한다
+  void					set_fallback_directory(const std::filesystem::path& directory);
   std::filesystem::path locate_asset(const std::filesystem::path& asset_path);
 }
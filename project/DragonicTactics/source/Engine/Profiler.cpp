@@ -0,0 +1,301 @@
+#include "pch.h"
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "Profiler.h"
+
+#include "Engine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace CS230
+{
+  namespace
+  {
+	std::atomic<std::uint64_t> g_next_profiler_id{ 1 };
+
+	std::int64_t SteadyNanoseconds()
+	{
+	  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	struct EventCopy
+	{
+	  const char*  name;
+	  std::int64_t start;
+	  std::int64_t end;
+	  int		   depth;
+	};
+
+	void WriteJsonString(std::ostream& out, const char* text)
+	{
+	  out << '"';
+	  for (const char* c = text; *c != '\0'; ++c)
+	  {
+		if (*c == '"' || *c == '\\')
+		  out << '\\' << *c;
+		else if (static_cast<unsigned char>(*c) < 0x20)
+		  out << ' ';
+		else
+		  out << *c;
+	  }
+	  out << '"';
+	}
+  }
+
+  /// 스레드 하나의 이벤트 링 — 그 스레드만 쓰고, 요약/내보내기는 다른 스레드에서 읽을 수 있다.
+  /// 필드를 relaxed atomic 으로 두고 읽은 뒤 head 를 다시 봐서 그 사이 덮어쓰인 칸은 버린다
+  struct Profiler::ThreadBuffer
+  {
+	struct Event
+	{
+	  std::atomic<const char*>  name{ nullptr };
+	  std::atomic<std::int64_t> start{ 0 };
+	  std::atomic<std::int64_t> end{ 0 };
+	  std::atomic<int>			depth{ 0 };
+	};
+
+	std::unique_ptr<Event[]>   events = std::make_unique<Event[]>(EVENTS_PER_THREAD);
+	std::atomic<std::uint64_t> head{ 0 }; // 지금까지 쓴 이벤트 수
+	int						   depth = 0; // 소유 스레드 전용 (열린 스코프 수)
+	int						   tid	 = 0;
+	std::string				   name;
+
+	void Push(const char* event_name, std::int64_t start, std::int64_t end)
+	{
+	  const std::uint64_t index = head.load(std::memory_order_relaxed);
+	  Event&			  event = events[index & (EVENTS_PER_THREAD - 1)];
+	  event.name.store(event_name, std::memory_order_relaxed);
+	  event.start.store(start, std::memory_order_relaxed);
+	  event.end.store(end, std::memory_order_relaxed);
+	  event.depth.store(depth, std::memory_order_relaxed);
+	  head.store(index + 1, std::memory_order_release);
+	}
+
+	void CopyTo(std::vector<EventCopy>& out, std::int64_t since) const
+	{
+	  const std::uint64_t last	= head.load(std::memory_order_acquire);
+	  const std::uint64_t first = last > EVENTS_PER_THREAD ? last - EVENTS_PER_THREAD : 0;
+	  const std::size_t	  begin = out.size();
+	  for (std::uint64_t i = first; i < last; ++i)
+	  {
+		const Event& event = events[i & (EVENTS_PER_THREAD - 1)];
+		out.push_back({ event.name.load(std::memory_order_relaxed), event.start.load(std::memory_order_relaxed), event.end.load(std::memory_order_relaxed),
+						event.depth.load(std::memory_order_relaxed) });
+	  }
+
+	  // 복사하는 동안 소유 스레드가 앞쪽 칸을 덮어썼으면 그만큼 버린다
+	  const std::uint64_t now	   = head.load(std::memory_order_acquire);
+	  const std::uint64_t valid	   = now > EVENTS_PER_THREAD ? now - EVENTS_PER_THREAD : 0;
+	  const std::size_t	  overlap  = std::min(last, std::max(first, valid)) - first;
+	  out.erase(out.begin() + static_cast<std::ptrdiff_t>(begin), out.begin() + static_cast<std::ptrdiff_t>(begin + overlap));
+	  out.erase(std::remove_if(out.begin() + static_cast<std::ptrdiff_t>(begin), out.end(), [since](const EventCopy& e) { return e.start < since || e.name == nullptr; }), out.end());
+	}
+  };
+
+  Profiler::Profiler() : origin_(SteadyNanoseconds()), id_(g_next_profiler_id.fetch_add(1)), frame_starts_(FRAME_HISTORY, 0)
+  {
+  }
+
+  Profiler::~Profiler() = default;
+
+  Profiler::ThreadBuffer& Profiler::LocalBuffer()
+  {
+	thread_local ThreadBuffer* cached		= nullptr;
+	thread_local std::uint64_t cached_owner = 0;
+	if (cached_owner != id_)
+	{
+	  const std::lock_guard lock(buffers_mutex_);
+	  auto					buffer = std::make_unique<ThreadBuffer>();
+	  buffer->tid				   = static_cast<int>(buffers_.size()) + 1;
+	  buffer->name				   = "Thread " + std::to_string(buffer->tid);
+	  cached					   = buffer.get();
+	  cached_owner				   = id_;
+	  buffers_.push_back(std::move(buffer));
+	}
+	return *cached;
+  }
+
+  std::int64_t Profiler::Now() const
+  {
+	return SteadyNanoseconds() - origin_;
+  }
+
+  void Profiler::Record(const char* name, std::int64_t start, std::int64_t end)
+  {
+	LocalBuffer().Push(name, start, end);
+  }
+
+  int& Profiler::Depth()
+  {
+	return LocalBuffer().depth;
+  }
+
+  void Profiler::SetThreadName(const char* name)
+  {
+	ThreadBuffer&		  buffer = LocalBuffer();
+	const std::lock_guard lock(buffers_mutex_);
+	buffer.name = name;
+  }
+
+  void Profiler::Clear()
+  {
+	cleared_at_.store(Now(), std::memory_order_relaxed);
+  }
+
+  void Profiler::MarkFrame()
+  {
+	if (frame_thread_ == nullptr)
+	{
+	  frame_thread_ = &LocalBuffer();
+	  SetThreadName("Main");
+	}
+	frame_starts_[frame_count_ % FRAME_HISTORY] = Now();
+	++frame_count_;
+  }
+
+  Profiler::Summary Profiler::Summarize(int frames) const
+  {
+	Summary summary;
+	if (frame_thread_ == nullptr || frame_count_ < 2)
+	  return summary;
+
+	// 마지막 MarkFrame 은 아직 진행 중인 프레임의 시작 — 그 앞의 끝난 프레임들만 본다
+	const std::int64_t cleared	  = cleared_at_.load(std::memory_order_relaxed);
+	const std::uint64_t available = std::min<std::uint64_t>(frame_count_ - 1, FRAME_HISTORY - 1);
+	std::uint64_t		 count	  = std::min<std::uint64_t>(static_cast<std::uint64_t>(std::max(frames, 1)), available);
+	const std::int64_t	 end	  = frame_starts_[(frame_count_ - 1) % FRAME_HISTORY];
+	while (count > 0 && frame_starts_[(frame_count_ - 1 - count) % FRAME_HISTORY] < cleared)
+	  --count;
+	if (count == 0)
+	  return summary;
+	const std::int64_t begin = frame_starts_[(frame_count_ - 1 - count) % FRAME_HISTORY];
+
+	std::vector<EventCopy> events;
+	frame_thread_->CopyTo(events, begin);
+	events.erase(std::remove_if(events.begin(), events.end(), [end](const EventCopy& e) { return e.end > end; }), events.end());
+	std::sort(events.begin(), events.end(), [](const EventCopy& a, const EventCopy& b) { return a.start != b.start ? a.start < b.start : a.depth < b.depth; });
+
+	// 이름이 같은 형제 스코프를 합친 호출 트리 (0 = 가상의 뿌리)
+	struct Node
+	{
+	  const char*	   name		 = nullptr;
+	  std::int64_t	   total	 = 0;
+	  std::int64_t	   children_total = 0;
+	  long long		   calls	 = 0;
+	  std::vector<int> children;
+	};
+	std::vector<Node> nodes(1);
+	std::vector<int>  stack{ 0 };
+	for (const EventCopy& event : events)
+	{
+	  while (stack.size() > static_cast<std::size_t>(event.depth) + 1)
+		stack.pop_back();
+	  const int parent = stack.back();
+	  int		node   = -1;
+	  for (const int child : nodes[static_cast<std::size_t>(parent)].children)
+	  {
+		if (std::strcmp(nodes[static_cast<std::size_t>(child)].name, event.name) == 0)
+		  node = child;
+	  }
+	  if (node < 0)
+	  {
+		node = static_cast<int>(nodes.size());
+		nodes.push_back(Node{ event.name, 0, 0, 0, {} });
+		nodes[static_cast<std::size_t>(parent)].children.push_back(node);
+	  }
+	  const std::int64_t duration = event.end - event.start;
+	  nodes[static_cast<std::size_t>(node)].total += duration;
+	  ++nodes[static_cast<std::size_t>(node)].calls;
+	  nodes[static_cast<std::size_t>(parent)].children_total += duration;
+	  stack.push_back(node);
+	}
+
+	const double per_frame = 1.0 / static_cast<double>(count);
+	summary.frames		   = static_cast<int>(count);
+	summary.frame_ms	   = static_cast<double>(end - begin) * 1e-6 * per_frame;
+
+	// 긴 것부터 DFS
+	std::vector<std::pair<int, int>> pending; // (노드, 깊이)
+	auto push_children = [&](int parent, int depth)
+	{
+	  std::vector<int> children = nodes[static_cast<std::size_t>(parent)].children;
+	  std::sort(children.begin(), children.end(), [&](int a, int b) { return nodes[static_cast<std::size_t>(a)].total < nodes[static_cast<std::size_t>(b)].total; });
+	  for (const int child : children)
+		pending.emplace_back(child, depth);
+	};
+	push_children(0, 0);
+	while (!pending.empty())
+	{
+	  const auto [index, depth] = pending.back();
+	  pending.pop_back();
+	  const Node& node = nodes[static_cast<std::size_t>(index)];
+	  summary.nodes.push_back(SummaryNode{ node.name, depth, static_cast<double>(node.total) * 1e-6 * per_frame,
+										   static_cast<double>(node.total - node.children_total) * 1e-6 * per_frame, static_cast<double>(node.calls) * per_frame });
+	  push_children(index, depth + 1);
+	}
+	return summary;
+  }
+
+  bool Profiler::ExportChromeTrace(const std::string& path) const
+  {
+	std::ofstream out(path);
+	if (!out.is_open())
+	  return false;
+
+	const std::int64_t cleared = cleared_at_.load(std::memory_order_relaxed);
+	const std::lock_guard lock(buffers_mutex_);
+	out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool				   first = true;
+	std::vector<EventCopy> events;
+	char				   number[64];
+	for (const auto& buffer : buffers_)
+	{
+	  out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+	  WriteJsonString(out, buffer->name.c_str());
+	  out << "}}";
+	  first = false;
+
+	  events.clear();
+	  buffer->CopyTo(events, cleared);
+	  for (const EventCopy& event : events)
+	  {
+		out << ",\n{\"name\":";
+		WriteJsonString(out, event.name);
+		std::snprintf(number, sizeof(number), "%.3f,\"dur\":%.3f", static_cast<double>(event.start) * 1e-3, static_cast<double>(event.end - event.start) * 1e-3);
+		out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":" << number << '}';
+	  }
+	}
+	out << "\n]}\n";
+	return static_cast<bool>(out);
+  }
+
+  ProfileScope::ProfileScope(const char* name)
+  {
+	Profiler& profiler = Engine::GetProfiler();
+	if (!profiler.IsRecording())
+	  return;
+	profiler_ = &profiler;
+	name_	  = name;
+	++profiler.Depth();
+	start_ = profiler.Now();
+  }
+
+  ProfileScope::~ProfileScope()
+  {
+	if (profiler_ == nullptr)
+	  return;
+	const std::int64_t end = profiler_->Now();
+	--profiler_->Depth();
+	profiler_->Record(name_, start_, end);
+  }
+}
@@ -0,0 +1,135 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CS230
+{
+  /// @brief CPU 스코프 프로파일러
+  ///
+  /// PROFILE_SCOPE("이름") 이 스코프가 끝날 때 [이름, 시작, 길이, 깊이] 를 그 스레드의 버퍼에 남긴다.
+  /// 버퍼는 스레드마다 따로 있는 고정 크기 링이라 기록에 락이 없고 (버퍼 등록만 스레드당 한 번 락),
+  /// 오래된 이벤트는 덮어쓴다. 이름은 문자열 리터럴만 받는다 (포인터만 저장).
+  /// DRAGONIC_PROFILER 가 정의되지 않으면 (릴리스 빌드 기본값) PROFILE_SCOPE 는 아무 코드도 만들지 않는다.
+  class Profiler
+  {
+	public:
+	static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;
+	static constexpr std::size_t FRAME_HISTORY	   = 256;
+
+	/// 요약 트리의 한 줄 (DFS 순서, depth 로 들여쓰기)
+	struct SummaryNode
+	{
+	  const char* name	   = nullptr;
+	  int		  depth	   = 0;
+	  double	  total_ms = 0.0; // 프레임당 평균
+	  double	  self_ms  = 0.0; // 자식 스코프를 뺀 시간
+	  double	  calls	   = 0.0; // 프레임당 평균 호출 수
+	};
+
+	struct Summary
+	{
+	  int						frames	 = 0;
+	  double					frame_ms = 0.0; // 프레임 평균 길이
+	  std::vector<SummaryNode> nodes;
+	};
+
+	Profiler();
+	~Profiler();
+
+	Profiler(const Profiler&)			 = delete;
+	Profiler& operator=(const Profiler&) = delete;
+
+	static constexpr bool IsCompiledIn()
+	{
+#if defined(DRAGONIC_PROFILER)
+	  return true;
+#else
+	  return false;
+#endif
+	}
+
+	bool IsRecording() const
+	{
+	  return recording_.load(std::memory_order_relaxed);
+	}
+
+	void SetRecording(bool recording)
+	{
+	  recording_.store(recording, std::memory_order_relaxed);
+	}
+
+	/// 프레임 경계 — Engine::Update 가 매 프레임 시작에 부른다. 이 스레드가 요약의 기준 스레드가 된다
+	void MarkFrame();
+
+	/// 기준 스레드의 최근 frames 개 (끝난 프레임만) 를 이름별 호출 트리로 합쳐 프레임당 평균을 낸다
+	Summary Summarize(int frames) const;
+
+	/// 모든 스레드의 버퍼를 Chrome trace-event JSON 으로 (chrome://tracing, ui.perfetto.dev 에서 연다)
+	bool ExportChromeTrace(const std::string& path) const;
+
+	/// 이 스레드의 이름 (트레이스에 표시). 부르지 않으면 "Thread N"
+	void SetThreadName(const char* name);
+
+	/// 지금까지의 기록을 요약/내보내기에서 뺀다 (버퍼는 그대로 두고 기준 시각만 옮긴다 — 기록 중인 스레드와 경합하지 않는다)
+	void Clear();
+
+	// ProfileScope 용 — 시각은 Profiler 생성부터의 나노초
+	std::int64_t Now() const;
+	void		 Record(const char* name, std::int64_t start, std::int64_t end);
+	int&		 Depth();
+
+	private:
+	struct ThreadBuffer;
+
+	ThreadBuffer& LocalBuffer();
+
+	std::atomic<bool>							recording_{ true };
+	std::atomic<std::int64_t>					cleared_at_{ 0 };
+	std::int64_t								origin_;
+	mutable std::mutex							buffers_mutex_; // 버퍼 목록 (기록 자체는 락 없음)
+	std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+	std::uint64_t								id_; // 같은 스레드가 다른 Profiler 에 기록할 때 구분
+
+	// 프레임 경계는 기준 스레드만 쓰고 읽는다
+	ThreadBuffer*			   frame_thread_ = nullptr;
+	std::vector<std::int64_t> frame_starts_;
+	std::uint64_t			   frame_count_ = 0;
+  };
+
+  /// RAII 스코프 — PROFILE_SCOPE 매크로로 쓴다
+  class ProfileScope
+  {
+	public:
+	explicit ProfileScope(const char* name);
+	~ProfileScope();
+
+	ProfileScope(const ProfileScope&)			 = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+	Profiler*	 profiler_ = nullptr; // 기록 중이 아니었으면 nullptr
+	const char*	 name_	   = nullptr;
+	std::int64_t start_	   = 0;
+  };
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b)	   PROFILE_CONCAT_INNER(a, b)
+
+#if defined(DRAGONIC_PROFILER)
+#define PROFILE_SCOPE(name) const CS230::ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
@@ -8,12 +8,11 @@ Wav - SFX
 
 #pragma once
 
-#include <al.h>
-#include <alc.h>
 #include <functional>
 #include <string>
-#include <map>
 
+// 게임 코드가 쓰는 소리 인터페이스 — Engine::GetSoundManager() 가 돌려준다.
+// 창을 띄운 게임은 OpenALSoundManager (게임 실행 파일에만 링크), 헤드리스 도구는 NullSoundManager 를 쓴다.
 class SoundManager
 {
 public:
@@ -30,52 +29,64 @@ public:
     static constexpr const char* SFX_CLERIC_HURT    = "Assets/Audio/SFX/cleric_hurt.wav";
     static constexpr const char* SFX_HUMAN_WALK     = "Assets/Audio/SFX/human_walk.wav";
 
-    SoundManager()  = default;
-    ~SoundManager() = default;
-
-    void Init();
-    void Shutdown();
-    void LoadBGM(const std::string& ogg_path);
-    void PlayBGM(const std::string& ogg_path, bool loop = true);
-    void PauseBGM();
-    void ResumeBGM();
-    void StopBGM();
-    void SetBGMLoop(bool loop);
-    void SetBGMVolume(float volume);
-    void LoadSFX(const std::string& wav_path);
-    void PlaySFX(const std::string& wav_path);
-    void StopAllSFX();
-    void SetSFXVolume(float volume);
+    SoundManager()          = default;
+    virtual ~SoundManager() = default;
+
+    SoundManager(const SoundManager&)            = delete;
+    SoundManager& operator=(const SoundManager&) = delete;
+
+    virtual void Init()                                                 = 0;
+    virtual void Shutdown()                                             = 0;
+    virtual void LoadBGM(const std::string& ogg_path)                   = 0;
+    virtual void PlayBGM(const std::string& ogg_path, bool loop = true) = 0;
+    virtual void PauseBGM()                                             = 0;
+    virtual void ResumeBGM()                                            = 0;
+    virtual void StopBGM()                                              = 0;
+    virtual void SetBGMLoop(bool loop)                                  = 0;
+    virtual void SetBGMVolume(float volume)                             = 0;
+    virtual void LoadSFX(const std::string& wav_path)                   = 0;
+    virtual void PlaySFX(const std::string& wav_path)                   = 0;
+    virtual void StopAllSFX()                                           = 0;
+    virtual void SetSFXVolume(float volume)                             = 0;
 
     // Debug 훅: PlaySFX 호출 직후 wav_path를 받아 호출됨. 한 개 콜백만 보관(디버그 용도).
     using SfxCallback = std::function<void(const std::string&)>;
     void SetSfxCallback(SfxCallback cb) { sfx_callback_ = std::move(cb); }
     void ClearSfxCallback() { sfx_callback_ = nullptr; }
 
-    float GetBGMVolume() const;
-    float GetSFXVolume() const;
-    bool  IsBGMPlaying() const;
-    bool  IsBGMPaused() const;
-private:
-    ALCdevice*  al_device_  = nullptr;
-    ALCcontext* al_context_ = nullptr;
-
-    ALuint bgm_source_ = 0;
-    bool   bgm_loaded_ = false;
+    virtual float GetBGMVolume() const = 0;
+    virtual float GetSFXVolume() const = 0;
+    virtual bool  IsBGMPlaying() const = 0;
+    virtual bool  IsBGMPaused() const  = 0;
 
-    std::map<std::string, ALuint> bgm_cache_;
-    std::map<std::string, ALuint> sfx_cache_;
+protected:
+    SfxCallback sfx_callback_;
+};
 
-    static constexpr int kSfxSourcePoolSize = 8;
-    ALuint               sfx_sources_[kSfxSourcePoolSize]{};
+// Null backend: no OpenAL device/context, every load/play call is a no-op (headless tools)
+class NullSoundManager final : public SoundManager
+{
+public:
+    void Init() override;
+    void Shutdown() override;
+    void LoadBGM(const std::string&) override {}
+    void PlayBGM(const std::string&, bool) override {}
+    void PauseBGM() override {}
+    void ResumeBGM() override {}
+    void StopBGM() override {}
+    void SetBGMLoop(bool) override {}
+    void SetBGMVolume(float volume) override;
+    void LoadSFX(const std::string&) override {}
+    void PlaySFX(const std::string&) override {}
+    void StopAllSFX() override {}
+    void SetSFXVolume(float volume) override;
+
+    float GetBGMVolume() const override { return bgm_volume_; }
+    float GetSFXVolume() const override { return sfx_volume_; }
+    bool  IsBGMPlaying() const override { return false; }
+    bool  IsBGMPaused() const override { return false; }
 
+private:
     float bgm_volume_ = 1.0f;
     float sfx_volume_ = 1.0f;
-
-    SfxCallback sfx_callback_;
-
-    bool   LoadOGGToBuffer(const std::string& path, ALuint& out_buffer);
-    bool   LoadWAVToBuffer(const std::string& path, ALuint& out_buffer);
-    ALuint GetFreeSFXSource();
-    
 };
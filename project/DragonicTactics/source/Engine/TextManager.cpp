@@ -6,11 +6,13 @@
  */
 #include "pch.h"
 
+#include "AllocationTracker.h"
 #include "DrawDepth.h"
 #include "TextManager.h"
 
 void TextManager::DrawText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale, CS200::RGBA color, float depth) const
 {
+	ALLOCATION_SCOPE(UIText);
 	if (auto text_texture = fonts[font]->PrintToTexture(text, color); text_texture)
 	{
 		const auto transform = Math::TranslationMatrix(position) * Math::ScaleMatrix(scale);
@@ -20,6 +22,7 @@ void TextManager::DrawText(const std::string& text, const Math::vec2& position,
 
 Math::ivec2 TextManager::CalculateTextSize(const std::string& text, Fonts font) const
 {
+	ALLOCATION_SCOPE(UIText);
 	if (auto text_texture = fonts[font]->PrintToTexture(text, 0xFFFFFFFF); text_texture)
 	{
 		return text_texture->GetSize();
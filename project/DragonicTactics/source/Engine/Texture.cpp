@@ -14,7 +14,6 @@
 #include "CS200/Image.h"
 #include "Engine.h"
 #include "Matrix.h"
-#include "OpenGL/GL.h"
 #include "TextureManager.h"
 #include "Window.h"
 
@@ -56,7 +55,9 @@ namespace CS230
 
 	Texture::~Texture()
 	{
-		GL::DeleteTextures(1, &textureHandle), textureHandle = 0;
+		// 헤드리스 텍스처(TextureManager::InitHeadless)는 GL 핸들이 없다
+		if (textureHandle != 0 && gpu.release != nullptr)
+			gpu.release(textureHandle), textureHandle = 0;
 	}
 
 	Texture::Texture(Texture&& temporary) noexcept : image_size{ std::move(temporary.image_size) }, textureHandle{ std::move(temporary.textureHandle) }
@@ -76,7 +77,7 @@ namespace CS230
 	{
 		const auto image = CS200::Image{ file_name, true };
 		image_size		 = image.GetSize();
-		textureHandle	 = OpenGL::CreateTextureFromImage(image, OpenGL::Filtering::NearestPixel, OpenGL::Wrapping::ClampToEdge);
+		textureHandle	 = gpu.upload != nullptr ? gpu.upload(image) : OpenGL::TextureHandle{ 0 };
 	}
 
 	Texture::Texture([[maybe_unused]] OpenGL::TextureHandle given_texture, [[maybe_unused]] Math::ivec2 the_size) : image_size{ the_size }, textureHandle{ given_texture }
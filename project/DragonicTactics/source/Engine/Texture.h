@@ -248,5 +248,14 @@ namespace CS230
 		// CS200::Image image; // use initialize member list -> or it will be initialized with default ctor -> but it doesn't exist!!
 		Math::ivec2			  image_size;
 		OpenGL::TextureHandle textureHandle;
+
+		// GL 업로드/해제. TextureManager::Init (게임 실행 파일의 TextureManagerGL.cpp) 가 채우고,
+		// 비어 있으면 (헤드리스) 이미지 크기만 읽고 핸들은 0 이다. 코어 라이브러리가 OpenGL 을 링크하지 않게 한다
+		struct GpuFunctions
+		{
+			OpenGL::TextureHandle (*upload)(const CS200::Image& image);
+			void (*release)(OpenGL::TextureHandle handle);
+		};
+		inline static GpuFunctions gpu{}; // 값 초기화 — 둘 다 nullptr
 	};
 }
@@ -10,10 +10,12 @@
 #include "CS200/IRenderer2D.h"
 #include "CS200/ImmediateRenderer2D.h"
 #include "CS200/InstancedRenderer2D.h"
+#include "CS200/NullRenderer2D.h"
 #include "OpenGL/Framebuffer.h"
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -28,12 +30,19 @@ public:
 	{
 	  Immediate,
 	  Batch,
-	  Instanced
+	  Instanced,
+	  Null // 헤드리스: GL 없이 그리기 호출만 센다 (InitHeadless)
 	};
 
 	std::shared_ptr<Texture> Load(const std::filesystem::path& file_name);
 
 	void							Init();
+	/// @brief 창/GL 컨텍스트 없이 사용 — NullRenderer2D 를 쓰고, Load 는 이미지 크기만 읽어 GL 텍스처 없는 Texture 를 만든다
+	void							InitHeadless();
+	bool							IsHeadless() const
+	{
+	  return current_renderer_type == RendererType::Null;
+	}
 	void							Unload();
 	static void						StartRenderTextureMode(int width, int height);
 	static std::shared_ptr<Texture> EndRenderTextureMode();
@@ -49,6 +58,7 @@ private:
 	inline static std::unique_ptr<CS200::IRenderer2D> renderer2D{};
 
 	std::map<std::filesystem::path, std::shared_ptr<Texture>> textures;
+	std::mutex												  textures_mutex; // 헤드리스 병렬 시뮬레이션의 워커들이 동시에 Load
 
 	struct RenderInfo
 	{
@@ -16,6 +16,7 @@
 #include "Error.h"
 #include "Logger.h"
 #include "Window.h"
+#include <SDL.h>
 #include <GL/glew.h>
 
 namespace
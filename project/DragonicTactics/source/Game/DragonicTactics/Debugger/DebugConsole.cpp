@@ -8,6 +8,7 @@
 
 #include "DebugConsole.h"
 #include "DebugManager.h"
+#include <imgui.h>
 
 
 #include <cstring>
@@ -6,21 +6,32 @@
  */
 #include "pch.h"
 
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/Engine.h"
+#include "./Engine/FrameStats.h"
 #include "./Engine/GameStateManager.h"
 #include "./Engine/Input.h"
 #include "./Engine/Logger.h"
+#include "./Engine/Profiler.h"
 #include "./Engine/SoundManager.h"
 #include "DebugConsole.h"
 #include "DebugManager.h"
 #include "DebugVisualizer.h"
 #include "Game/DragonicTactics/Objects/Character.h"
 #include "Game/DragonicTactics/Objects/Components/SpellSlots.h"
+#include "Game/DragonicTactics/StateComponents/AISystem.h"
+#include "Game/DragonicTactics/StateComponents/BattleHash.h"
+#include "Game/DragonicTactics/StateComponents/CombatSystem.h"
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
 #include "Game/DragonicTactics/StateComponents/GridSystem.h"
 #include "Game/DragonicTactics/StateComponents/TurnManager.h"
+#include <imgui.h>
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cfloat>
+#include <cstdio>
 
 namespace {
 Character* FindCharacterByName(const std::string& name)
@@ -148,12 +159,27 @@ void DebugManager::DrawImGui([[maybe_unused]]const GridSystem* grid)
   {
 	console_->DrawImGui();
   }
+
+  if (profiler_open_)
+  {
+	DrawProfilerPanel();
+  }
+
+  if (frame_stats_open_)
+  {
+	DrawFrameStatsPanel();
+  }
+
+  if (allocations_open_)
+  {
+	DrawAllocationPanel();
+  }
 #endif // DEVELOPER_VERSION
 }
 
 void DebugManager::DrawDebugControlPanel()
 {
-  ImGui::SetNextWindowSize(ImVec2(280, 450), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowSize(ImVec2(280, 640), ImGuiCond_FirstUseEver);
   ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
 
   if (ImGui::Begin("Debug Tools", &show_debug_tools_, ImGuiWindowFlags_NoResize))
@@ -189,6 +215,10 @@ void DebugManager::DrawDebugControlPanel()
 	  }
 	}
 
+	ImGui::Checkbox("Profiler", &profiler_open_);
+	ImGui::Checkbox("Frame Times", &frame_stats_open_);
+	ImGui::Checkbox("Allocations", &allocations_open_);
+
 	ImGui::Spacing();
 	ImGui::Separator();
 	ImGui::Spacing();
@@ -198,7 +228,10 @@ void DebugManager::DrawDebugControlPanel()
 	ImGui::Spacing();
 
 	ImGui::PushStyleColor(ImGuiCol_Text, god_mode ? ImVec4(1.0f, 0.3f, 0.3f, 1.0f) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
-	ImGui::Checkbox("God Mode", &god_mode);
+	if (ImGui::Checkbox("God Mode", &god_mode))
+	{
+	  SyncGodMode();
+	}
 	ImGui::PopStyleColor();
 
 	ImGui::Spacing();
@@ -253,12 +286,209 @@ void DebugManager::DrawDebugControlPanel()
 	ImGui::Spacing();
 	//===========================================
 
+	// === AI ===
+	ImGui::Text("AI");
+	ImGui::Spacing();
+
+	if (AISystem* ai = Engine::GetGameStateManager().GetGSComponent<AISystem>())
+	{
+	  bool cache_enabled = ai->IsDecisionCacheEnabled();
+	  if (ImGui::Checkbox("Decision Cache", &cache_enabled))
+		ai->SetDecisionCacheEnabled(cache_enabled);
+
+	  const AISystem::DecisionCacheStats& cache = ai->GetDecisionCacheStats();
+	  ImGui::Text("Hit rate: %.1f%% (%lld / %lld)", 100.0 * cache.HitRate(), cache.hits, cache.hits + cache.misses);
+	  ImGui::Text("Entries: %zu", ai->GetDecisionCacheSize());
+	  if (const BattleHash* hash = Engine::GetGameStateManager().GetGSComponent<BattleHash>())
+		ImGui::Text("State hash: %016llx", static_cast<unsigned long long>(hash->GetHash()));
+	}
+	else
+	{
+	  ImGui::TextDisabled("No AISystem");
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	// === Events ===
+	ImGui::Text("Events");
+	ImGui::Spacing();
+
+	if (EventBus* bus = Engine::GetGameStateManager().GetGSComponent<EventBus>())
+	{
+	  // 끄면 로그/효과음 구독자도 발행 즉시 받는다 (묶음 크기 1)
+	  bool deferred = bus->IsDeferred();
+	  if (ImGui::Checkbox("Batch UI/SFX events", &deferred))
+		bus->SetDeferred(deferred);
+	  ImGui::Text("Queued: %zu", bus->GetQueuedEventCount());
+	}
+	else
+	{
+	  ImGui::TextDisabled("No EventBus");
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
 	// === Info ===
 	ImGui::TextWrapped("F1: Toggle Debug Mode\nTab: Toggle This Panel");
   }
   ImGui::End();
 }
 
+void DebugManager::DrawProfilerPanel()
+{
+  ImGui::SetNextWindowSize(ImVec2(460, 520), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowPos(ImVec2(300, 10), ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Profiler", &profiler_open_))
+  {
+	CS230::Profiler& profiler = Engine::GetProfiler();
+	if (!CS230::Profiler::IsCompiledIn())
+	{
+	  ImGui::TextWrapped("PROFILE_SCOPE is compiled out. Configure with -DENABLE_PROFILER=ON.");
+	}
+
+	bool recording = profiler.IsRecording();
+	if (ImGui::Checkbox("Record", &recording))
+	  profiler.SetRecording(recording);
+	ImGui::SameLine();
+	if (ImGui::Button("Clear"))
+	  profiler.Clear();
+	ImGui::SameLine();
+	if (ImGui::Button("Export Chrome Trace"))
+	{
+	  if (profiler.ExportChromeTrace("profile_trace.json"))
+		Engine::GetLogger().LogEvent("Profiler: wrote profile_trace.json");
+	  else
+		Engine::GetLogger().LogError("Profiler: cannot write profile_trace.json");
+	}
+
+	// 최근 60 프레임 평균 — 막대 길이는 프레임 전체 대비 비율
+	const CS230::Profiler::Summary summary = profiler.Summarize(60);
+	ImGui::Text("%d frames, %.3f ms / frame", summary.frames, summary.frame_ms);
+	ImGui::Separator();
+
+	for (const CS230::Profiler::SummaryNode& node : summary.nodes)
+	{
+	  const float fraction = summary.frame_ms > 0.0 ? static_cast<float>(node.total_ms / summary.frame_ms) : 0.0f;
+	  char		  label[160];
+	  std::snprintf(label, sizeof(label), "%s  %.3f ms (self %.3f, x%.1f)", node.name, node.total_ms, node.self_ms, node.calls);
+	  ImGui::Indent(static_cast<float>(node.depth) * 12.0f + 1.0f);
+	  ImGui::ProgressBar(std::min(fraction, 1.0f), ImVec2(-1, 0), label);
+	  ImGui::Unindent(static_cast<float>(node.depth) * 12.0f + 1.0f);
+	}
+  }
+  ImGui::End();
+}
+
+void DebugManager::DrawFrameStatsPanel()
+{
+  ImGui::SetNextWindowSize(ImVec2(420, 420), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowPos(ImVec2(300, 540), ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Frame Times", &frame_stats_open_))
+  {
+	util::FrameStats&			  stats = Engine::GetFrameStats();
+	const util::FrameTimeSummary& times = Engine::GetWindowEnvironment().FrameTimes;
+
+	ImGui::Text("%d frames, mean %.2f ms (%d FPS)", times.frames, times.mean_ms, Engine::GetWindowEnvironment().FPS);
+	ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms", times.p50_ms, times.p95_ms, times.p99_ms, times.max_ms);
+
+	// 히치: 중앙값의 두 배와 예산을 둘 다 넘은 프레임
+	ImGui::PushStyleColor(ImGuiCol_Text, times.hitches > 0 ? ImVec4(1.0f, 0.4f, 0.3f, 1.0f) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+	ImGui::Text("Hitches: %d   Over budget: %d", times.hitches, times.over_budget);
+	ImGui::PopStyleColor();
+
+	float budget = static_cast<float>(stats.GetFrameBudget());
+	if (ImGui::SliderFloat("Budget (ms)", &budget, 4.0f, 50.0f, "%.2f"))
+	  stats.SetFrameBudget(static_cast<double>(budget));
+
+	ImGui::Separator();
+	ImGui::Text("Update %.2f  Draw %.2f  Swap %.2f  Other %.2f ms", times.update_ms, times.draw_ms, times.swap_ms, times.other_ms);
+
+	// 최근 프레임 시간 그래프 (오래된 것부터)
+	std::array<float, util::FrameStats::CAPACITY> recent{};
+	const std::size_t							  count = stats.GetCount();
+	for (std::size_t i = 0; i < count; ++i)
+	  recent[i] = stats.GetSample(i).total_ms;
+	const float scale_max = static_cast<float>(std::max(times.max_ms, stats.GetFrameBudget() * 2.0));
+	ImGui::PlotLines("##frames", recent.data(), static_cast<int>(count), 0, "frame ms", 0.0f, scale_max, ImVec2(-1, 80));
+
+	const auto histogram = stats.Histogram();
+	ImGui::PlotHistogram("##histogram", histogram.data(), static_cast<int>(histogram.size()), 0, "histogram (1 ms buckets)", 0.0f, FLT_MAX, ImVec2(-1, 80));
+
+	if (ImGui::Button("Clear"))
+	  stats.Clear();
+	ImGui::SameLine();
+	if (ImGui::Button("Dump CSV"))
+	{
+	  if (stats.WriteCsv("frame_times.csv"))
+		Engine::GetLogger().LogEvent("Frame stats: wrote frame_times.csv");
+	  else
+		Engine::GetLogger().LogError("Frame stats: cannot write frame_times.csv");
+	}
+  }
+  ImGui::End();
+}
+
+void DebugManager::DrawAllocationPanel()
+{
+  using CS230::AllocationTracker;
+  ImGui::SetNextWindowSize(ImVec2(420, 300), ImGuiCond_FirstUseEver);
+  ImGui::SetNextWindowPos(ImVec2(730, 10), ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Allocations", &allocations_open_))
+  {
+	if (!AllocationTracker::IsCompiledIn())
+	{
+	  ImGui::TextWrapped("Allocation tracking is compiled out. Configure with -DENABLE_ALLOCATION_TRACKING=ON.");
+	}
+
+	// 메인 스레드의 직전 프레임 / 태그별 최대 프레임
+	const AllocationTracker::TagCounters& last = AllocationTracker::GetLastFrame();
+	const AllocationTracker::TagCounters& peak = AllocationTracker::GetPeakFrame();
+	if (ImGui::BeginTable("allocations", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+	  ImGui::TableSetupColumn("Subsystem");
+	  ImGui::TableSetupColumn("Allocs");
+	  ImGui::TableSetupColumn("Bytes");
+	  ImGui::TableSetupColumn("Peak allocs");
+	  ImGui::TableHeadersRow();
+	  for (std::size_t i = 0; i < AllocationTracker::TAG_COUNT; ++i)
+	  {
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(AllocationTracker::TagName(static_cast<CS230::AllocationTag>(i)));
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(last[i].allocations));
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(last[i].bytes));
+		ImGui::TableNextColumn();
+		ImGui::Text("%llu", static_cast<unsigned long long>(peak[i].allocations));
+	  }
+	  ImGui::EndTable();
+	}
+
+	const CS230::AllocationCounters total = AllocationTracker::Sum(last);
+	ImGui::Text("Frame total: %llu allocs, %llu bytes, %llu frees", static_cast<unsigned long long>(total.allocations),
+				static_cast<unsigned long long>(total.bytes), static_cast<unsigned long long>(total.frees));
+
+	// 0 이면 검사하지 않는다
+	int budget = static_cast<int>(AllocationTracker::GetFrameBudget());
+	if (ImGui::InputInt("Frame budget", &budget))
+	  AllocationTracker::SetFrameBudget(static_cast<std::uint64_t>(std::max(budget, 0)));
+	ImGui::PushStyleColor(ImGuiCol_Text, AllocationTracker::GetFramesOverBudget() > 0 ? ImVec4(1.0f, 0.4f, 0.3f, 1.0f) : ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+	ImGui::Text("Frames over budget: %llu", static_cast<unsigned long long>(AllocationTracker::GetFramesOverBudget()));
+	ImGui::PopStyleColor();
+	if (ImGui::Button("Reset Peak"))
+	  AllocationTracker::ResetPeak();
+  }
+  ImGui::End();
+}
+
 void DebugManager::ToggleDebugTools()
 {
   show_debug_tools_ = !show_debug_tools_;
@@ -302,6 +532,7 @@ void DebugManager::SetDebugMode(bool enabled)
     if (visualizer_) visualizer_->ClosePanel();
     if (console_ && console_->IsOpen()) console_->ToggleConsole();
   }
+  SyncGodMode();
 }
 
 void DebugManager::ToggleDebugMode()
@@ -360,9 +591,17 @@ void DebugManager::ToggleStatusInfo()
 void DebugManager::ToggleGodMode()
 {
   god_mode = !god_mode;
+  SyncGodMode();
   Engine::GetLogger().LogEvent(god_mode ? "God Mode ON" : "God Mode OFF");
 }
 
+void DebugManager::SyncGodMode()
+{
+  // 규칙 쪽(CombatSystem/SpellSystem)은 DebugManager 를 모른다 — 헤드리스 도구에는 디버거가 없다
+  if (auto* combat = Engine::GetGameStateManager().GetGSComponent<CombatSystem>())
+	combat->SetGodMode(IsGodModeEnabled());
+}
+
 bool DebugManager::IsGridOverlayEnabled() const
 {
   return debug_mode && grid_overlay;
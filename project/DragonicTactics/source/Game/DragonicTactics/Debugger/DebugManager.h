@@ -72,7 +72,11 @@ class DebugManager : public CS230::Component
 
   private:
   void DrawDebugControlPanel();
+  void DrawProfilerPanel();
+  void DrawFrameStatsPanel();
+  void DrawAllocationPanel();
   void RegisterGameCommands();
+  void SyncGodMode(); // IsGodModeEnabled() 를 CombatSystem 에 넘긴다
 
   bool debug_mode{ false };
   bool show_debug_tools_{ false };
@@ -84,6 +88,9 @@ class DebugManager : public CS230::Component
   bool combat_inspector{ false };
   bool event_tracer{ false };
   bool god_mode{ false };
+  bool profiler_open_{ false };
+  bool frame_stats_open_{ false };
+  bool allocations_open_{ false };
 
   // Owned subsystems
   std::unique_ptr<DebugConsole>	   console_;
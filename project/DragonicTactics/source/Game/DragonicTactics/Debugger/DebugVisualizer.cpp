@@ -22,6 +22,7 @@
 #include "./Game/DragonicTactics/Types/Events.h"
 #include "DebugManager.h"
 #include "DebugVisualizer.h"
+#include <imgui.h>
 
 namespace
 {
@@ -47,22 +48,23 @@ void DebugVisualizer::Init()
   Engine::GetLogger().LogEvent("DebugVisualizer: Subscribing to events");
 
   auto* event_bus = Engine::GetGameStateManager().GetGSComponent<EventBus>();
+  subscriptions_.clear();
 
   // Subscribe to combat events
-  event_bus->Subscribe<CharacterDamagedEvent>([this](const CharacterDamagedEvent& e) { OnCharacterDamaged(e); });
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDamagedEvent>([this](const CharacterDamagedEvent& e) { OnCharacterDamaged(e); }));
 
-  event_bus->Subscribe<CharacterDeathEvent>([this](const CharacterDeathEvent& e) { OnCharacterDeath(e); });
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDeathEvent>([this](const CharacterDeathEvent& e) { OnCharacterDeath(e); }));
 
   // Subscribe to movement events
-  event_bus->Subscribe<AIDecisionEvent>([this](const AIDecisionEvent& e) { OnAIDecision(e); });
+  subscriptions_.push_back(event_bus->Subscribe<AIDecisionEvent>([this](const AIDecisionEvent& e) { OnAIDecision(e); }));
 
   // Subscribe to turn events
-  event_bus->Subscribe<TurnStartedEvent>([this](const TurnStartedEvent& e) { OnTurnStarted(e); });
+  subscriptions_.push_back(event_bus->Subscribe<TurnStartedEvent>([this](const TurnStartedEvent& e) { OnTurnStarted(e); }));
 
   // Subscribe to spell / status / movement events
-  event_bus->Subscribe<SpellCastEvent>([this](const SpellCastEvent& e) { OnSpellCast(e); });
-  event_bus->Subscribe<StatusEffectAddedEvent>([this](const StatusEffectAddedEvent& e) { OnStatusEffectAdded(e); });
-  event_bus->Subscribe<CharacterMovedEvent>([this](const CharacterMovedEvent& e) { OnCharacterMoved(e); });
+  subscriptions_.push_back(event_bus->Subscribe<SpellCastEvent>([this](const SpellCastEvent& e) { OnSpellCast(e); }));
+  subscriptions_.push_back(event_bus->Subscribe<StatusEffectAddedEvent>([this](const StatusEffectAddedEvent& e) { OnStatusEffectAdded(e); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterMovedEvent>([this](const CharacterMovedEvent& e) { OnCharacterMoved(e); }));
 
   // SFX 재생 추적 — SoundManager 직접 콜백 (EventBus 미경유)
   Engine::GetSoundManager().SetSfxCallback([this](const std::string& path) { OnSfxPlayed(path); });
@@ -213,6 +215,13 @@ void DebugVisualizer::DrawImGuiDebugPanel([[maybe_unused]]const GridSystem* grid
 		ImGui::EndTabItem();
 	  }
 
+	  // Tab 7: Pathfinding
+	  if (ImGui::BeginTabItem("Pathfinding"))
+	  {
+		DrawImGuiPathfinding(grid);
+		ImGui::EndTabItem();
+	  }
+
 	  ImGui::EndTabBar();
 	}
   }
@@ -690,6 +699,43 @@ void DebugVisualizer::DrawImGuiSfxLog()
   ImGui::EndChild();
 }
 
+void DebugVisualizer::DrawImGuiPathfinding(const GridSystem* grid)
+{
+  if (grid == nullptr)
+  {
+	ImGui::Text("No grid available");
+	return;
+  }
+
+  const GridSystem::DistanceFieldStats stats	= grid->GetDistanceFieldStats();
+  const int							   lookups = stats.hits + stats.misses;
+  const float						   hit_rate = lookups > 0 ? 100.0f * static_cast<float>(stats.hits) / static_cast<float>(lookups) : 0.0f;
+
+  ImGui::Text("Distance Field Cache");
+  ImGui::Separator();
+  ImGui::Text("Hits: %d", stats.hits);
+  ImGui::Text("Misses: %d", stats.misses);
+  ImGui::TextColored(ImVec4(0.4f, 1.0f, 0.4f, 1.0f), "Hit Rate: %.1f%%", static_cast<double>(hit_rate));
+  ImGui::Text("Invalidated: %d", stats.invalidations);
+  ImGui::Text("Cached Fields: %d", stats.cached);
+  ImGui::Separator();
+  ImGui::Text("Last FindPath expanded: %d nodes", grid->GetLastPathExpandedCount());
+
+  ImGui::Spacing();
+  ImGui::Text("Hierarchical (HPA*)");
+  ImGui::Separator();
+  if (grid->GetPathfindingMode() != GridSystem::PathfindingMode::Hierarchical)
+  {
+	ImGui::TextDisabled("Flat A* (map does not use hierarchical mode)");
+	return;
+  }
+  const HierarchicalPathfinder::Stats& hpa = grid->GetHierarchicalStats();
+  ImGui::Text("Clusters: %d", hpa.clusters);
+  ImGui::Text("Entrances: %d  Abstract nodes: %d", hpa.entrances, hpa.abstract_nodes);
+  ImGui::Text("Rebuilt clusters: %d", hpa.rebuilt_clusters);
+  ImGui::Text("Last query: %s, %d abstract nodes", hpa.last_used_flat ? "flat" : "hierarchical", hpa.last_expanded);
+}
+
 std::string DebugVisualizer::GetDecisionTypeString(AIDecisionType type)
 {
   switch (type)
@@ -7,6 +7,7 @@
 #pragma once
 #include "./CS200/RGBA.h"
 #include "./Engine/Vec2.h"
+#include "./Game/DragonicTactics/StateComponents/EventBus.h"
 #include <deque>
 #include <string>
 #include <vector>
@@ -132,6 +133,8 @@ class DebugVisualizer
 
   double game_time_{ 0.0 };
 
+  std::vector<EventBus::Subscription> subscriptions_;
+
   // === Event Handlers ===
   void OnAIDecision(const struct AIDecisionEvent& event);
   void OnCharacterDamaged(const struct CharacterDamagedEvent& event);
@@ -150,6 +153,7 @@ class DebugVisualizer
   void DrawImGuiCombatLog();
   void DrawImGuiAIDecisions();
   void DrawImGuiSfxLog();
+  void DrawImGuiPathfinding(const GridSystem* grid);
 
   //=== Utility ===
   std::string GetDecisionTypeString(AIDecisionType type);
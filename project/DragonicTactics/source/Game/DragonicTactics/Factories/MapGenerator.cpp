@@ -0,0 +1,308 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "MapGenerator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+  constexpr char WALL      = '#';
+  constexpr char FLOOR     = '.';
+  constexpr char LAVA      = 'L';
+  constexpr char DIFFICULT = '~';
+
+  // splitmix64 — 상태 하나, 모든 플랫폼에서 같은 수열
+  class SplitMix64
+  {
+	public:
+	explicit SplitMix64(std::uint64_t seed) : state_(seed)
+	{
+	}
+
+	std::uint64_t Next()
+	{
+	  std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+	  z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	  z               = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	  return z ^ (z >> 31);
+	}
+
+	/// @brief [0, bound) 정수 (bound 는 작으므로 modulo bias 무시)
+	int Below(int bound)
+	{
+	  return static_cast<int>(Next() % static_cast<std::uint64_t>(bound));
+	}
+
+	private:
+	std::uint64_t state_;
+  };
+
+  struct Cells
+  {
+	int               width  = 0;
+	int               height = 0;
+	std::vector<char> data; // index = y * width + x (grid 좌표, y 위쪽이 큼)
+
+	char& At(int x, int y)
+	{
+	  return data[static_cast<std::size_t>(y * width + x)];
+	}
+
+	char At(int x, int y) const
+	{
+	  return data[static_cast<std::size_t>(y * width + x)];
+	}
+
+	bool IsInterior(int x, int y) const
+	{
+	  return x > 0 && y > 0 && x < width - 1 && y < height - 1;
+	}
+  };
+
+  constexpr int DX[4] = { 1, -1, 0, 0 };
+  constexpr int DY[4] = { 0, 0, 1, -1 };
+
+  void Smooth(Cells& cells)
+  {
+	std::vector<char> next = cells.data;
+	for (int y = 1; y < cells.height - 1; ++y)
+	{
+	  for (int x = 1; x < cells.width - 1; ++x)
+	  {
+		int walls = 0;
+		for (int oy = -1; oy <= 1; ++oy)
+		  for (int ox = -1; ox <= 1; ++ox)
+			if ((ox != 0 || oy != 0) && cells.At(x + ox, y + oy) == WALL)
+			  ++walls;
+
+		// 고립된 벽은 지우고, 벽에 둘러싸인 바닥은 메워서 덩어리를 만든다
+		const bool wall = walls >= 5 || (cells.At(x, y) == WALL && walls >= 2);
+		next[static_cast<std::size_t>(y * cells.width + x)] = wall ? WALL : FLOOR;
+	  }
+	}
+	cells.data.swap(next);
+  }
+
+  /// @brief 바닥 위에서 랜덤 워크로 target 개 타일을 type 으로 바꾼다 (덩어리 형태)
+  void ScatterBlobs(Cells& cells, SplitMix64& rng, char type, int target)
+  {
+	int placed   = 0;
+	int attempts = target * 4 + 16;
+	while (placed < target && attempts-- > 0)
+	{
+	  int       x      = 1 + rng.Below(cells.width - 2);
+	  int       y      = 1 + rng.Below(cells.height - 2);
+	  const int length = 4 + rng.Below(12);
+	  for (int step = 0; step < length && placed < target; ++step)
+	  {
+		if (cells.At(x, y) == FLOOR)
+		{
+		  cells.At(x, y) = type;
+		  ++placed;
+		}
+		const int dir = rng.Below(4);
+		const int nx  = x + DX[dir];
+		const int ny  = y + DY[dir];
+		if (cells.IsInterior(nx, ny) && cells.At(nx, ny) != WALL)
+		{
+		  x = nx;
+		  y = ny;
+		}
+	  }
+	}
+  }
+
+  /// @brief start 에서 4방향 BFS (바닥/Lava 통과), 도달 불가 = -1
+  std::vector<int> Distances(const Cells& cells, int start)
+  {
+	std::vector<int> dist(cells.data.size(), -1);
+	std::vector<int> queue;
+	queue.reserve(cells.data.size() / 2);
+	dist[static_cast<std::size_t>(start)] = 0;
+	queue.push_back(start);
+	for (std::size_t head = 0; head < queue.size(); ++head)
+	{
+	  const int index = queue[head];
+	  const int x     = index % cells.width;
+	  const int y     = index / cells.width;
+	  for (int dir = 0; dir < 4; ++dir)
+	  {
+		const int nx = x + DX[dir];
+		const int ny = y + DY[dir];
+		if (!cells.IsInterior(nx, ny))
+		  continue;
+		const char c = cells.At(nx, ny);
+		const int  n = ny * cells.width + nx;
+		if ((c == FLOOR || c == LAVA) && dist[static_cast<std::size_t>(n)] < 0)
+		{
+		  dist[static_cast<std::size_t>(n)] = dist[static_cast<std::size_t>(index)] + 1;
+		  queue.push_back(n);
+		}
+	  }
+	}
+	return dist;
+  }
+
+  /// @brief 중앙에서 가장 가까운 바닥 (없으면 중앙을 바닥으로 만든다)
+  int CenterFloor(Cells& cells)
+  {
+	const int cx   = cells.width / 2;
+	const int cy   = cells.height / 2;
+	int       best = -1;
+	int       best_distance = 0;
+	for (int y = 1; y < cells.height - 1; ++y)
+	{
+	  for (int x = 1; x < cells.width - 1; ++x)
+	  {
+		if (cells.At(x, y) != FLOOR)
+		  continue;
+		const int d = std::abs(x - cx) + std::abs(y - cy);
+		if (best < 0 || d < best_distance)
+		{
+		  best          = y * cells.width + x;
+		  best_distance = d;
+		}
+	  }
+	}
+	if (best < 0)
+	{
+	  cells.At(cx, cy) = FLOOR;
+	  best             = cy * cells.width + cx;
+	}
+	return best;
+  }
+
+  Math::ivec2 ToGrid(const Cells& cells, int index)
+  {
+	return { index % cells.width, index / cells.width };
+  }
+}
+
+MapData MapGenerator::Generate(const ProceduralMapSettings& settings)
+{
+  Cells cells;
+  cells.width  = std::clamp(settings.width, MIN_SIZE, MAX_SIZE);
+  cells.height = std::clamp(settings.height, MIN_SIZE, MAX_SIZE);
+  cells.data.assign(static_cast<std::size_t>(cells.width * cells.height), FLOOR);
+
+  SplitMix64 rng(settings.seed);
+
+  for (int y = 0; y < cells.height; ++y)
+  {
+	for (int x = 0; x < cells.width; ++x)
+	{
+	  if (!cells.IsInterior(x, y) || rng.Below(100) < settings.wall_percent)
+		cells.At(x, y) = WALL;
+	}
+  }
+  for (int pass = 0; pass < settings.smoothing_passes; ++pass)
+	Smooth(cells);
+
+  const int interior = (cells.width - 2) * (cells.height - 2);
+  ScatterBlobs(cells, rng, LAVA, interior * settings.lava_percent / 100);
+  ScatterBlobs(cells, rng, DIFFICULT, interior * settings.difficult_percent / 100);
+
+  // 스폰 배치: dragon 은 중앙, fighter 는 도달 가능한 가장 먼 바닥, cleric 은 fighter 옆
+  const int              dragon = CenterFloor(cells);
+  const std::vector<int> dist   = Distances(cells, dragon);
+
+  int fighter = -1;
+  for (int i = 0; i < static_cast<int>(dist.size()); ++i)
+  {
+	if (i != dragon && cells.data[static_cast<std::size_t>(i)] == FLOOR && dist[static_cast<std::size_t>(i)] > 0 &&
+		(fighter < 0 || dist[static_cast<std::size_t>(i)] > dist[static_cast<std::size_t>(fighter)]))
+	  fighter = i;
+  }
+  if (fighter < 0)
+  {
+	// 중앙이 막혀 있는 극단적인 설정 — dragon 옆을 비워서라도 배치한다
+	fighter                                     = dragon + 1;
+	cells.data[static_cast<std::size_t>(fighter)] = FLOOR;
+  }
+
+  int cleric = -1;
+  {
+	const Math::ivec2 f = ToGrid(cells, fighter);
+	for (int dir = 0; dir < 4 && cleric < 0; ++dir)
+	{
+	  const int nx = f.x + DX[dir];
+	  const int ny = f.y + DY[dir];
+	  const int n  = ny * cells.width + nx;
+	  if (cells.IsInterior(nx, ny) && cells.At(nx, ny) == FLOOR && n != dragon)
+		cleric = n;
+	}
+	if (cleric < 0)
+	{
+	  // fighter 가 막다른 곳 — 다음으로 먼 바닥
+	  for (int i = 0; i < static_cast<int>(dist.size()); ++i)
+	  {
+		if (i != dragon && i != fighter && cells.data[static_cast<std::size_t>(i)] == FLOOR && dist[static_cast<std::size_t>(i)] > 0 &&
+			(cleric < 0 || dist[static_cast<std::size_t>(i)] > dist[static_cast<std::size_t>(cleric)]))
+		  cleric = i;
+	  }
+	}
+	if (cleric < 0)
+	{
+	  cleric                                       = dragon - 1;
+	  cells.data[static_cast<std::size_t>(cleric)] = FLOOR;
+	}
+  }
+
+  MapData map;
+  map.id           = "procedural_" + std::to_string(cells.width) + "x" + std::to_string(cells.height) + "_" + std::to_string(settings.seed);
+  map.name         = "Procedural " + std::to_string(cells.width) + "x" + std::to_string(cells.height) + " (seed " + std::to_string(settings.seed) + ")";
+  map.width        = cells.width;
+  map.height       = cells.height;
+  map.legend       = { { WALL, "wall" }, { FLOOR, "floor" }, { LAVA, "lava" }, { DIFFICULT, "water" } };
+  map.pathfinding  = settings.pathfinding;
+  map.cluster_size = settings.cluster_size;
+  map.spawn_points["dragon"]  = ToGrid(cells, dragon);
+  map.spawn_points["fighter"] = ToGrid(cells, fighter);
+  map.spawn_points["cleric"]  = ToGrid(cells, cleric);
+
+  // exit: 도달 가능한 바닥에 붙은 테두리 벽 중 dragon 에서 가장 먼 곳 (기존 맵처럼 테두리에 둔다)
+  if (settings.place_exit)
+  {
+	int best_distance = -1;
+	for (int y = 0; y < cells.height; ++y)
+	{
+	  for (int x = 0; x < cells.width; ++x)
+	  {
+		if (cells.IsInterior(x, y))
+		{
+		  x = cells.width - 2; // 내부는 건너뛰고 오른쪽 테두리로
+		  continue;
+		}
+		for (int dir = 0; dir < 4; ++dir)
+		{
+		  const int nx = x + DX[dir];
+		  const int ny = y + DY[dir];
+		  if (!cells.IsInterior(nx, ny))
+			continue;
+		  const int n = ny * cells.width + nx;
+		  const int d = dist[static_cast<std::size_t>(n)];
+		  if (cells.At(nx, ny) == FLOOR && d > best_distance && n != fighter && n != cleric)
+		  {
+			best_distance     = d;
+			map.exit_position = { x, y };
+			map.has_exit      = true;
+		  }
+		}
+	  }
+	}
+  }
+
+  // rows 는 위 → 아래 (grid y = height - 1 - row)
+  map.tiles.reserve(static_cast<std::size_t>(cells.height));
+  for (int row = 0; row < cells.height; ++row)
+  {
+	const int y = cells.height - 1 - row;
+	map.tiles.emplace_back(cells.data.begin() + y * cells.width, cells.data.begin() + (y + 1) * cells.width);
+  }
+  return map;
+}
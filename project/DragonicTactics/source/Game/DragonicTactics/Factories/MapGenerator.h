@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "../StateComponents/MapDataRegistry.h"
+#include <cstdint>
+#include <string>
+
+/// @brief 절차적 맵 생성 설정 — 같은 설정(seed 포함)이면 플랫폼과 무관하게 같은 맵이 나온다
+struct ProceduralMapSettings
+{
+  int			width			  = 32;
+  int			height			  = 32;
+  std::uint64_t seed			  = 1;
+  int			wall_percent	  = 18; // 내부 타일 중 초기 벽 비율 (스무딩 전)
+  int			lava_percent	  = 4;	// 내부 타일 중 Lava 비율 (덩어리로 배치)
+  int			difficult_percent = 6;	// 내부 타일 중 water(Difficult) 비율
+  int			smoothing_passes  = 2;	// 벽 셀룰러 오토마타 반복 횟수
+  bool			place_exit		  = true;
+  std::string	pathfinding		  = "flat"; // MapData::pathfinding 그대로 전달
+  int			cluster_size	  = 16;
+};
+
+/// @brief 시드 기반 MapData 생성기 (벤치마크/시뮬레이션용 16x16 ~ 2048x2048)
+///
+/// 테두리는 벽, 내부는 노이즈 + 셀룰러 오토마타로 벽 덩어리를 만들고 Lava/water 를 덩어리로 뿌린다.
+/// dragon 은 중앙 근처, fighter 는 dragon 에서 도달 가능한 가장 먼 바닥, cleric 은 그 옆,
+/// exit 는 도달 가능한 바닥에 붙은 테두리 벽 중 dragon 에서 가장 먼 곳에 둔다.
+/// std::mt19937 분포는 구현마다 결과가 달라서 자체 splitmix64 를 쓴다.
+class MapGenerator
+{
+  public:
+  static constexpr int MIN_SIZE = 8;
+  static constexpr int MAX_SIZE = 2048;
+
+  static MapData Generate(const ProceduralMapSettings& settings);
+};
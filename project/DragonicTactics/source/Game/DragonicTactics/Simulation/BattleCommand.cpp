@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleCommand.h"
+#include "BattleRecorder.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include "./Engine/Logger.h"
+
+#include "../Objects/Character.h"
+#include "../Objects/Components/GridPosition.h"
+#include "../StateComponents/AISystem.h"
+#include "../StateComponents/CombatSystem.h"
+#include "../StateComponents/GridSystem.h"
+#include "../StateComponents/SpellSystem.h"
+#include "../StateComponents/TurnManager.h"
+
+BattleCommand BattleCommand::FromDecision(const AIDecision& decision)
+{
+  BattleCommand command;
+  if (decision.type == AIDecisionType::EndTurn || decision.type == AIDecisionType::None)
+  {
+	command.kind	  = Kind::EndTurn;
+	command.reasoning = decision.reasoning;
+	return command;
+  }
+  command.kind		   = Kind::AIDecision;
+  command.decision_type = decision.type;
+  if (decision.target != nullptr && decision.target->GetGridPosition() != nullptr)
+	command.tile = decision.target->GetGridPosition()->Get();
+  command.destination  = decision.destination;
+  command.spell		   = decision.abilityName;
+  command.level		   = decision.upcast_level;
+  command.lava_penalty = decision.lava_penalty;
+  command.reasoning	   = decision.reasoning;
+  return command;
+}
+
+std::string BattleCommand::DamageSource() const
+{
+  const bool ai_ability = kind == Kind::AIDecision && decision_type == AIDecisionType::UseAbility;
+  if (ai_ability || kind == Kind::CastSpell || kind == Kind::CastWalls || kind == Kind::CastLavaZones)
+	return spell;
+  return "Attack";
+}
+
+void BattleCommand::Execute(Character* actor) const
+{
+  auto& gs = Engine::GetGameStateManager();
+  if (BattleRecorder* recorder = gs.GetGSComponent<BattleRecorder>())
+	recorder->RecordCommand(actor, *this);
+
+  GridSystem*	grid		 = gs.GetGSComponent<GridSystem>();
+  CombatSystem* combat		 = gs.GetGSComponent<CombatSystem>();
+  SpellSystem*	spell_system = gs.GetGSComponent<SpellSystem>();
+  Character*	target		 = (grid != nullptr && grid->IsValidTile(tile)) ? grid->GetCharacterAt(tile) : nullptr;
+
+  switch (kind)
+  {
+	case Kind::Move: actor->SetPath(tiles); break;
+
+	case Kind::Attack:
+	  if (combat != nullptr && target != nullptr)
+		combat->ExecuteAttack(actor, target);
+	  break;
+
+	case Kind::CastSpell:
+	  if (spell_system != nullptr)
+		spell_system->CastSpell(actor, spell, tile, level);
+	  break;
+
+	case Kind::CastWalls:
+	  if (spell_system != nullptr)
+		spell_system->CastWalls(actor, spell, tiles, level);
+	  break;
+
+	case Kind::CastLavaZones:
+	  if (spell_system != nullptr)
+		spell_system->CastLavaZones(actor, spell, tiles, level);
+	  break;
+
+	case Kind::AIDecision:
+	{
+	  // 리플레이가 어긋나 대상 타일이 비었으면 ExecuteDecision 이 nullptr 을 역참조하지 않도록 건너뛴다
+	  const bool needs_target = decision_type == AIDecisionType::Attack || decision_type == AIDecisionType::UseAbility;
+	  if (needs_target && target == nullptr)
+	  {
+		Engine::GetLogger().LogError(actor->TypeName() + ": no target at (" + std::to_string(tile.x) + ", " + std::to_string(tile.y) + ") - command skipped");
+		break;
+	  }
+	  AISystem* ai = gs.GetGSComponent<AISystem>();
+	  if (ai == nullptr)
+		break;
+	  AIDecision decision;
+	  decision.type		  = decision_type;
+	  decision.target		  = target;
+	  decision.destination  = destination;
+	  decision.abilityName  = spell;
+	  decision.reasoning	  = reasoning;
+	  decision.lava_penalty = lava_penalty;
+	  decision.upcast_level = level;
+	  ai->ExecuteDecision(actor, decision);
+	  break;
+	}
+
+	case Kind::EndTurn:
+	  if (TurnManager* turn_manager = gs.GetGSComponent<TurnManager>())
+		turn_manager->EndCurrentTurn();
+	  break;
+  }
+}
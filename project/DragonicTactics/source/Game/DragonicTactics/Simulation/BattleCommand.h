@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "../StateComponents/AI/IAIStrategy.h"
+#include "./Engine/Vec2.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Character;
+
+/// @brief 전투 상태를 바꾸는 행동 하나 — 플레이어 입력이든 AI 결정이든 이것으로 실행한다
+///
+/// PlayerInputHandler, BattleOrchestrator, BattleSimulator 가 모두 Execute 를 거치므로
+/// BattleRecorder 가 있으면 여기서 빠짐없이 저널에 남고, 리플레이는 저널의 명령을 그대로 다시 Execute 한다.
+/// 캐릭터는 포인터 대신 타일로 가리킨다 (다른 실행에서도 같은 대상을 찾을 수 있도록).
+struct BattleCommand
+{
+  enum class Kind : std::uint8_t
+  {
+	Move,		   // tiles = 경로 (플레이어)
+	Attack,		   // tile = 대상 위치
+	CastSpell,	   // spell, tile, level
+	CastWalls,	   // spell, tiles, level
+	CastLavaZones, // spell, tiles, level
+	AIDecision,	   // AISystem::ExecuteDecision 으로 실행 (decision_type, tile = 대상, destination, spell, level, lava_penalty)
+	EndTurn
+  };
+
+  Kind					   kind = Kind::EndTurn;
+  Math::ivec2			   tile{ -1, -1 };
+  std::vector<Math::ivec2> tiles;
+  std::string			   spell;
+  int					   level		 = 0;
+  AIDecisionType		   decision_type = AIDecisionType::None;
+  Math::ivec2			   destination{ -1, -1 };
+  int					   lava_penalty = 0;
+  std::string			   reasoning; // AI 결정 메모 (로그/디버그 표시용 — 저널에는 쓰지 않는다)
+
+  static BattleCommand FromDecision(const AIDecision& decision);
+
+  /// 피해 집계용 출처 이름: 주문 ID, 기본 공격은 "Attack"
+  std::string DamageSource() const;
+
+  /// actor 의 행동으로 실행한다. BattleRecorder 가 기록 중이면 실행 전에 기록된다
+  void Execute(Character* actor) const;
+};
@@ -0,0 +1,481 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleJournal.h"
+
+#include <iterator>
+
+namespace
+{
+  constexpr std::uint8_t MAGIC[] = { 'D', 'T', 'J' };
+
+  enum RecordType : std::uint8_t
+  {
+	RECORD_COMMAND = 1,
+	RECORD_EVENT,
+	RECORD_CHECKSUM,
+	RECORD_END
+  };
+
+  void PutVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+  {
+	while (value >= 0x80)
+	{
+	  out.push_back(static_cast<std::uint8_t>(value | 0x80));
+	  value >>= 7;
+	}
+	out.push_back(static_cast<std::uint8_t>(value));
+  }
+
+  void PutInt(std::vector<std::uint8_t>& out, std::int64_t value)
+  {
+	// zigzag: -1 → 1, 1 → 2 — 작은 음수(-1 = 없음)도 한 바이트
+	PutVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+  }
+
+  void PutString(std::vector<std::uint8_t>& out, const std::string& text)
+  {
+	PutVarint(out, text.size());
+	out.insert(out.end(), text.begin(), text.end());
+  }
+
+  void PutTile(std::vector<std::uint8_t>& out, Math::ivec2 tile)
+  {
+	PutInt(out, tile.x);
+	PutInt(out, tile.y);
+  }
+
+  void PutU64(std::vector<std::uint8_t>& out, std::uint64_t value)
+  {
+	for (int i = 0; i < 8; ++i)
+	  out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+  }
+
+  /// 읽다가 범위를 넘으면 ok 가 false 가 되고 이후 값은 모두 0
+  struct ByteReader
+  {
+	const std::uint8_t* pos;
+	const std::uint8_t* end;
+	bool				ok = true;
+
+	std::uint64_t Varint()
+	{
+	  std::uint64_t value = 0;
+	  for (int shift = 0; shift < 64; shift += 7)
+	  {
+		if (pos == end)
+		  break;
+		const std::uint8_t byte = *pos++;
+		value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+		  return value;
+	  }
+	  ok = false;
+	  return 0;
+	}
+
+	int Int()
+	{
+	  const std::uint64_t raw = Varint();
+	  return static_cast<int>(static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1));
+	}
+
+	std::string String()
+	{
+	  const std::uint64_t size = Varint();
+	  if (!ok || size > static_cast<std::uint64_t>(end - pos))
+	  {
+		ok = false;
+		return {};
+	  }
+	  std::string text(reinterpret_cast<const char*>(pos), static_cast<std::size_t>(size));
+	  pos += size;
+	  return text;
+	}
+
+	Math::ivec2 Tile()
+	{
+	  const int x = Int();
+	  return { x, Int() };
+	}
+
+	std::uint64_t U64()
+	{
+	  if (end - pos < 8)
+	  {
+		ok = false;
+		return 0;
+	  }
+	  std::uint64_t value = 0;
+	  for (int i = 0; i < 8; ++i)
+		value |= static_cast<std::uint64_t>(*pos++) << (8 * i);
+	  return value;
+	}
+  };
+
+  void PutHeader(std::vector<std::uint8_t>& out, const JournalHeader& header)
+  {
+	PutInt(out, header.dice_seed);
+	PutVarint(out, header.counter_dice ? 1 : 0);
+	PutU64(out, header.dice_stream);
+
+	const MapData& map = header.map;
+	PutString(out, map.id);
+	PutString(out, map.name);
+	PutInt(out, map.width);
+	PutInt(out, map.height);
+	PutVarint(out, map.tiles.size());
+	for (const std::string& row : map.tiles)
+	  PutString(out, row);
+	PutVarint(out, map.legend.size());
+	for (const auto& [symbol, name] : map.legend)
+	{
+	  out.push_back(static_cast<std::uint8_t>(symbol));
+	  PutString(out, name);
+	}
+	PutVarint(out, map.spawn_points.size());
+	for (const auto& [name, tile] : map.spawn_points)
+	{
+	  PutString(out, name);
+	  PutTile(out, tile);
+	}
+	PutVarint(out, map.has_exit ? 1 : 0);
+	PutTile(out, map.exit_position);
+	PutString(out, map.pathfinding);
+	PutInt(out, map.cluster_size);
+  }
+
+  void ReadHeader(ByteReader& in, JournalHeader& header)
+  {
+	header.dice_seed	= in.Int();
+	header.counter_dice = in.Varint() != 0;
+	header.dice_stream	= in.U64();
+
+	MapData& map = header.map;
+	map.id		 = in.String();
+	map.name	 = in.String();
+	map.width	 = in.Int();
+	map.height	 = in.Int();
+	for (std::uint64_t rows = in.Varint(); in.ok && rows > 0; --rows)
+	  map.tiles.push_back(in.String());
+	for (std::uint64_t count = in.Varint(); in.ok && count > 0; --count)
+	{
+	  if (in.pos == in.end)
+	  {
+		in.ok = false;
+		break;
+	  }
+	  const char symbol = static_cast<char>(*in.pos++);
+	  map.legend[symbol] = in.String();
+	}
+	for (std::uint64_t count = in.Varint(); in.ok && count > 0; --count)
+	{
+	  std::string name	   = in.String();
+	  map.spawn_points[name] = in.Tile();
+	}
+	map.has_exit	  = in.Varint() != 0;
+	map.exit_position = in.Tile();
+	map.pathfinding	  = in.String();
+	map.cluster_size  = in.Int();
+  }
+
+  void PutCommand(std::vector<std::uint8_t>& out, const BattleCommand& command)
+  {
+	out.push_back(static_cast<std::uint8_t>(command.kind));
+	switch (command.kind)
+	{
+	  case BattleCommand::Kind::Move:
+		PutVarint(out, command.tiles.size());
+		for (Math::ivec2 tile : command.tiles)
+		  PutTile(out, tile);
+		break;
+	  case BattleCommand::Kind::Attack: PutTile(out, command.tile); break;
+	  case BattleCommand::Kind::CastSpell:
+		PutString(out, command.spell);
+		PutInt(out, command.level);
+		PutTile(out, command.tile);
+		break;
+	  case BattleCommand::Kind::CastWalls:
+	  case BattleCommand::Kind::CastLavaZones:
+		PutString(out, command.spell);
+		PutInt(out, command.level);
+		PutVarint(out, command.tiles.size());
+		for (Math::ivec2 tile : command.tiles)
+		  PutTile(out, tile);
+		break;
+	  case BattleCommand::Kind::AIDecision:
+		out.push_back(static_cast<std::uint8_t>(command.decision_type));
+		PutTile(out, command.tile);
+		PutTile(out, command.destination);
+		PutString(out, command.spell);
+		PutInt(out, command.level);
+		PutInt(out, command.lava_penalty);
+		break;
+	  case BattleCommand::Kind::EndTurn: break;
+	}
+  }
+
+  void ReadTiles(ByteReader& in, std::vector<Math::ivec2>& tiles)
+  {
+	for (std::uint64_t count = in.Varint(); in.ok && count > 0; --count)
+	  tiles.push_back(in.Tile());
+  }
+
+  bool ReadCommand(ByteReader& in, BattleCommand& command)
+  {
+	if (in.pos == in.end)
+	  return false;
+	const std::uint8_t kind = *in.pos++;
+	if (kind > static_cast<std::uint8_t>(BattleCommand::Kind::EndTurn))
+	  return false;
+	command.kind = static_cast<BattleCommand::Kind>(kind);
+	switch (command.kind)
+	{
+	  case BattleCommand::Kind::Move: ReadTiles(in, command.tiles); break;
+	  case BattleCommand::Kind::Attack: command.tile = in.Tile(); break;
+	  case BattleCommand::Kind::CastSpell:
+		command.spell = in.String();
+		command.level = in.Int();
+		command.tile  = in.Tile();
+		break;
+	  case BattleCommand::Kind::CastWalls:
+	  case BattleCommand::Kind::CastLavaZones:
+		command.spell = in.String();
+		command.level = in.Int();
+		ReadTiles(in, command.tiles);
+		break;
+	  case BattleCommand::Kind::AIDecision:
+		if (in.pos == in.end)
+		  return false;
+		command.decision_type = static_cast<AIDecisionType>(*in.pos++);
+		command.tile		  = in.Tile();
+		command.destination	  = in.Tile();
+		command.spell		  = in.String();
+		command.level		  = in.Int();
+		command.lava_penalty  = in.Int();
+		break;
+	  case BattleCommand::Kind::EndTurn: break;
+	}
+	return in.ok;
+  }
+}
+
+const char* JournalEventName(JournalEvent kind)
+{
+  switch (kind)
+  {
+	case JournalEvent::TurnStarted: return "TurnStarted";
+	case JournalEvent::Damaged: return "Damaged";
+	case JournalEvent::Healed: return "Healed";
+	case JournalEvent::Death: return "Death";
+	case JournalEvent::Moved: return "Moved";
+	case JournalEvent::SpellCast: return "SpellCast";
+	case JournalEvent::StatusAdded: return "StatusAdded";
+	case JournalEvent::StatusRemoved: return "StatusRemoved";
+	default: return "Unknown";
+  }
+}
+
+bool BattleJournal::Open(const std::string& path, const JournalHeader& header)
+{
+  if (file_.is_open())
+	Close(false);
+  file_.open(path, std::ios::binary | std::ios::trunc);
+  if (!file_.is_open())
+	return false;
+
+  pending_.clear();
+  bytes_written_ = 0;
+  pending_.insert(pending_.end(), std::begin(MAGIC), std::end(MAGIC));
+  pending_.push_back(VERSION);
+  PutHeader(pending_, header);
+  Flush();
+  return true;
+}
+
+bool BattleJournal::IsOpen() const
+{
+  return file_.is_open();
+}
+
+void BattleJournal::Close(bool battle_finished)
+{
+  if (!file_.is_open())
+	return;
+  if (battle_finished)
+  {
+	BeginRecord();
+	EndRecord(RECORD_END);
+  }
+  Flush();
+  file_.close();
+}
+
+void BattleJournal::WriteCommand(int actor, const BattleCommand& command)
+{
+  if (!file_.is_open())
+	return;
+  BeginRecord();
+  PutInt(record_, actor);
+  PutCommand(record_, command);
+  EndRecord(RECORD_COMMAND);
+}
+
+void BattleJournal::WriteEvent(JournalEvent kind, std::initializer_list<int> values, const std::string& text)
+{
+  if (!file_.is_open())
+	return;
+  BeginRecord();
+  record_.push_back(static_cast<std::uint8_t>(kind));
+  PutVarint(record_, values.size());
+  for (const int value : values)
+	PutInt(record_, value);
+  PutString(record_, text);
+  EndRecord(RECORD_EVENT);
+}
+
+void BattleJournal::WriteChecksum(const JournalChecksumRecord& record)
+{
+  if (!file_.is_open())
+	return;
+  BeginRecord();
+  PutInt(record_, record.turn);
+  PutInt(record_, record.round);
+  PutInt(record_, record.actor);
+  PutU64(record_, record.checksum);
+  EndRecord(RECORD_CHECKSUM);
+}
+
+void BattleJournal::Flush()
+{
+  if (!file_.is_open() || pending_.empty())
+	return;
+  file_.write(reinterpret_cast<const char*>(pending_.data()), static_cast<std::streamsize>(pending_.size()));
+  file_.flush();
+  bytes_written_ += pending_.size();
+  pending_.clear();
+}
+
+std::size_t BattleJournal::GetBytesWritten() const
+{
+  return bytes_written_ + pending_.size();
+}
+
+void BattleJournal::BeginRecord()
+{
+  record_.clear();
+}
+
+void BattleJournal::EndRecord(std::uint8_t type)
+{
+  pending_.push_back(type);
+  PutVarint(pending_, record_.size());
+  pending_.insert(pending_.end(), record_.begin(), record_.end());
+}
+
+bool BattleJournal::Load(const std::string& path, JournalData& out, std::string& error)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file.is_open())
+  {
+	error = "cannot open " + path;
+	return false;
+  }
+  const std::vector<std::uint8_t> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+  return Parse(bytes, out, error);
+}
+
+bool BattleJournal::Parse(const std::vector<std::uint8_t>& bytes, JournalData& out, std::string& error)
+{
+  out = JournalData{};
+  if (bytes.size() < 4 || !std::equal(std::begin(MAGIC), std::end(MAGIC), bytes.begin()))
+  {
+	error = "not a battle journal";
+	return false;
+  }
+  if (bytes[3] != VERSION)
+  {
+	error = "unsupported journal version " + std::to_string(bytes[3]);
+	return false;
+  }
+
+  ByteReader in{ bytes.data() + 4, bytes.data() + bytes.size() };
+  ReadHeader(in, out.header);
+  if (!in.ok)
+  {
+	error = "journal header is truncated";
+	return false;
+  }
+
+  int sequence = 0;
+  while (in.pos != in.end && !out.finished)
+  {
+	const std::uint8_t	type = *in.pos++;
+	const std::uint64_t size = in.Varint();
+	if (!in.ok || size > static_cast<std::uint64_t>(in.end - in.pos))
+	{
+	  out.truncated = true;
+	  break;
+	}
+	ByteReader record{ in.pos, in.pos + size };
+	in.pos += size;
+
+	switch (type)
+	{
+	  case RECORD_COMMAND:
+	  {
+		JournalCommandRecord command;
+		command.sequence = sequence;
+		command.actor	 = record.Int();
+		if (!ReadCommand(record, command.command))
+		{
+		  error = "corrupt command record #" + std::to_string(sequence);
+		  return false;
+		}
+		out.commands.push_back(std::move(command));
+		break;
+	  }
+	  case RECORD_EVENT:
+	  {
+		JournalEventRecord event;
+		event.sequence = sequence;
+		event.kind	   = static_cast<JournalEvent>(record.pos != record.end ? *record.pos++ : 0);
+		for (std::uint64_t count = record.Varint(); record.ok && count > 0; --count)
+		  event.values.push_back(record.Int());
+		event.text = record.String();
+		if (!record.ok)
+		{
+		  error = "corrupt event record #" + std::to_string(sequence);
+		  return false;
+		}
+		out.events.push_back(std::move(event));
+		break;
+	  }
+	  case RECORD_CHECKSUM:
+	  {
+		JournalChecksumRecord checksum;
+		checksum.sequence = sequence;
+		checksum.turn	  = record.Int();
+		checksum.round	  = record.Int();
+		checksum.actor	  = record.Int();
+		checksum.checksum = record.U64();
+		if (!record.ok)
+		{
+		  error = "corrupt checksum record #" + std::to_string(sequence);
+		  return false;
+		}
+		out.checksums.push_back(checksum);
+		break;
+	  }
+	  case RECORD_END: out.finished = true; break;
+	  default: break; // 이후 버전의 레코드 — 길이만큼 건너뛴다
+	}
+	++sequence;
+  }
+  return true;
+}
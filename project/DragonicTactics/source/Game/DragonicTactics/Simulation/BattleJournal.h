@@ -0,0 +1,110 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "../StateComponents/MapDataRegistry.h"
+#include "BattleCommand.h"
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+/// 저널에 남기는 전투 이벤트 (Types/Events.h 의 이벤트를 정수로 줄인 것 — 캐릭터는 로스터 번호, 없으면 -1)
+enum class JournalEvent : std::uint8_t
+{
+  TurnStarted,	// unit, turn
+  Damaged,		// target, amount, remaining_hp, attacker
+  Healed,		// target, amount, current_hp, healer
+  Death,		// unit, killer
+  Moved,		// unit, from.x, from.y, to.x, to.y
+  SpellCast,	// caster, level, target.x, target.y   (text = 주문 ID)
+  StatusAdded,	// target, duration, magnitude         (text = 효과 이름)
+  StatusRemoved // target                              (text = 효과 이름)
+};
+
+const char* JournalEventName(JournalEvent kind);
+
+/// 리플레이에 필요한 시작 조건 — 맵은 maps.json 이 바뀌어도 재현되도록 통째로 넣는다
+struct JournalHeader
+{
+  int			dice_seed	 = 100;
+  bool			counter_dice = false;
+  std::uint64_t dice_stream	 = 0;
+  MapData		map;
+};
+
+struct JournalCommandRecord
+{
+  int			sequence = 0; // 파일 안의 레코드 순서 (덤프에서 종류별 목록을 다시 섞을 때 쓴다)
+  int			actor	 = -1;
+  BattleCommand command;
+};
+
+struct JournalEventRecord
+{
+  int			   sequence = 0;
+  JournalEvent	   kind		= JournalEvent::TurnStarted;
+  std::vector<int> values;
+  std::string	   text;
+};
+
+/// 턴 경계(TurnStartedEvent)마다 남기는 전투 상태 체크섬
+struct JournalChecksumRecord
+{
+  int			sequence = 0;
+  int			turn	 = 0; // 전투 시작부터 센 턴 번호 (0 = 첫 턴)
+  int			round	 = 0;
+  int			actor	 = -1;
+  std::uint64_t checksum = 0;
+};
+
+struct JournalData
+{
+  JournalHeader						 header;
+  std::vector<JournalCommandRecord>	 commands;
+  std::vector<JournalEventRecord>	 events;
+  std::vector<JournalChecksumRecord> checksums;
+  bool								 finished  = false; // End 레코드까지 있음
+  bool								 truncated = false; // 마지막 레코드가 잘림 (기록 중 크래시) — 그 앞까지는 유효
+};
+
+/// @brief 전투 저널(.dtj) 바이너리 기록기
+///
+/// 형식: "DTJ" + 버전 바이트, 헤더, 그 뒤로 [종류 1바이트][길이 varint][내용] 레코드가 이어진다.
+/// 정수는 zigzag varint 라서 명령 하나가 보통 10바이트 안팎이다.
+/// 레코드는 메모리 버퍼에 쌓았다가 Flush (턴 경계마다) 에 파일로 내보내므로 기록 비용이 프레임에 거의 보이지 않고,
+/// 크래시가 나도 마지막으로 끝난 턴까지는 파일에 남는다.
+class BattleJournal
+{
+  public:
+  static constexpr std::uint8_t VERSION = 1;
+
+  bool Open(const std::string& path, const JournalHeader& header);
+  bool IsOpen() const;
+  /// End 레코드를 쓰고 닫는다. battle_finished 가 false 면 End 없이 닫는다 (중단된 기록)
+  void Close(bool battle_finished);
+
+  void WriteCommand(int actor, const BattleCommand& command);
+  void WriteEvent(JournalEvent kind, std::initializer_list<int> values, const std::string& text = {});
+  void WriteChecksum(const JournalChecksumRecord& record);
+  void Flush();
+
+  std::size_t GetBytesWritten() const;
+
+  /// 파일 전체를 읽는다. 형식이 틀리면 false 와 error, 끝이 잘린 것은 truncated 로 표시하고 true
+  static bool Load(const std::string& path, JournalData& out, std::string& error);
+  static bool Parse(const std::vector<std::uint8_t>& bytes, JournalData& out, std::string& error);
+
+  private:
+  void BeginRecord();
+  void EndRecord(std::uint8_t type);
+
+  std::ofstream				file_;
+  std::vector<std::uint8_t> pending_; // 아직 파일로 내보내지 않은 레코드
+  std::vector<std::uint8_t> record_;  // 작성 중인 레코드 내용
+  std::size_t				bytes_written_ = 0;
+};
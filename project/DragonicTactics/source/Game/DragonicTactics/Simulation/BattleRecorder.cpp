@@ -0,0 +1,170 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleRecorder.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include "./Engine/Logger.h"
+
+#include "../Objects/Character.h"
+#include "../StateComponents/BattleHash.h"
+#include "../StateComponents/GridSystem.h"
+#include "../StateComponents/TurnManager.h"
+#include "../StateComponents/Zobrist.h"
+#include "../Types/Events.h"
+
+void BattleRecorder::SetRoster(const std::vector<Character*>& roster)
+{
+  roster_ = roster;
+}
+
+bool BattleRecorder::StartRecording(const std::string& path, const JournalHeader& header, EventBus* event_bus)
+{
+  verifying_ = false;
+  if (!journal_.Open(path, header))
+  {
+	Engine::GetLogger().LogError("BattleRecorder: cannot open " + path);
+	return false;
+  }
+  Subscribe(event_bus);
+  Engine::GetLogger().LogEvent("BattleRecorder: recording to " + path);
+  return true;
+}
+
+void BattleRecorder::StartVerifying(const JournalData& expected, EventBus* event_bus)
+{
+  journal_.Close(false);
+  verifying_ = true;
+  expected_	 = expected.checksums;
+  Subscribe(event_bus);
+}
+
+void BattleRecorder::Stop(bool battle_finished)
+{
+  subscriptions_.clear();
+  journal_.Close(battle_finished);
+}
+
+void BattleRecorder::Subscribe(EventBus* event_bus)
+{
+  subscriptions_.clear();
+  turn_			= 0;
+  verification_ = Verification{};
+  if (event_bus == nullptr)
+	return;
+
+  subscriptions_.push_back(event_bus->Subscribe<TurnStartedEvent>([this](const TurnStartedEvent& e) { OnTurnStarted(e.character); }));
+  if (verifying_)
+	return;
+
+  // 이벤트 스트림은 덤프/비교용 — 리플레이 자체는 명령과 주사위 시드만으로 재현된다
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDamagedEvent>(
+	[this](const CharacterDamagedEvent& e)
+	{ journal_.WriteEvent(JournalEvent::Damaged, { UnitIndex(e.target), e.damageAmount, e.remainingHP, UnitIndex(e.attacker) }); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterHealedEvent>(
+	[this](const CharacterHealedEvent& e) { journal_.WriteEvent(JournalEvent::Healed, { UnitIndex(e.target), e.healAmount, e.currentHP, UnitIndex(e.healer) }); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDeathEvent>(
+	[this](const CharacterDeathEvent& e) { journal_.WriteEvent(JournalEvent::Death, { UnitIndex(e.character), UnitIndex(e.killer) }); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterMovedEvent>(
+	[this](const CharacterMovedEvent& e)
+	{ journal_.WriteEvent(JournalEvent::Moved, { UnitIndex(e.character), e.fromGrid.x, e.fromGrid.y, e.toGrid.x, e.toGrid.y }); }));
+  subscriptions_.push_back(event_bus->Subscribe<SpellCastEvent>(
+	[this](const SpellCastEvent& e)
+	{ journal_.WriteEvent(JournalEvent::SpellCast, { UnitIndex(e.caster), e.spellLevel, e.targetGrid.x, e.targetGrid.y }, e.spellName); }));
+  subscriptions_.push_back(event_bus->Subscribe<StatusEffectAddedEvent>(
+	[this](const StatusEffectAddedEvent& e) { journal_.WriteEvent(JournalEvent::StatusAdded, { UnitIndex(e.target), e.duration, e.magnitude }, e.effectName); }));
+  subscriptions_.push_back(event_bus->Subscribe<StatusEffectRemovedEvent>(
+	[this](const StatusEffectRemovedEvent& e) { journal_.WriteEvent(JournalEvent::StatusRemoved, { UnitIndex(e.target) }, e.effectName); }));
+}
+
+void BattleRecorder::OnTurnStarted(Character* character)
+{
+  const TurnManager* turn_manager = Engine::GetGameStateManager().GetGSComponent<TurnManager>();
+  const int		   round		= turn_manager != nullptr ? turn_manager->GetRoundNumber() : 0;
+  const int		   turn			= turn_++;
+  const JournalChecksumRecord record{ 0, turn, round, UnitIndex(character), ComputeChecksum(round) };
+
+  if (!verifying_)
+  {
+	journal_.WriteEvent(JournalEvent::TurnStarted, { record.actor, turn });
+	journal_.WriteChecksum(record);
+	journal_.Flush(); // 턴 경계마다 파일로 — 크래시가 나도 끝난 턴까지는 남는다
+	return;
+  }
+
+  if (static_cast<std::size_t>(turn) >= expected_.size())
+	return;
+  const JournalChecksumRecord& expected = expected_[static_cast<std::size_t>(turn)];
+  ++verification_.checked;
+  if (expected.checksum == record.checksum && expected.actor == record.actor && expected.round == record.round)
+	return;
+
+  ++verification_.mismatches;
+  if (verification_.first_mismatch_turn < 0)
+  {
+	verification_.first_mismatch_turn = turn;
+	Engine::GetLogger().LogError("BattleRecorder: replay desync at turn " + std::to_string(turn) + " (round " + std::to_string(round) + ", unit " +
+								 std::to_string(record.actor) + ", expected unit " + std::to_string(expected.actor) + ")");
+  }
+}
+
+void BattleRecorder::RecordCommand(Character* actor, const BattleCommand& command)
+{
+  if (journal_.IsOpen())
+	journal_.WriteCommand(UnitIndex(actor), command);
+}
+
+bool BattleRecorder::IsRecording() const
+{
+  return journal_.IsOpen();
+}
+
+bool BattleRecorder::IsVerifying() const
+{
+  return verifying_;
+}
+
+const BattleRecorder::Verification& BattleRecorder::GetVerification() const
+{
+  return verification_;
+}
+
+std::size_t BattleRecorder::GetBytesWritten() const
+{
+  return journal_.GetBytesWritten();
+}
+
+int BattleRecorder::UnitIndex(const Character* character) const
+{
+  const auto it = std::find(roster_.begin(), roster_.end(), character);
+  return it != roster_.end() ? static_cast<int>(it - roster_.begin()) : -1;
+}
+
+std::uint64_t BattleRecorder::ComputeChecksum(int round)
+{
+  const GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  std::uint64_t		h	 = Zobrist::Mix(static_cast<std::uint64_t>(round));
+  if (grid == nullptr)
+	return h;
+
+  const std::vector<Character*>& occupants = grid->GetOccupants();
+  for (int y = 0; y < grid->GetHeight(); ++y)
+  {
+	for (int x = 0; x < grid->GetWidth(); ++x)
+	{
+	  const Math::ivec2 tile{ x, y };
+	  const std::size_t index	  = static_cast<std::size_t>(grid->TileIndex(tile));
+	  Character*		occupant = index < occupants.size() ? occupants[index] : nullptr;
+	  h = Zobrist::Mix(h ^ static_cast<std::uint64_t>(grid->GetTileType(tile)));
+	  if (occupant != nullptr)
+		h = Zobrist::Mix(h ^ Zobrist::Mix(static_cast<std::uint64_t>(index)) ^ BattleHash::UnitStateHash(occupant));
+	}
+  }
+  return h;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Component.h"
+#include "../StateComponents/EventBus.h"
+#include "BattleJournal.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Character;
+
+/// @brief 전투를 저널로 기록하거나, 리플레이 중에 저널의 체크섬과 대조하는 GameState 컴포넌트
+///
+/// BattleCommand::Execute 가 명령을 넘기고, 나머지(이벤트, 턴 경계 체크섬)는 EventBus 구독으로 받는다.
+/// 캐릭터는 로스터(스폰 순서) 번호로 기록하므로 포인터 값과 무관하게 다른 실행과 비교할 수 있다.
+/// 구독은 TurnManager::StartCombat 전에 걸어야 첫 턴의 체크섬이 남는다.
+class BattleRecorder : public CS230::Component
+{
+  public:
+  static constexpr const char* DEFAULT_PATH = "battle_journal.dtj";
+
+  struct Verification
+  {
+	int checked				= 0; // 비교한 턴 경계 수
+	int mismatches			= 0;
+	int first_mismatch_turn = -1;
+  };
+
+  void SetRoster(const std::vector<Character*>& roster);
+  bool StartRecording(const std::string& path, const JournalHeader& header, EventBus* event_bus);
+  void StartVerifying(const JournalData& expected, EventBus* event_bus);
+  /// 기록을 닫는다. battle_finished 면 End 레코드를 남긴다
+  void Stop(bool battle_finished);
+
+  void RecordCommand(Character* actor, const BattleCommand& command);
+
+  bool				  IsRecording() const;
+  bool				  IsVerifying() const;
+  const Verification& GetVerification() const;
+  std::size_t		  GetBytesWritten() const;
+  int				  UnitIndex(const Character* character) const;
+
+  /// 로스터 번호만 쓰는 전투 상태 체크섬: 라운드 + 타일 종류 + 칸마다 (캐릭터 종류, BattleHash::UnitStateHash)
+  static std::uint64_t ComputeChecksum(int round);
+
+  private:
+  void Subscribe(EventBus* event_bus);
+  void OnTurnStarted(Character* character);
+
+  BattleJournal						 journal_;
+  std::vector<Character*>			 roster_;
+  std::vector<JournalChecksumRecord> expected_;
+  bool								 verifying_ = false;
+  int								 turn_		= 0;
+  Verification						 verification_;
+  std::vector<EventBus::Subscription> subscriptions_;
+};
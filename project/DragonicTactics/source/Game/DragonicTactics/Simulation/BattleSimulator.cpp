@@ -0,0 +1,318 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleSimulator.h"
+#include "BattleCommand.h"
+#include "BattleRecorder.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameObjectManager.h"
+#include "./Engine/GameState.h"
+#include "./Engine/GameStateManager.h"
+#include "./Engine/Logger.h"
+#include "./Engine/Timer.h"
+
+#include "../Factories/CharacterFactory.h"
+#include "../Objects/Character.h"
+#include "../Objects/Components/MovementComponent.h"
+#include "../StateComponents/AISystem.h"
+#include "../StateComponents/BattleHash.h"
+#include "../StateComponents/CombatSystem.h"
+#include "../StateComponents/DataRegistry.h"
+#include "../StateComponents/DiceManager.h"
+#include "../StateComponents/EventBus.h"
+#include "../StateComponents/GridSystem.h"
+#include "../StateComponents/MapDataRegistry.h"
+#include "../StateComponents/SpellSystem.h"
+#include "../StateComponents/StatusEffectHandler.h"
+#include "../StateComponents/TurnManager.h"
+#include <set>
+
+namespace
+{
+  // 한 번의 Update 로 MovementComponent 가 한 칸 이동하고 (타일당 0.2초)
+  // SpellSystem 의 지연 효과(0.5초)가 바로 적용되도록 넉넉한 고정 dt 를 쓴다
+  constexpr double SIMULATION_STEP = 1.0;
+
+  // 이동 경로는 이동력 이하지만, 혹시 모를 무한 루프 방지
+  constexpr int MAX_STEPS_PER_ACTION = 64;
+
+  /// GamePlay::Load 에서 렌더링/UI/입력/디버그 구성요소를 뺀 전투 상태
+  class BattleSimulationState : public CS230::GameState
+  {
+	public:
+	void Load() override
+	{
+	  AddGSComponent(new EventBus());
+	  AddGSComponent(new DiceManager());
+	  AddGSComponent(new AISystem());
+	  AddGSComponent(new BattleHash());
+	  AddGSComponent(new CombatSystem());
+	  AddGSComponent(new CS230::GameObjectManager());
+	  AddGSComponent(new GridSystem());
+	  AddGSComponent(new TurnManager());
+	  AddGSComponent(new CharacterFactory());
+	  AddGSComponent(new DataRegistry());
+	  AddGSComponent(new MapDataRegistry());
+	  AddGSComponent(new SpellSystem());
+	  AddGSComponent(new StatusEffectHandler());
+	  AddGSComponent(new BattleRecorder());
+
+	  GetGSComponent<EventBus>()->Clear();
+	  GetGSComponent<CombatSystem>()->SetDiceManager(GetGSComponent<DiceManager>());
+	  GetGSComponent<DataRegistry>()->LoadFromFile("Assets/Data/characters.json");
+	  GetGSComponent<DataRegistry>()->LoadAllCharacterData("Assets/Data/characters.json");
+	  GetGSComponent<SpellSystem>()->LoadFromCSV("Assets/Data/spell_table.csv");
+	}
+
+	void Update(double dt) override
+	{
+	  GetGSComponent<CS230::GameObjectManager>()->UpdateAll(dt);
+	  UpdateGSComponents(dt);
+	}
+
+	void Unload() override
+	{
+	  GetGSComponent<CS230::GameObjectManager>()->Unload();
+	  ClearGSComponents();
+	}
+
+	void Draw() override
+	{
+	}
+
+	void DrawImGui() override
+	{
+	}
+
+	gsl::czstring GetName() const override
+	{
+	  return "BattleSimulation";
+	}
+  };
+
+  Character* Spawn(CharacterTypes type, Math::ivec2 position)
+  {
+	auto&		gs	 = Engine::GetGameStateManager();
+	GridSystem* grid = gs.GetGSComponent<GridSystem>();
+	auto		ptr	 = CharacterFactory::Create(type, position);
+	Character*	raw	 = ptr.get();
+	raw->SetGridSystem(grid);
+	gs.GetGSComponent<CS230::GameObjectManager>()->Add(std::move(ptr));
+	grid->AddCharacter(raw, position);
+	return raw;
+  }
+}
+
+BattleResult BattleSimulator::Run(const BattleSettings& settings)
+{
+  BattleResult result;
+  util::Timer	timer;
+
+  auto& gs = Engine::GetGameStateManager();
+  gs.PushState<BattleSimulationState>();
+
+  GridSystem*  grid	   = gs.GetGSComponent<GridSystem>();
+  TurnManager* turn_mgr = gs.GetGSComponent<TurnManager>();
+  AISystem*	   ai	   = gs.GetGSComponent<AISystem>();
+  EventBus*	   bus	   = gs.GetGSComponent<EventBus>();
+
+  BattleRecorder* recorder = gs.GetGSComponent<BattleRecorder>();
+  ai->Init(settings.ai);
+
+  // 리플레이는 기록 당시의 주사위 설정과 맵을 저널 헤더에서 가져온다
+  JournalHeader header;
+  if (settings.replay != nullptr)
+	header = settings.replay->header;
+  else
+  {
+	header.dice_seed	= settings.dice_seed;
+	header.counter_dice = settings.counter_dice;
+	header.dice_stream	= settings.dice_stream;
+  }
+  if (header.counter_dice)
+	gs.GetGSComponent<DiceManager>()->SetCounterStream(static_cast<std::uint64_t>(header.dice_seed), header.dice_stream);
+  else
+	gs.GetGSComponent<DiceManager>()->SetSeed(header.dice_seed);
+
+  MapData map_data;
+  if (settings.replay != nullptr)
+  {
+	map_data = header.map;
+  }
+  else if (settings.map_id.empty())
+  {
+	map_data = MapGenerator::Generate(settings.procedural);
+  }
+  else
+  {
+	auto* map_registry = gs.GetGSComponent<MapDataRegistry>();
+	map_registry->LoadMaps("Assets/Data/maps.json");
+	map_data = map_registry->GetMapData(settings.map_id);
+  }
+  if (map_data.id.empty())
+  {
+	Engine::GetLogger().LogError("BattleSimulator: map not found - " + settings.map_id);
+	gs.Clear();
+	return result;
+  }
+  grid->LoadMap(map_data);
+
+  Character*			  dragon = nullptr;
+  std::vector<Character*> invaders;
+  const std::pair<const char*, CharacterTypes> spawns[] = {
+	{ "dragon", CharacterTypes::Dragon },
+	{ "fighter", CharacterTypes::Fighter },
+	{ "cleric", CharacterTypes::Cleric }
+  };
+  for (const auto& [name, type] : spawns)
+  {
+	auto it = map_data.spawn_points.find(name);
+	if (it == map_data.spawn_points.end())
+	  continue;
+	Character* character = Spawn(type, it->second);
+	if (type == CharacterTypes::Dragon)
+	  dragon = character;
+	else
+	  invaders.push_back(character);
+  }
+  if (dragon == nullptr || invaders.empty())
+  {
+	Engine::GetLogger().LogError("BattleSimulator: map " + map_data.id + " has no dragon or invader spawn");
+	gs.Clear();
+	return result;
+  }
+
+  // 죽은 캐릭터는 GameObjectManager 가 곧 해제하므로 포인터는 이 집합으로만 판단한다
+  std::set<Character*> dead;
+  std::string			 damage_source = "Environment";
+  bool					 finished	   = false;
+
+  // 아래 람다가 지역 변수를 참조하므로 그보다 먼저 해지되도록 뒤에 선언한다
+  std::vector<EventBus::Subscription> subscriptions;
+
+  subscriptions.push_back(bus->Subscribe<CharacterDamagedEvent>(
+	[&](const CharacterDamagedEvent& event)
+	{ result.damage_by_source[event.attacker != nullptr ? damage_source : "Environment"] += event.damageAmount; }));
+
+  subscriptions.push_back(bus->Subscribe<CharacterDeathEvent>(
+	[&](const CharacterDeathEvent& event)
+	{
+	  if (event.character == nullptr)
+		return;
+	  dead.insert(event.character);
+	  turn_mgr->RemoveFromTurnOrder(event.character);
+	  if (event.character == dragon)
+	  {
+		result.winner = BattleWinner::Invaders;
+		finished	  = true;
+	  }
+	  else if (std::all_of(invaders.begin(), invaders.end(), [&](Character* c) { return dead.count(c) > 0; }))
+	  {
+		result.winner = BattleWinner::Dragon;
+		finished	  = true;
+	  }
+	}));
+
+  gs.GetGSComponent<BattleHash>()->Subscribe(bus);
+
+  std::vector<Character*> turn_order = { dragon };
+  turn_order.insert(turn_order.end(), invaders.begin(), invaders.end());
+
+  recorder->SetRoster(turn_order);
+  if (settings.replay != nullptr)
+	recorder->StartVerifying(*settings.replay, bus);
+  else if (!settings.record_path.empty())
+  {
+	header.map = map_data;
+	recorder->StartRecording(settings.record_path, header, bus);
+  }
+  turn_mgr->SetEventBus(bus);
+  turn_mgr->InitializeTurnOrder(turn_order);
+  turn_mgr->StartCombat();
+
+  int		  actions_this_turn = 0;
+  std::size_t replay_cursor		= 0;
+  while (!finished && turn_mgr->IsCombatActive() && turn_mgr->GetRoundNumber() <= settings.max_rounds)
+  {
+	Character* current = turn_mgr->GetCurrentCharacter();
+	if (current == nullptr || dead.count(current) > 0)
+	  break;
+
+	BattleCommand command;
+	if (settings.replay != nullptr)
+	{
+	  if (replay_cursor >= settings.replay->commands.size())
+		break; // 저널 끝 (기록이 중간에 끊긴 전투)
+	  const JournalCommandRecord& record = settings.replay->commands[replay_cursor++];
+	  if (record.actor != recorder->UnitIndex(current))
+	  {
+		Engine::GetLogger().LogError("BattleSimulator: replay diverged - command #" + std::to_string(replay_cursor - 1) + " belongs to unit " +
+									 std::to_string(record.actor) + ", current unit is " + std::to_string(recorder->UnitIndex(current)));
+		result.replay_diverged = true;
+		break;
+	  }
+	  command = record.command;
+	}
+	else if (actions_this_turn < settings.max_actions_per_turn)
+	  command = BattleCommand::FromDecision(ai->MakeDecision(current));
+	else
+	  command.reasoning = "Action limit";
+
+	if (command.kind == BattleCommand::Kind::EndTurn)
+	{
+	  command.Execute(current); // 다음 턴 시작 시 용암 피해로 전투가 끝날 수 있다
+	  ++result.turns;
+	  actions_this_turn = 0;
+	  continue;
+	}
+
+	damage_source = command.DamageSource();
+	command.Execute(current);
+	++result.actions;
+	++actions_this_turn;
+
+	// 이동과 지연 스펠 효과를 프레임 간격 없이 끝까지 진행
+	for (int step = 0; step < MAX_STEPS_PER_ACTION; ++step)
+	{
+	  gs.Update(SIMULATION_STEP);
+	  if (finished || dead.count(current) > 0)
+		break;
+	  MovementComponent* movement = current->GetGOComponent<MovementComponent>();
+	  if (movement == nullptr || !movement->IsMoving())
+		break;
+	}
+	damage_source = "Environment";
+  }
+
+  recorder->Stop(true); // 승패가 나거나 라운드 제한까지 진행한 전투 — End 레코드를 남긴다
+  const BattleRecorder::Verification& verification = recorder->GetVerification();
+  result.checksums_verified  = verification.checked;
+  result.checksum_mismatches = verification.mismatches;
+  result.first_mismatch_turn = verification.first_mismatch_turn;
+
+  result.rounds			= turn_mgr->GetRoundNumber();
+  result.dragon_hp_left = dead.count(dragon) > 0 ? 0 : dragon->GetHP();
+  const SearchStats search = ai->GetSearchStats();
+  result.search_nodes	 = search.nodes;
+  result.search_seconds	 = search.seconds;
+  gs.Clear();
+  result.seconds = timer.GetElapsedSeconds();
+  return result;
+}
+
+const char* BattleSimulator::WinnerName(BattleWinner winner)
+{
+  switch (winner)
+  {
+	case BattleWinner::Dragon: return "Dragon";
+	case BattleWinner::Invaders: return "Invaders";
+	case BattleWinner::Draw:
+	default: return "Draw";
+  }
+}
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "../Factories/MapGenerator.h"
+#include "../StateComponents/AISystem.h"
+#include "BattleJournal.h"
+#include <cstdint>
+#include <map>
+#include <string>
+
+/// @brief 헤드리스 전투 한 판의 설정
+struct BattleSettings
+{
+  std::string			map_id;					   // maps.json 의 id. 비어 있으면 procedural 로 생성
+  ProceduralMapSettings procedural;				   // map_id 가 비었을 때 사용
+  int					dice_seed			 = 100; // DiceManager::SetSeed (GamePlay 기본값과 같음)
+  bool					counter_dice		 = false; // true 면 (dice_seed, dice_stream) counter-based 스트림 — 병렬 실행에서도 재현 가능
+  std::uint64_t			dice_stream			 = 0;
+  int					max_rounds			 = 200; // 넘으면 무승부
+  int					max_actions_per_turn = 32;	// 같은 결정을 반복하는 AI 가 턴을 끝내지 못할 때의 안전장치
+  AIStrategyConfig		ai;							// 타입별 탐색 전략 선택 (기본: 모두 스크립트 전략)
+  std::string			record_path;				// 비어 있지 않으면 이 경로에 전투 저널(.dtj) 기록
+  const JournalData*	replay = nullptr;			// 있으면 맵/주사위는 저널 헤더, 행동은 AI 대신 저널 명령으로 — 턴마다 체크섬 대조
+};
+
+enum class BattleWinner
+{
+  Dragon,
+  Invaders,
+  Draw
+};
+
+/// @brief 전투 결과 — 밸런스 집계용
+struct BattleResult
+{
+  BattleWinner winner		  = BattleWinner::Draw;
+  int		   rounds		  = 0;
+  int		   turns		  = 0;
+  int		   actions		  = 0; // 실행한 AI 결정 수 (EndTurn 제외)
+  int		   dragon_hp_left = 0;
+  double	   seconds		  = 0.0;
+  long long	   search_nodes	  = 0;	 // SearchStrategy 가 전개한 노드 수
+  double	   search_seconds = 0.0; // SearchStrategy 결정에 쓴 시간
+
+  // 리플레이 검증 (settings.replay 가 있을 때)
+  int  checksums_verified	= 0;
+  int  checksum_mismatches = 0;
+  int  first_mismatch_turn = -1;
+  bool replay_diverged	   = false; // 저널 명령의 행동 주체가 현재 턴 캐릭터와 다름 — 거기서 중단
+
+  /// 피해 출처별 총 피해량: 스펠 ID, 기본 공격은 "Attack", 용암 등 공격자 없는 피해는 "Environment"
+  std::map<std::string, int> damage_by_source;
+};
+
+/// @brief 렌더링/입력/프레임 간격 없이 모든 진영을 AI 로 돌려 전투를 끝까지 진행한다
+///
+/// GamePlay::Load 와 같은 StateComponent 들을 가진 상태를 GameStateManager 에 올리고,
+/// 드래곤을 포함한 모든 캐릭터의 턴을 AISystem::MakeDecision 으로 정하고 BattleCommand 로 실행한다.
+/// settings.replay 가 있으면 결정 대신 저널의 명령을 순서대로 실행한다 (렌더링 없이 최대 속도 리플레이).
+/// 이동 애니메이션은 MovementComponent 의 타일당 시간만큼 dt 를 한 번에 넘겨서 즉시 끝낸다.
+/// Engine::StartHeadless() 이후, 상태 스택을 독점하는 도구에서 호출해야 한다 (끝나면 스택을 비운다).
+class BattleSimulator
+{
+  public:
+  static BattleResult Run(const BattleSettings& settings);
+
+  static const char* WinnerName(BattleWinner winner);
+};
@@ -0,0 +1,290 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleState.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+
+#include "../Objects/Character.h"
+#include "../Objects/Components/ActionPoints.h"
+#include "../Objects/Components/GridPosition.h"
+#include "../Objects/Components/SpellSlots.h"
+#include "../Objects/Components/StatsComponent.h"
+#include "../Objects/Components/StatusEffectComponent.h"
+#include "../StateComponents/SpellSystem.h"
+#include "../StateComponents/TurnManager.h"
+#include <cstring>
+
+int BattleState::UnitAt(Math::ivec2 tile) const
+{
+  for (int i = 0; i < unit_count; ++i)
+  {
+	const Unit& unit = units[i];
+	if (unit.IsAlive() && unit.position == tile)
+	  return i;
+  }
+  return -1;
+}
+
+namespace
+{
+  /// "NdM" → (N, M). 형식이 다르면 (0, 0)
+  void ParseDice(const std::string& notation, int& count, int& sides)
+  {
+	count					= 0;
+	sides					= 0;
+	const std::size_t d_pos = notation.find('d');
+	if (d_pos == std::string::npos || d_pos + 1 >= notation.size())
+	  return;
+	try
+	{
+	  count = d_pos > 0 ? std::stoi(notation.substr(0, d_pos)) : 1;
+	  sides = std::stoi(notation.substr(d_pos + 1));
+	}
+	catch (const std::exception&)
+	{
+	  count = 0;
+	  sides = 0;
+	}
+  }
+
+  bool ExtractUnit(Character* character, BattleState::Unit& unit)
+  {
+	unit          = BattleState::Unit{};
+	unit.type     = character->GetCharacterType();
+	unit.position = character->GetGridPosition()->Get();
+
+	const StatsComponent* stats = character->GetStatsComponent();
+	unit.hp                     = stats->GetCurrentHP();
+	unit.max_hp                 = stats->GetMaxHP();
+	unit.base_speed             = stats->GetAllStats().speed;
+	unit.current_speed          = stats->GetSpeed();
+	unit.attack_range           = stats->GetAttackRange();
+	unit.base_attack            = stats->GetBaseAttack();
+	ParseDice(stats->GetAttackDice(), unit.attack_dice_count, unit.attack_dice_sides);
+
+	const ActionPoints* ap = character->GetActionPointsComponent();
+	unit.action_points     = ap->GetCurrentPoints();
+	unit.max_action_points = ap->GetMaxPoints();
+
+	if (SpellSlots* slots = character->GetSpellSlots())
+	{
+	  for (const auto& [level, max_count] : slots->GetMaxSlots())
+	  {
+		if (level < 1 || level > BattleState::MAX_SPELL_LEVEL)
+		  return false;
+		unit.max_spell_slots[level] = static_cast<std::int8_t>(max_count);
+		unit.spell_slots[level]     = static_cast<std::int8_t>(slots->GetSpellSlotCount(level));
+	  }
+	}
+
+	unit.has_attacked = character->HasAttackedThisTurn();
+	unit.has_treasure = character->HasTreasure();
+
+	const std::vector<ActiveEffect>& effects = character->GetActiveEffects();
+	if (effects.size() > static_cast<std::size_t>(BattleState::MAX_EFFECTS))
+	  return false;
+	for (const ActiveEffect& effect : effects)
+	{
+	  if (effect.name.size() >= static_cast<std::size_t>(BattleState::MAX_EFFECT_NAME))
+		return false;
+	  BattleState::Effect& out = unit.effects[unit.effect_count++];
+	  std::memcpy(out.name, effect.name.c_str(), effect.name.size() + 1);
+	  out.duration  = effect.duration;
+	  out.magnitude = effect.magnitude;
+	}
+	return true;
+  }
+
+  void ApplyUnit(const BattleState::Unit& unit, Character* character)
+  {
+	StatsComponent* stats = character->GetStatsComponent();
+	stats->SetHP(unit.hp);
+	stats->SetAttackRange(unit.attack_range);
+	stats->ModifyBaseSpeed(unit.base_speed - stats->GetAllStats().speed);
+	stats->RefreshSpeed();
+	stats->ReduceSpeed(unit.base_speed - unit.current_speed);
+
+	character->GetActionPointsComponent()->SetPoints(unit.action_points);
+
+	if (SpellSlots* slots = character->GetSpellSlots())
+	{
+	  std::map<int, int> current;
+	  for (const auto& [level, max_count] : slots->GetMaxSlots())
+	  {
+		if (level >= 1 && level <= BattleState::MAX_SPELL_LEVEL)
+		  current[level] = unit.spell_slots[level];
+	  }
+	  slots->SetSpellSlots(current);
+	}
+
+	character->SetHasAttackedThisTurn(unit.has_attacked);
+	character->SetTreasure(unit.has_treasure);
+
+	// Character::AddEffect 는 이벤트를 발행하므로 컴포넌트에 직접 쓴다
+	if (StatusEffectComponent* effects = character->GetGOComponent<StatusEffectComponent>())
+	{
+	  effects->RemoveAllEffects();
+	  for (int i = 0; i < unit.effect_count; ++i)
+		effects->AddEffect(unit.effects[i].name, unit.effects[i].duration, unit.effects[i].magnitude);
+	}
+  }
+}
+
+bool BattleStateBridge::Extract(BattleState& state, std::vector<Character*>& roster)
+{
+  auto&        gs   = Engine::GetGameStateManager();
+  GridSystem*  grid = gs.GetGSComponent<GridSystem>();
+  TurnManager* turn = gs.GetGSComponent<TurnManager>();
+  SpellSystem* spell = gs.GetGSComponent<SpellSystem>();
+  DiceManager* dice  = gs.GetGSComponent<DiceManager>();
+
+  roster.clear();
+  if (grid == nullptr || grid->GetWidth() > BattleState::MAX_MAP_SIZE || grid->GetHeight() > BattleState::MAX_MAP_SIZE)
+	return false;
+
+  // ─ 맵 ─
+  state.width  = grid->GetWidth();
+  state.height = grid->GetHeight();
+  const int tile_count = state.width * state.height;
+  for (int i = 0; i < tile_count; ++i)
+	state.tiles[i] = static_cast<std::uint8_t>(grid->GetTileTypeAt(i));
+
+  // ─ 유닛 ─ GridSystem 의 점유 배열은 순서가 없으므로 타일 순으로 정렬해 인덱스를 고정한다
+  roster = grid->GetOccupants();
+  if (roster.size() > static_cast<std::size_t>(BattleState::MAX_UNITS))
+	return false;
+  std::sort(roster.begin(), roster.end(),
+			[grid](Character* a, Character* b) { return grid->TileIndex(a->GetGridPosition()->Get()) < grid->TileIndex(b->GetGridPosition()->Get()); });
+  state.unit_count = static_cast<int>(roster.size());
+  for (int i = 0; i < state.unit_count; ++i)
+  {
+	if (!ExtractUnit(roster[static_cast<std::size_t>(i)], state.units[i]))
+	  return false;
+  }
+
+  // ─ 지형 효과 ─
+  state.terrain_count = 0;
+  if (spell != nullptr)
+  {
+	for (const TerrainEffect& effect : spell->GetTerrainEffects())
+	{
+	  for (const Math::ivec2& tile : effect.affected_tiles)
+	  {
+		if (state.terrain_count >= BattleState::MAX_TERRAIN_EFFECTS)
+		  return false;
+		state.terrain[state.terrain_count++] = { tile, effect.damage_per_turn, effect.created_round, effect.duration_rounds };
+	  }
+	}
+  }
+
+  // ─ 턴 ─
+  state.turn_count         = 0;
+  state.current_turn_index = -1;
+  state.turn_number        = 0;
+  state.round_number       = 0;
+  state.combat_active      = false;
+  if (turn != nullptr)
+  {
+	Character* current = turn->GetCurrentCharacter();
+	for (Character* character : turn->GetTurnOrder())
+	{
+	  const auto it = std::find(roster.begin(), roster.end(), character);
+	  if (it == roster.end())
+		continue; // 그리드에 없는 캐릭터 (테스트 mock 등)
+	  if (character == current)
+		state.current_turn_index = state.turn_count;
+	  state.turn_order[state.turn_count++] = static_cast<std::int8_t>(it - roster.begin());
+	}
+	state.turn_number   = turn->GetCurrentTurnNumber();
+	state.round_number  = turn->GetRoundNumber();
+	state.combat_active = turn->IsCombatActive();
+  }
+
+  state.dice = dice != nullptr ? dice->GetStreamState() : DiceManager::StreamState{};
+  return true;
+}
+
+void BattleStateBridge::Apply(const BattleState& state, const std::vector<Character*>& roster)
+{
+  auto&        gs    = Engine::GetGameStateManager();
+  GridSystem*  grid  = gs.GetGSComponent<GridSystem>();
+  TurnManager* turn  = gs.GetGSComponent<TurnManager>();
+  SpellSystem* spell = gs.GetGSComponent<SpellSystem>();
+  DiceManager* dice  = gs.GetGSComponent<DiceManager>();
+  if (grid == nullptr || grid->GetWidth() != state.width || grid->GetHeight() != state.height)
+	return;
+
+  // ─ 맵 ─ 바뀐 타일만 써서 거리장/계층 그래프 무효화를 최소화한다
+  for (int y = 0; y < state.height; ++y)
+  {
+	for (int x = 0; x < state.width; ++x)
+	{
+	  const Math::ivec2 tile{ x, y };
+	  if (grid->GetTileType(tile) != state.TileAt(tile))
+		grid->SetTileType(tile, state.TileAt(tile));
+	}
+  }
+
+  // ─ 유닛 ─ 자리를 바꾸는 유닛끼리 겹치지 않도록 먼저 모두 빼고 다시 놓는다
+  const int count = std::min(state.unit_count, static_cast<int>(roster.size()));
+  for (int i = 0; i < count; ++i)
+  {
+	Character*                character = roster[static_cast<std::size_t>(i)];
+	const BattleState::Unit&  unit      = state.units[i];
+	const Math::ivec2         live_pos  = character->GetGridPosition()->Get();
+	const bool                on_grid   = grid->GetCharacterAt(live_pos) == character;
+	if (on_grid && (!unit.IsAlive() || live_pos != unit.position))
+	  grid->RemoveCharacter(live_pos);
+  }
+  for (int i = 0; i < count; ++i)
+  {
+	Character*               character = roster[static_cast<std::size_t>(i)];
+	const BattleState::Unit& unit      = state.units[i];
+	ApplyUnit(unit, character);
+	if (!unit.IsAlive())
+	  continue;
+	if (grid->GetCharacterAt(unit.position) != character)
+	  grid->AddCharacter(character, unit.position);
+	character->SetGridPosition(unit.position);
+  }
+
+  // ─ 지형 효과 ─
+  if (spell != nullptr)
+  {
+	std::vector<TerrainEffect> effects;
+	effects.reserve(static_cast<std::size_t>(state.terrain_count));
+	for (int i = 0; i < state.terrain_count; ++i)
+	{
+	  const BattleState::Terrain& t = state.terrain[i];
+	  effects.push_back({ { t.tile }, t.damage_per_turn, t.created_round, t.duration_rounds });
+	}
+	spell->SetTerrainEffects(std::move(effects));
+  }
+
+  // ─ 턴 ─
+  if (turn != nullptr)
+  {
+	std::vector<Character*> order;
+	int                     current_index = -1;
+	for (int i = 0; i < state.turn_count; ++i)
+	{
+	  const int unit = state.turn_order[i];
+	  if (unit < 0 || unit >= count || !state.units[unit].IsAlive())
+		continue;
+	  if (i == state.current_turn_index)
+		current_index = static_cast<int>(order.size());
+	  order.push_back(roster[static_cast<std::size_t>(unit)]);
+	}
+	turn->RestoreTurnState(order, std::max(current_index, 0), state.turn_number, state.round_number, state.combat_active);
+  }
+
+  if (dice != nullptr)
+	dice->SetStreamState(state.dice);
+}
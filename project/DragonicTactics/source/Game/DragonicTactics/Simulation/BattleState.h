@@ -0,0 +1,139 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Vec2.h"
+#include "./Game/DragonicTactics/StateComponents/DiceManager.h"
+#include "./Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "./Game/DragonicTactics/Types/CharacterTypes.h"
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+class Character;
+
+/// @brief 전투 한 시점의 값 전용 스냅샷 — 포인터/문자열/힙 없이 고정 크기 배열만 가진다
+///
+/// Character 와 그 컴포넌트(GridPosition, StatsComponent, ActionPoints, SpellSlots, StatusEffectComponent),
+/// GridSystem 타일, SpellSystem 지형 효과, TurnManager 턴 순서, DiceManager 스트림 위치를 담는다.
+/// trivially copyable 이므로 대입 한 번(memcpy)으로 분기할 수 있어 탐색 AI / what-if 미리보기가
+/// 결정 하나에 수천 개의 상태를 만들어도 할당이 없다.
+/// 라이브 시스템과의 변환은 BattleStateBridge 가 맡는다.
+struct BattleState
+{
+  static constexpr int MAX_UNITS			= 8;
+  static constexpr int MAX_EFFECTS			= 8;  // 유닛당 상태 효과
+  static constexpr int MAX_EFFECT_NAME		= 16; // 널 포함, status_effect.csv 이름이 모두 들어간다
+  static constexpr int MAX_SPELL_LEVEL		= 9;
+  static constexpr int MAX_TERRAIN_EFFECTS = 64; // 타일 단위
+  static constexpr int MAX_MAP_SIZE		= 64;
+  static constexpr int MAX_TILES			= MAX_MAP_SIZE * MAX_MAP_SIZE;
+
+  struct Effect
+  {
+	char name[MAX_EFFECT_NAME];
+	int	 duration;
+	int	 magnitude;
+  };
+
+  struct Unit
+  {
+	CharacterTypes type;
+	Math::ivec2	   position;
+	int			   hp;
+	int			   max_hp;
+	int			   base_speed;	  // StatsComponent 의 stats.speed (버프로 바뀔 수 있음)
+	int			   current_speed; // 이번 턴 남은 이동력
+	int			   attack_range;
+	int			   base_attack;		  // 기본 공격 = attack_dice_count d attack_dice_sides + base_attack
+	int			   attack_dice_count;
+	int			   attack_dice_sides;
+	int			   action_points;
+	int			   max_action_points;
+	std::int8_t	   spell_slots[MAX_SPELL_LEVEL + 1];	 // [레벨] 남은 슬롯, 0 번은 사용 안 함
+	std::int8_t	   max_spell_slots[MAX_SPELL_LEVEL + 1]; // [레벨] 최대 슬롯
+	bool		   has_attacked;
+	bool		   has_treasure;
+	int			   effect_count;
+	Effect		   effects[MAX_EFFECTS];
+
+	bool IsAlive() const
+	{
+	  return hp > 0;
+	}
+  };
+
+  /// SpellSystem::TerrainEffect 를 타일 하나씩 펼친 것
+  struct Terrain
+  {
+	Math::ivec2 tile;
+	int			damage_per_turn; // 0 이면 벽
+	int			created_round;
+	int			duration_rounds;
+  };
+
+  // ─ 맵 ─
+  int			width;
+  int			height;
+  std::uint8_t tiles[MAX_TILES]; // GridSystem::TileType, 행 우선 (y * width + x)
+
+  // ─ 유닛 ─ (인덱스는 BattleStateBridge 가 채운 roster 와 같다)
+  int  unit_count;
+  Unit units[MAX_UNITS];
+
+  // ─ 지형 효과 ─
+  int		terrain_count;
+  Terrain terrain[MAX_TERRAIN_EFFECTS];
+
+  // ─ 턴 ─ (turn_order 는 units 인덱스)
+  int			turn_count;
+  std::int8_t turn_order[MAX_UNITS];
+  int			current_turn_index;
+  int			turn_number;
+  int			round_number;
+  bool		combat_active;
+
+  // ─ 주사위 ─
+  DiceManager::StreamState dice;
+
+  GridSystem::TileType TileAt(Math::ivec2 tile) const
+  {
+	return static_cast<GridSystem::TileType>(tiles[tile.y * width + tile.x]);
+  }
+
+  bool IsValidTile(Math::ivec2 tile) const
+  {
+	return tile.x >= 0 && tile.x < width && tile.y >= 0 && tile.y < height;
+  }
+
+  /// @brief tile 에 서 있는 살아 있는 유닛 인덱스, 없으면 -1
+  int UnitAt(Math::ivec2 tile) const;
+
+  /// @brief 현재 턴 유닛 인덱스, 전투 중이 아니면 -1
+  int CurrentUnit() const
+  {
+	return current_turn_index >= 0 && current_turn_index < turn_count ? turn_order[current_turn_index] : -1;
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<BattleState>, "BattleState must stay memcpy-copyable");
+
+/// @brief 라이브 StateComponent 들 ↔ BattleState 변환
+///
+/// Engine::GetGameStateManager() 의 GridSystem / TurnManager / SpellSystem / DiceManager 를 읽고 쓴다.
+/// GridSystem 외의 구성요소는 없어도 되며, 그 부분은 비워 두거나 건너뛴다.
+class BattleStateBridge
+{
+  public:
+  /// @brief 현재 전투를 state 에 담는다. roster 에는 유닛 인덱스 → Character* 대응을 채운다 (타일 순)
+  /// @return 맵/유닛/효과 수가 고정 용량을 넘으면 false (state 는 쓰다 만 상태)
+  static bool Extract(BattleState& state, std::vector<Character*>& roster);
+
+  /// @brief state 를 라이브 시스템에 되돌려 쓴다. roster 는 같은 전투의 Extract 결과여야 하고,
+  ///        그 캐릭터들이 아직 살아 있어야 한다 (죽어서 Destroy 된 캐릭터는 되살릴 수 없다).
+  ///        이벤트는 발행하지 않는다 — 미리보기/탐색 후 원래 상태로 되돌리는 용도.
+  static void Apply(const BattleState& state, const std::vector<Character*>& roster);
+};
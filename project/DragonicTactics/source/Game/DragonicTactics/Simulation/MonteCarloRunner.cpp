@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "MonteCarloRunner.h"
+#include "WorkStealingPool.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include <chrono>
+#include <limits>
+
+namespace
+{
+  /// 워커 하나만 쓰는 집계. 다른 워커와 캐시 라인을 나누지 않도록 정렬한다
+  struct alignas(64) WorkerTotals
+  {
+	int                              battles      = 0;
+	int                              dragon_wins  = 0;
+	int                              invader_wins = 0;
+	int                              draws        = 0;
+	long long                        total_turns  = 0;
+	int                              min_turns    = std::numeric_limits<int>::max();
+	int                              max_turns    = 0;
+	long long                        search_nodes = 0;
+	double                           search_seconds = 0.0;
+	std::map<std::string, long long> damage_by_source;
+  };
+}
+
+MonteCarloSummary MonteCarloRunner::Run(const MonteCarloSettings& settings, std::atomic<int>* progress)
+{
+  const auto start = std::chrono::steady_clock::now();
+
+  WorkStealingPool                         pool(settings.threads);
+  const std::size_t                        worker_count = static_cast<std::size_t>(pool.WorkerCount());
+  std::vector<CS230::GameStateManager>     contexts(worker_count);
+  std::vector<WorkerTotals>                totals(worker_count);
+
+  pool.Run(
+	settings.battles,
+	[&](int worker, int battle)
+	{
+	  const std::size_t w = static_cast<std::size_t>(worker);
+	  Engine::SetThreadGameStateManager(&contexts[w]);
+
+	  BattleSettings battle_settings = settings.battle;
+	  battle_settings.counter_dice   = true;
+	  battle_settings.dice_stream    = static_cast<std::uint64_t>(battle);
+	  const BattleResult result      = BattleSimulator::Run(battle_settings);
+
+	  WorkerTotals& t = totals[w];
+	  ++t.battles;
+	  switch (result.winner)
+	  {
+		case BattleWinner::Dragon: ++t.dragon_wins; break;
+		case BattleWinner::Invaders: ++t.invader_wins; break;
+		case BattleWinner::Draw: ++t.draws; break;
+	  }
+	  t.total_turns += result.turns;
+	  t.min_turns = std::min(t.min_turns, result.turns);
+	  t.max_turns = std::max(t.max_turns, result.turns);
+	  t.search_nodes += result.search_nodes;
+	  t.search_seconds += result.search_seconds;
+	  for (const auto& [source, damage] : result.damage_by_source)
+		t.damage_by_source[source] += damage;
+
+	  if (progress != nullptr)
+		progress->fetch_add(1, std::memory_order_relaxed);
+	});
+
+  // 워커 스레드의 thread_local 연결은 pool 과 함께 사라진다. 여기서부터는 단일 스레드로 합친다
+  MonteCarloSummary summary;
+  summary.threads      = pool.WorkerCount();
+  summary.stolen_tasks = static_cast<long long>(pool.StolenTasks());
+  summary.min_turns    = std::numeric_limits<int>::max();
+  for (const WorkerTotals& t : totals)
+  {
+	summary.battles += t.battles;
+	summary.dragon_wins += t.dragon_wins;
+	summary.invader_wins += t.invader_wins;
+	summary.draws += t.draws;
+	summary.total_turns += t.total_turns;
+	summary.min_turns = std::min(summary.min_turns, t.min_turns);
+	summary.max_turns = std::max(summary.max_turns, t.max_turns);
+	summary.search_nodes += t.search_nodes;
+	summary.search_seconds += t.search_seconds;
+	for (const auto& [source, damage] : t.damage_by_source)
+	  summary.damage_by_source[source] += damage;
+  }
+  if (summary.battles == 0)
+	summary.min_turns = 0;
+
+  summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return summary;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "BattleSimulator.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/// @brief 몬테카를로 배치 설정
+struct MonteCarloSettings
+{
+  BattleSettings battle;	   // battle.dice_seed 가 배치 전체의 주사위 키, 전투 i 는 스트림 i 를 쓴다
+  int			 battles = 1000;
+  int			 threads = 0;  // 0 이면 hardware_concurrency
+};
+
+/// @brief 배치 전체 집계
+struct MonteCarloSummary
+{
+  int		battles		 = 0;
+  int		dragon_wins	 = 0;
+  int		invader_wins = 0;
+  int		draws		 = 0;
+  long long total_turns	 = 0;
+  int		min_turns	 = 0;
+  int		max_turns	 = 0;
+  double	seconds		 = 0.0; // 벽시계 시간
+  int		threads		 = 0;
+  long long stolen_tasks = 0;
+  long long search_nodes   = 0;   // SearchStrategy 전체 노드 수
+  double	search_seconds = 0.0; // SearchStrategy 결정 시간 합 (워커 합산, 벽시계 아님)
+
+  /// 피해 출처(스펠 ID / "Attack" / "Environment") 별 총 피해량
+  std::map<std::string, long long> damage_by_source;
+
+  double DragonWinRate() const
+  {
+	return battles > 0 ? static_cast<double>(dragon_wins) / battles : 0.0;
+  }
+
+  double SearchNodesPerSecond() const
+  {
+	return search_seconds > 0.0 ? static_cast<double>(search_nodes) / search_seconds : 0.0;
+  }
+
+  double AverageTurns() const
+  {
+	return battles > 0 ? static_cast<double>(total_turns) / battles : 0.0;
+  }
+};
+
+/// @brief BattleSimulator 를 work-stealing 풀 위에서 병렬로 돌려 승률/턴 수/스펠별 피해를 집계한다
+///
+/// 워커마다 자기 CS230::GameStateManager 를 갖고 Engine::SetThreadGameStateManager 로 연결하므로
+/// 전투끼리 StateComponent 를 공유하지 않는다. 주사위는 counter-based 스트림 (battle.dice_seed, 전투 번호) 이라
+/// 스레드 수나 실행 순서와 관계없이 같은 설정이면 같은 결과가 나온다.
+/// 집계는 워커별 캐시 라인에 따로 쌓았다가 풀이 끝난 뒤 한 번 합친다 (전투 중에는 잠금 없음).
+/// Engine::StartHeadless() 이후에 호출한다.
+class MonteCarloRunner
+{
+  public:
+  /// progress 가 있으면 끝난 전투 수를 실시간으로 올린다
+  static MonteCarloSummary Run(const MonteCarloSettings& settings, std::atomic<int>* progress = nullptr);
+};
@@ -0,0 +1,163 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "WorkStealingPool.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/Logger.h"
+
+WorkStealingPool::WorkStealingPool(int worker_count)
+{
+  if (worker_count <= 0)
+	worker_count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+  workers.reserve(static_cast<std::size_t>(worker_count));
+  for (int i = 0; i < worker_count; ++i)
+	workers.push_back(std::make_unique<Worker>());
+  for (int i = 0; i < worker_count; ++i)
+	workers[static_cast<std::size_t>(i)]->thread = std::thread(&WorkStealingPool::WorkerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+	std::lock_guard lock(control_mutex);
+	stopping = true;
+	++generation;
+  }
+  start_cv.notify_all();
+  for (auto& worker : workers)
+  {
+	if (worker->thread.joinable())
+	  worker->thread.join();
+  }
+}
+
+void WorkStealingPool::Run(int task_count, const std::function<void(int worker, int task)>& task)
+{
+  if (task_count <= 0)
+	return;
+
+  // 연속 구간으로 나눠 두면 훔쳐 가지 않는 한 워커는 자기 구간만 처리한다
+  const int count = WorkerCount();
+  for (int w = 0; w < count; ++w)
+  {
+	Worker&         worker = *workers[static_cast<std::size_t>(w)];
+	std::lock_guard lock(worker.mutex);
+	worker.queue.clear();
+	worker.stolen = 0;
+	const int begin = static_cast<int>(static_cast<long long>(task_count) * w / count);
+	const int end   = static_cast<int>(static_cast<long long>(task_count) * (w + 1) / count);
+	for (int t = begin; t < end; ++t)
+	  worker.queue.push_back(t);
+  }
+
+  std::unique_lock lock(control_mutex);
+  current_task = &task;
+  remaining.store(task_count, std::memory_order_relaxed);
+  running = count;
+  ++generation;
+  start_cv.notify_all();
+  done_cv.wait(lock, [this] { return running == 0; });
+  current_task = nullptr;
+}
+
+std::uint64_t WorkStealingPool::StolenTasks() const
+{
+  std::uint64_t total = 0;
+  for (const auto& worker : workers)
+	total += worker->stolen;
+  return total;
+}
+
+void WorkStealingPool::WorkerLoop(int index)
+{
+  std::uint64_t seen_generation = 0;
+  while (true)
+  {
+	const std::function<void(int, int)>* task = nullptr;
+	{
+	  std::unique_lock lock(control_mutex);
+	  start_cv.wait(lock, [&] { return generation != seen_generation; });
+	  seen_generation = generation;
+	  if (stopping)
+		return;
+	  task = current_task;
+	}
+
+	int next = 0;
+	while (remaining.load(std::memory_order_acquire) > 0)
+	{
+	  if (!PopLocal(index, next) && !Steal(index, next))
+	  {
+		// 남은 task 는 모두 다른 워커가 실행 중이다
+		std::this_thread::yield();
+		continue;
+	  }
+	  try
+	  {
+		(*task)(index, next);
+	  }
+	  catch (const std::exception& e)
+	  {
+		Engine::GetLogger().LogError("WorkStealingPool: task " + std::to_string(next) + " failed: " + e.what());
+	  }
+	  catch (...)
+	  {
+		Engine::GetLogger().LogError("WorkStealingPool: task " + std::to_string(next) + " failed");
+	  }
+	  remaining.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	std::lock_guard lock(control_mutex);
+	if (--running == 0)
+	  done_cv.notify_one();
+  }
+}
+
+bool WorkStealingPool::PopLocal(int index, int& task)
+{
+  Worker&         worker = *workers[static_cast<std::size_t>(index)];
+  std::lock_guard lock(worker.mutex);
+  if (worker.queue.empty())
+	return false;
+  task = worker.queue.front();
+  worker.queue.pop_front();
+  return true;
+}
+
+bool WorkStealingPool::Steal(int index, int& task)
+{
+  const int count = WorkerCount();
+  for (int offset = 1; offset < count; ++offset)
+  {
+	Worker&         victim = *workers[static_cast<std::size_t>((index + offset) % count)];
+	std::deque<int> loot;
+	{
+	  std::lock_guard lock(victim.mutex);
+	  // 피해자가 곧 꺼낼 앞쪽은 두고 뒤쪽 절반을 가져온다
+	  const std::size_t take = (victim.queue.size() + 1) / 2;
+	  for (std::size_t i = 0; i < take; ++i)
+	  {
+		loot.push_front(victim.queue.back());
+		victim.queue.pop_back();
+	  }
+	}
+	if (loot.empty())
+	  continue;
+
+	Worker&         self = *workers[static_cast<std::size_t>(index)];
+	std::lock_guard lock(self.mutex);
+	self.stolen += loot.size();
+	task = loot.front();
+	loot.pop_front();
+	self.queue.insert(self.queue.end(), loot.begin(), loot.end());
+	return true;
+  }
+  return false;
+}
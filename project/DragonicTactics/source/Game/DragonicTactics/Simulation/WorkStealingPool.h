@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief 작업 훔치기(work-stealing) 스레드 풀
+///
+/// 워커마다 자기 deque 를 갖고 앞에서 꺼내 쓰며, 비면 다른 워커의 deque 뒤쪽 절반을 훔쳐 온다.
+/// 전투 한 판의 길이가 맵/주사위에 따라 크게 달라서 정적 분할보다 꼬리 지연이 짧다.
+/// 스레드는 생성 시 한 번 만들고 Run() 호출마다 재사용한다.
+class WorkStealingPool
+{
+  public:
+  /// worker(0 이면 hardware_concurrency) 개의 스레드를 만든다
+  explicit WorkStealingPool(int worker_count = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&)			   = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /// task 0..task_count-1 을 모두 실행할 때까지 블록한다.
+  /// task 는 (워커 번호, task 번호) 로 호출되며, 워커 번호는 [0, WorkerCount()) 이다.
+  /// task 에서 던진 예외는 로그로 남기고 나머지 작업은 계속한다.
+  void Run(int task_count, const std::function<void(int worker, int task)>& task);
+
+  int WorkerCount() const
+  {
+	return static_cast<int>(workers.size());
+  }
+
+  /// 마지막 Run() 에서 다른 워커로부터 훔쳐 온 task 수
+  std::uint64_t StolenTasks() const;
+
+  private:
+  struct alignas(64) Worker
+  {
+	std::mutex		mutex;
+	std::deque<int> queue;
+	std::uint64_t	stolen = 0;
+	std::thread		thread;
+  };
+
+  void WorkerLoop(int index);
+  bool PopLocal(int index, int& task);
+  bool Steal(int index, int& task);
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  const std::function<void(int, int)>* current_task = nullptr; // Run() 동안만 유효
+  std::mutex							 control_mutex;
+  std::condition_variable				 start_cv;
+  std::condition_variable				 done_cv;
+  std::uint64_t						 generation = 0; // Run() 마다 증가, 워커를 깨운다
+  int									 running	= 0; // 아직 이번 Run() 을 끝내지 않은 워커 수
+  bool								 stopping	= false;
+  std::atomic<int>					 remaining{ 0 }; // 아직 끝나지 않은 task 수
+};
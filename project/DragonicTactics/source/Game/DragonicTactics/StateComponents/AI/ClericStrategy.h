@@ -30,8 +30,6 @@ class ClericStrategy : public IAIStrategy
   Math::ivec2 FindNextMovePos(Character* actor, Character* target, GridSystem* grid,
                                int lava_penalty = LAVA_TILE_PENALTY);
   Math::ivec2 FindClosestReachableTile(Character* actor, Character* target, GridSystem* grid);
-  int         CountLavaTiles(const std::vector<Math::ivec2>& path, GridSystem* grid) const;
-  int         ComputePathCost(const std::vector<Math::ivec2>& path, GridSystem* grid) const;
 
   // --- 서브 의사결정 ---
   AIDecision MakeKillLoopDecision(Character* actor, Character* dragon, GridSystem* grid);
@@ -0,0 +1,103 @@
+/**
+ * @file DragonStrategy.cpp
+ * @author Taekyung Ho
+ * @brief 드래곤 AI 구현: 약한 적 우선 공격 주문 / 기본 공격 / 접근
+ * @date 2025 Fall
+ */
+#include "pch.h"
+
+#include "../../Objects/Components/GridPosition.h"
+#include "../../StateComponents/CombatSystem.h"
+#include "../../StateComponents/GridSystem.h"
+#include "../../StateComponents/SpellSystem.h"
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include "DragonStrategy.h"
+#include "Game/DragonicTactics/Types/CharacterTypes.h"
+
+namespace
+{
+  // 단일 대상에게 쓰는 공격 주문 — 강한 것부터 (CanCast 가 슬롯/사거리/AP 를 확인)
+  const char* const kAttackSpells[] = { "S_ATK_030", "S_ATK_010" };
+}
+
+AIDecision DragonStrategy::MakeDecision(Character* actor)
+{
+  auto&		gs	   = Engine::GetGameStateManager();
+  GridSystem*	grid   = gs.GetGSComponent<GridSystem>();
+  CombatSystem* combat = gs.GetGSComponent<CombatSystem>();
+  SpellSystem*	spells = gs.GetGSComponent<SpellSystem>();
+
+  Character* target = FindWeakestEnemy(actor);
+  if (target == nullptr)
+  {
+	return { AIDecisionType::EndTurn, nullptr, {}, "", "No enemy left" };
+  }
+
+  if (actor->GetActionPoints() > 0)
+  {
+	const Math::ivec2 target_pos = target->GetGridPosition()->Get();
+	if (spells)
+	{
+	  for (const char* spell_id : kAttackSpells)
+	  {
+		if (spells->CanCast(actor, spell_id, target_pos))
+		{
+		  return { AIDecisionType::UseAbility, target, {}, spell_id, std::string("Cast ") + spell_id + " on " + target->TypeName() };
+		}
+	  }
+	}
+
+	if (combat && combat->IsInRange(actor, target, actor->GetAttackRange()))
+	{
+	  return { AIDecisionType::Attack, target, {}, "", "Basic attack on " + target->TypeName() };
+	}
+  }
+
+  if (actor->GetMovementRange() > 0)
+  {
+	Math::ivec2 move_pos = FindNextMovePos(actor, target, grid);
+	if (move_pos != actor->GetGridPosition()->Get())
+	{
+	  return { AIDecisionType::Move, nullptr, move_pos, "", "Moving to " + target->TypeName(), LAVA_TILE_PENALTY };
+	}
+  }
+
+  return { AIDecisionType::EndTurn, nullptr, {}, "", "Nothing left to do" };
+}
+
+Character* DragonStrategy::FindWeakestEnemy(Character* actor) const
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  Character*  best = nullptr;
+  for (Character* c : grid->GetAllCharacters())
+  {
+	if (c == nullptr || c == actor || !c->IsAlive() || c->GetCharacterType() == CharacterTypes::Dragon)
+	  continue;
+	if (best == nullptr || c->GetHP() < best->GetHP())
+	  best = c;
+  }
+  return best;
+}
+
+Math::ivec2 DragonStrategy::FindNextMovePos(Character* actor, Character* target, GridSystem* grid) const
+{
+  const Math::ivec2 my_pos	   = actor->GetGridPosition()->Get();
+  const Math::ivec2 target_pos = target->GetGridPosition()->Get();
+
+  // FighterStrategy 와 같은 방식: 인접 4칸 중 가장 싼 곳까지 한 번에 탐색하고 이동력만큼 전진
+  static const Math::ivec2 offsets[4] = { { 0, 1 }, { 0, -1 }, { -1, 0 }, { 1, 0 } };
+  std::vector<Math::ivec2> attack_positions;
+  for (const auto& offset : offsets)
+  {
+	attack_positions.push_back(target_pos + offset);
+  }
+
+  const std::vector<Math::ivec2> path = grid->FindPathToNearest(my_pos, attack_positions, LAVA_TILE_PENALTY).path;
+  const int						 reach = std::min(static_cast<int>(path.size()), actor->GetMovementRange());
+  if (reach > 0)
+  {
+	return path[static_cast<std::size_t>(reach - 1)];
+  }
+  return my_pos;
+}
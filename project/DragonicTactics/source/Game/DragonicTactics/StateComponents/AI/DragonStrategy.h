@@ -0,0 +1,25 @@
+/**
+ * @file DragonStrategy.h
+ * @author Taekyung Ho
+ * @brief 드래곤 AI 전략 (헤드리스 시뮬레이션/밸런스 테스트용 자동 플레이어)
+ * @date 2025 Fall
+ */
+#pragma once
+#include "IAIStrategy.h"
+
+class GridSystem;
+
+/// 게임에서는 드래곤을 플레이어가 조작하므로 BattleOrchestrator 는 이 전략을 쓰지 않는다.
+/// 시뮬레이터처럼 드래곤까지 AI 로 돌릴 때 사용하는 단순 탐욕 정책:
+///   체력이 가장 낮은 적을 노리고, 공격 주문 → 기본 공격 → 접근 → 턴 종료 순으로 판단.
+class DragonStrategy : public IAIStrategy
+{
+  public:
+  AIDecision MakeDecision(Character* actor) override;
+
+  private:
+  Character*  FindWeakestEnemy(Character* actor) const;
+  Math::ivec2 FindNextMovePos(Character* actor, Character* target, GridSystem* grid) const;
+
+  static constexpr int LAVA_TILE_PENALTY = 2;
+};
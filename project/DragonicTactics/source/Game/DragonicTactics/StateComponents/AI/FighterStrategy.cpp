@@ -336,16 +336,24 @@ bool FighterStrategy::CanReachThisTurn(Character* actor, Character* target, Grid
   Math::ivec2              targetPos = target->GetGridPosition()->Get();
   static const Math::ivec2 offsets[4] = { { 0, 1 }, { 0, -1 }, { -1, 0 }, { 1, 0 } };
 
+  // 공격 위치 후보(IsWalkable) 전체를 한 번의 거리장으로 평가
+  std::vector<Math::ivec2> attackPositions;
   for (const auto& offset : offsets)
   {
     Math::ivec2 attackPos = targetPos + offset;
-    if (!grid->IsValidTile(attackPos) || !grid->IsWalkable(attackPos))
-      continue;
-    std::vector<Math::ivec2> path = grid->FindPath(myPos, attackPos, LAVA_TILE_PENALTY);
-    if (!path.empty() && static_cast<int>(path.size()) <= actor->GetMovementRange())
-    {
+    if (grid->IsValidTile(attackPos) && grid->IsWalkable(attackPos))
+      attackPositions.push_back(attackPos);
+  }
+  if (attackPositions.empty())
+    return false;
+
+  // 후보마다 칸 수를 본다 — 비용이 가장 낮은 후보는 용암을 돌아가느라 이동 범위를 넘을 수 있다
+  const DistanceField&     field = grid->GetDistanceField(myPos, LAVA_TILE_PENALTY);
+  std::vector<Math::ivec2> path;
+  for (const Math::ivec2& attackPos : attackPositions)
+  {
+    if (field.PathTo(attackPos, path) && static_cast<int>(path.size()) <= actor->GetMovementRange())
       return true;
-    }
   }
   return false;
 }
@@ -395,33 +403,17 @@ Math::ivec2 FighterStrategy::FindNextMovePos(Character* actor, Character* target
   Math::ivec2 targetPos = target->GetGridPosition()->Get();
   Math::ivec2 myPos     = actor->GetGridPosition()->Get();
 
-  std::vector<Math::ivec2> bestPath;
-  int                      bestPathCost = 999999;
-
+  // 공격 위치 4곳 중 비용(칸 수 + 용암 패널티)이 가장 낮은 곳 — 한 번의 탐색
+  // 걸을 수 없는(Empty/Lava 아님, 점유) 후보는 FindPathToNearest 가 걸러낸다
   static const Math::ivec2 offsets[4] = { { 0, 1 }, { 0, -1 }, { -1, 0 }, { 1, 0 } };
+  std::vector<Math::ivec2> attackPositions;
   for (const auto& offset : offsets)
   {
-    Math::ivec2 attackPos = targetPos + offset;
-    if (!grid->IsValidTile(attackPos))
-      continue;
-    GridSystem::TileType attack_tile = grid->GetTileType(attackPos);
-    bool attack_ok = (attack_tile == GridSystem::TileType::Empty || attack_tile == GridSystem::TileType::Lava)
-                      && !grid->IsOccupied(attackPos);
-    if (!attack_ok)
-      continue;
-
-    std::vector<Math::ivec2> currentPath = grid->FindPath(myPos, attackPos, LAVA_TILE_PENALTY);
-    if (!currentPath.empty())
-    {
-      int effectiveCost = ComputePathCost(currentPath, grid);
-      if (effectiveCost < bestPathCost)
-      {
-        bestPathCost = effectiveCost;
-        bestPath     = currentPath;
-      }
-    }
+    attackPositions.push_back(targetPos + offset);
   }
 
+  std::vector<Math::ivec2> bestPath = grid->FindPathToNearest(myPos, attackPositions, LAVA_TILE_PENALTY).path;
+
   if (!bestPath.empty())
   {
     int maxReach  = std::min(static_cast<int>(bestPath.size()), actor->GetMovementRange());
@@ -435,25 +427,9 @@ Math::ivec2 FighterStrategy::FindNextMovePos(Character* actor, Character* target
   return myPos; // 갈 곳 없으면 제자리
 }
 
-int FighterStrategy::CountLavaTiles(const std::vector<Math::ivec2>& path, GridSystem* grid) const
-{
-  int count = 0;
-  for (const auto& tile : path)
-  {
-    if (grid->GetTileType(tile) == GridSystem::TileType::Lava)
-      ++count;
-  }
-  return count;
-}
-
-int FighterStrategy::ComputePathCost(const std::vector<Math::ivec2>& path, GridSystem* grid) const
-{
-  return static_cast<int>(path.size()) + CountLavaTiles(path, grid) * LAVA_TILE_PENALTY;
-}
-
 Math::ivec2 FighterStrategy::FindClosestReachableTile(Character* actor, Character* target, GridSystem* grid)
 {
-  auto        reachable = grid->GetReachableTiles(actor->GetGridPosition()->Get(), actor->GetMovementRange());
+  const auto& reachable = grid->ComputeReachable(actor->GetGridPosition()->Get(), actor->GetMovementRange()).tiles;
   Math::ivec2 targetPos = target->GetGridPosition()->Get();
   Math::ivec2 myPos     = actor->GetGridPosition()->Get();
   Math::ivec2 best      = myPos;
@@ -7,6 +7,8 @@
 
 #pragma once
 #include "Engine/Vec2.h"
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -32,9 +34,35 @@ struct AIDecision
   std::string	 abilityName  = "";			// 스킬명
   std::string	 reasoning	  = "";			// 디버그용 메모
   int			 lava_penalty = 0;			// 이동 시 용암 타일 회피 가중치 (0 = 무시)
+  int			 upcast_level = 0;			// UseAbility 슬롯 레벨 (0 = 스펠 기본 레벨)
 };
 
-// 3. 전략 인터페이스
+// 3. 스냅샷만 보고 계산하는 결정 작업
+//    메인 스레드에서 만들고, Run 은 어느 스레드에서든 한 번 호출할 수 있다.
+//    Run 안에서는 라이브 GameObject / StateComponent 를 건드리지 않는다.
+class AIDecisionJob
+{
+  public:
+  virtual ~AIDecisionJob() = default;
+
+  virtual AIDecision Run() = 0;
+
+  // 다른 스레드에서 호출해도 된다. Run 이 다음 확인 지점에서 돌아온다 (결과는 버릴 것)
+  void Cancel()
+  {
+	m_cancelled.store(true, std::memory_order_relaxed);
+  }
+
+  bool IsCancelled() const
+  {
+	return m_cancelled.load(std::memory_order_relaxed);
+  }
+
+  private:
+  std::atomic<bool> m_cancelled{ false };
+};
+
+// 4. 전략 인터페이스
 class IAIStrategy
 {
   public:
@@ -42,4 +70,16 @@ class IAIStrategy
 
   // 상황을 판단하여 행동을 결정하는 핵심 함수
   virtual AIDecision MakeDecision(Character* actor) = 0;
+
+  // 스냅샷으로 결정할 수 있는 전략이면 작업을 만든다 (메인 스레드).
+  // nullptr 이면 AISystem 이 MakeDecision 을 메인 스레드에서 바로 부른다 — 라이브 객체를 읽는 스크립트 전략
+  virtual std::unique_ptr<AIDecisionJob> PrepareDecision([[maybe_unused]] Character* actor)
+  {
+	return nullptr;
+  }
+
+  // PrepareDecision 으로 만든 작업이 취소되지 않고 끝났을 때 메인 스레드에서 호출 (통계 등)
+  virtual void FinishDecision([[maybe_unused]] const AIDecisionJob& job)
+  {
+  }
 };
\ No newline at end of file
@@ -0,0 +1,700 @@
+/**
+ * @file SearchStrategy.cpp
+ * @author Taekyung Ho
+ * @brief expectimax 탐색 AI 구현 (BattleState 복사본 전개, 주사위 chance 노드, 반복 심화)
+ * @date 2025 Fall
+ */
+#include "pch.h"
+
+#include "SearchStrategy.h"
+
+#include "../../Simulation/BattleState.h"
+#include "../../Objects/Character.h"
+#include "../../StateComponents/SpellSystem.h"
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+  constexpr int    MAX_ACTIONS = 64;
+  constexpr double SQRT3       = 1.7320508075688772;
+
+  int Manhattan(Math::ivec2 a, Math::ivec2 b)
+  {
+    return std::abs(a.x - b.x) + std::abs(a.y - b.y);
+  }
+
+  /// "NdM" 만 받는다. 성공하면 true
+  bool ParseDice(const std::string& notation, int& count, int& sides)
+  {
+    const std::size_t d_pos = notation.find('d');
+    if (d_pos == std::string::npos || d_pos + 1 >= notation.size())
+      return false;
+    const std::string left  = notation.substr(0, d_pos);
+    const std::string right = notation.substr(d_pos + 1);
+    const auto        is_number = [](const std::string& s)
+    { return !s.empty() && std::all_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; }); };
+    if ((!left.empty() && !is_number(left)) || !is_number(right))
+      return false;
+    count = left.empty() ? 1 : std::stoi(left);
+    sides = std::stoi(right);
+    return count > 0 && sides > 0;
+  }
+}
+
+/// 결정 하나의 탐색 — 메인 스레드에서 스냅샷/주문 모델을 받아 두고, Run 은 그 복사본만 본다
+class SearchStrategy::Job : public AIDecisionJob
+{
+  public:
+  Job(const SearchSettings& settings, std::vector<AbilityModel> abilities) : m_settings(settings), m_abilities(std::move(abilities))
+  {
+  }
+
+  /// 메인 스레드에서 호출. 전투가 BattleState 에 안 들어가거나 actor 가 그리드에 없으면 false
+  bool Capture(Character* actor);
+
+  AIDecision Run() override;
+
+  long long Nodes() const { return m_nodes; }
+  double    Seconds() const { return m_seconds; }
+  int       CompletedDepth() const { return m_completed_depth; }
+
+  private:
+  struct Action
+  {
+    AIDecisionType type    = AIDecisionType::EndTurn;
+    int            target  = -1; // units 인덱스
+    Math::ivec2    tile    = { -1, -1 };
+    int            ability = -1; // m_abilities 인덱스
+    int            level   = 0;  // 사용할 슬롯 레벨 (Move 는 걸음 수)
+  };
+
+  struct Outcome
+  {
+    double probability;
+    int    amount;
+  };
+
+  double Expand(const BattleState& state, int depth, bool moved);
+  double ExpectAction(const BattleState& state, const Action& action, int depth, bool moved);
+  double Evaluate(const BattleState& state) const;
+
+  void GenerateActions(const BattleState& state, bool moved, Action* out, int& count) const;
+  void GenerateMoves(const BattleState& state, Action* out, int& count) const;
+  bool CollectTargets(const BattleState& state, const AbilityModel& ability, Math::ivec2 aim, int* targets, int& count) const;
+  int  Outcomes(int dice_count, int dice_sides, int bonus, Outcome* out) const;
+  bool IsEnemy(const BattleState& state, int a, int b) const;
+  bool TimeUp();
+
+  AIDecision ToDecision(const Action& action) const;
+
+  const SearchSettings      m_settings;
+  const std::vector<AbilityModel> m_abilities;
+
+  // Capture 에서 채우고 Run 에서는 읽기만 — 탐색 중에는 스택에 복사본이 깊이만큼 쌓이므로 루트는 힙에 둔다
+  std::unique_ptr<BattleState> m_root = std::make_unique<BattleState>();
+  std::vector<Character*>      m_roster; // 결정에 담을 포인터 값으로만 쓴다 (역참조 금지)
+  std::vector<std::string>     m_names;  // reasoning 용 TypeName
+  int                          m_actor = -1;
+
+  long long                             m_nodes           = 0;
+  int                                   m_depth           = 0; // 진행 중인 반복 심화 깊이
+  int                                   m_completed_depth = 0;
+  bool                                  m_aborted         = false;
+  double                                m_seconds         = 0.0;
+  std::chrono::steady_clock::time_point m_deadline;
+
+  static constexpr int LAVA_TILE_PENALTY   = 2;
+  static constexpr int MAX_MOVE_CANDIDATES = 6;
+};
+
+SearchStrategy::SearchStrategy(const SearchSettings& settings, std::unique_ptr<IAIStrategy> fallback)
+    : m_settings(settings), m_fallback(std::move(fallback))
+{
+}
+
+AIDecision SearchStrategy::MakeDecision(Character* actor)
+{
+  std::unique_ptr<AIDecisionJob> job = PrepareDecision(actor);
+  if (!job)
+  {
+    ++m_stats.fallback_count;
+    if (m_fallback)
+      return m_fallback->MakeDecision(actor);
+    return { AIDecisionType::EndTurn, nullptr, {}, "", "Search: state does not fit BattleState" };
+  }
+  const AIDecision decision = job->Run();
+  FinishDecision(*job);
+  return decision;
+}
+
+std::unique_ptr<AIDecisionJob> SearchStrategy::PrepareDecision(Character* actor)
+{
+  auto job = std::make_unique<Job>(m_settings, BuildAbilities(actor));
+  if (!job->Capture(actor))
+    return nullptr;
+  return job;
+}
+
+void SearchStrategy::FinishDecision(const AIDecisionJob& job)
+{
+  // PrepareDecision 이 만든 작업만 돌아온다 (AISystem 이 전략별로 짝을 맞춘다)
+  const Job& search = static_cast<const Job&>(job);
+  ++m_stats.decisions;
+  m_stats.nodes += search.Nodes();
+  m_stats.depth_sum += search.CompletedDepth();
+  m_stats.seconds += search.Seconds();
+}
+
+bool SearchStrategy::Job::Capture(Character* actor)
+{
+  if (!BattleStateBridge::Extract(*m_root, m_roster))
+    return false;
+  const auto found = std::find(m_roster.begin(), m_roster.end(), actor);
+  if (found == m_roster.end())
+    return false;
+  m_actor = static_cast<int>(found - m_roster.begin());
+  m_names.reserve(m_roster.size());
+  for (Character* character : m_roster)
+    m_names.push_back(character->TypeName());
+  return true;
+}
+
+AIDecision SearchStrategy::Job::Run()
+{
+  const auto start = std::chrono::steady_clock::now();
+  m_nodes          = 0;
+  m_deadline       = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(m_settings.time_budget_ms));
+
+  // 반복 심화 — 예산이 끊긴 깊이의 결과는 버리고 마지막으로 끝까지 본 깊이의 최선 수를 쓴다
+  Action best_action;
+  for (int depth = 1; depth <= std::max(1, m_settings.max_depth); ++depth)
+  {
+    m_depth   = depth;
+    m_aborted = false;
+
+    std::array<Action, MAX_ACTIONS> actions;
+    int                             count = 0;
+    GenerateActions(*m_root, false, actions.data(), count);
+
+    Action best_here;
+    double best_value = Evaluate(*m_root); // 턴 종료
+    for (int i = 0; i < count && !m_aborted; ++i)
+    {
+      const double value = ExpectAction(*m_root, actions[static_cast<std::size_t>(i)], depth, false);
+      if (!m_aborted && value > best_value + 1e-9)
+      {
+        best_value = value;
+        best_here  = actions[static_cast<std::size_t>(i)];
+      }
+    }
+    if (m_aborted)
+      break;
+    best_action       = best_here;
+    m_completed_depth = depth;
+    if (count == 0)
+      break; // 더 깊이 봐도 같다
+  }
+
+  m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return ToDecision(best_action);
+}
+
+double SearchStrategy::Job::Expand(const BattleState& state, int depth, bool moved)
+{
+  ++m_nodes;
+  if (TimeUp())
+    return 0.0;
+
+  double best = Evaluate(state); // 여기서 턴 종료
+  if (depth <= 0 || !state.units[m_actor].IsAlive())
+    return best;
+
+  std::array<Action, MAX_ACTIONS> actions;
+  int                             count = 0;
+  GenerateActions(state, moved, actions.data(), count);
+  for (int i = 0; i < count; ++i)
+  {
+    const double value = ExpectAction(state, actions[static_cast<std::size_t>(i)], depth, moved);
+    if (m_aborted)
+      return best;
+    best = std::max(best, value);
+  }
+  return best;
+}
+
+double SearchStrategy::Job::ExpectAction(const BattleState& state, const Action& action, int depth, bool moved)
+{
+  switch (action.type)
+  {
+    case AIDecisionType::Move:
+    {
+      BattleState child             = state;
+      BattleState::Unit& me         = child.units[m_actor];
+      me.position                   = action.tile;
+      me.current_speed             -= action.level; // 이동은 level 에 걸음 수를 담는다
+      return Expand(child, depth - 1, true);
+    }
+
+    case AIDecisionType::Attack:
+    {
+      const BattleState::Unit& me = state.units[m_actor];
+      std::array<Outcome, 3>   outcomes;
+      const int                n = Outcomes(me.attack_dice_count, me.attack_dice_sides, me.base_attack, outcomes.data());
+      double                   expected = 0.0;
+      for (int i = 0; i < n; ++i)
+      {
+        const Outcome&     o     = outcomes[static_cast<std::size_t>(i)];
+        BattleState        child = state;
+        BattleState::Unit& self  = child.units[m_actor];
+        BattleState::Unit& tgt   = child.units[action.target];
+        --self.action_points;
+        self.has_attacked = true;
+        tgt.hp            = std::max(0, tgt.hp - o.amount);
+        expected += o.probability * Expand(child, depth - 1, moved);
+        if (m_aborted)
+          return expected;
+      }
+      return expected;
+    }
+
+    case AIDecisionType::UseAbility:
+    {
+      const AbilityModel&    ability = m_abilities[static_cast<std::size_t>(action.ability)];
+      const int              upcast  = action.level - ability.level;
+      std::array<Outcome, 3> outcomes;
+      int                    n = 0;
+      if (ability.flat > 0)
+      {
+        outcomes[0] = { 1.0, ability.flat * (upcast + 1) };
+        n           = 1;
+      }
+      else
+      {
+        // 기본 주사위 + 업캐스트 주사위를 하나의 분포로 합친다
+        const int extra = ability.upcastable ? upcast * ability.upcast_count : 0;
+        n               = Outcomes(ability.dice_count, ability.dice_sides, 0, outcomes.data());
+        if (extra > 0)
+        {
+          std::array<Outcome, 3> bonus;
+          Outcomes(extra, ability.upcast_sides, 0, bonus.data());
+          for (int i = 0; i < n; ++i)
+            outcomes[static_cast<std::size_t>(i)].amount += bonus[static_cast<std::size_t>(i)].amount;
+        }
+      }
+
+      int targets[BattleState::MAX_UNITS];
+      int target_count = 0;
+      CollectTargets(state, ability, state.units[action.target].position, targets, target_count);
+
+      double expected = 0.0;
+      for (int i = 0; i < n; ++i)
+      {
+        const Outcome&     o     = outcomes[static_cast<std::size_t>(i)];
+        BattleState        child = state;
+        BattleState::Unit& self  = child.units[m_actor];
+        --self.action_points;
+        --self.spell_slots[action.level];
+        for (int t = 0; t < target_count; ++t)
+        {
+          BattleState::Unit& tgt = child.units[targets[t]];
+          tgt.hp                 = ability.heal ? std::min(tgt.max_hp, tgt.hp + o.amount) : std::max(0, tgt.hp - o.amount);
+        }
+        expected += o.probability * Expand(child, depth - 1, moved);
+        if (m_aborted)
+          return expected;
+      }
+      return expected;
+    }
+
+    default: return Evaluate(state);
+  }
+}
+
+double SearchStrategy::Job::Evaluate(const BattleState& state) const
+{
+  const BattleState::Unit& me    = state.units[m_actor];
+  double                   score = 0.0;
+  int                      nearest_enemy = -1;
+  for (int i = 0; i < state.unit_count; ++i)
+  {
+    const BattleState::Unit& unit = state.units[i];
+    if (!unit.IsAlive())
+      continue;
+    // 살아 있는 것 자체에 30, 남은 체력 비율에 70
+    const double value = 30.0 + 70.0 * static_cast<double>(unit.hp) / static_cast<double>(std::max(1, unit.max_hp));
+    if (IsEnemy(state, m_actor, i))
+    {
+      score -= value;
+      const int d = Manhattan(me.position, unit.position);
+      nearest_enemy = nearest_enemy < 0 ? d : std::min(nearest_enemy, d);
+    }
+    else
+    {
+      score += value;
+    }
+  }
+
+  // 남은 슬롯은 다음 턴의 피해 — 과한 업캐스트를 막는 정도로만
+  for (int level = 1; level <= BattleState::MAX_SPELL_LEVEL; ++level)
+    score += 0.5 * level * me.spell_slots[level];
+
+  // 다음 턴에 닿을 수 있도록 가까이 (체력 비율보다 훨씬 작은 항)
+  if (me.IsAlive() && nearest_enemy > 0)
+    score -= 0.25 * std::max(0, nearest_enemy - me.attack_range);
+  return score;
+}
+
+void SearchStrategy::Job::GenerateActions(const BattleState& state, bool moved, Action* out, int& count) const
+{
+  count                       = 0;
+  const BattleState::Unit& me = state.units[m_actor];
+
+  if (me.action_points > 0)
+  {
+    // 기본 공격
+    if (me.attack_dice_count > 0)
+    {
+      for (int i = 0; i < state.unit_count && count < MAX_ACTIONS; ++i)
+      {
+        const BattleState::Unit& unit = state.units[i];
+        if (unit.IsAlive() && IsEnemy(state, m_actor, i) && Manhattan(me.position, unit.position) <= me.attack_range)
+        {
+          Action& a = out[count++];
+          a         = Action{};
+          a.type    = AIDecisionType::Attack;
+          a.target  = i;
+        }
+      }
+    }
+
+    // 주문 — 슬롯 레벨마다 (업캐스트 불가 주문은 가장 낮은 가능한 레벨 하나)
+    for (int k = 0; k < static_cast<int>(m_abilities.size()); ++k)
+    {
+      const AbilityModel& ability = m_abilities[static_cast<std::size_t>(k)];
+      for (int level = std::max(1, ability.level); level <= BattleState::MAX_SPELL_LEVEL; ++level)
+      {
+        if (me.spell_slots[level] <= 0)
+          continue;
+
+        if (ability.shape == AbilityModel::Shape::Single)
+        {
+          for (int i = 0; i < state.unit_count && count < MAX_ACTIONS; ++i)
+          {
+            const BattleState::Unit& unit = state.units[i];
+            if (!unit.IsAlive() || IsEnemy(state, m_actor, i) != ability.enemy_only)
+              continue;
+            if (ability.range >= 0 && Manhattan(me.position, unit.position) > ability.range)
+              continue;
+            if (ability.heal && unit.hp >= unit.max_hp)
+              continue;
+            Action& a = out[count++];
+            a         = Action{};
+            a.type    = AIDecisionType::UseAbility;
+            a.target  = i;
+            a.ability = k;
+            a.level   = level;
+          }
+        }
+        else if (count < MAX_ACTIONS)
+        {
+          int targets[BattleState::MAX_UNITS];
+          int target_count = 0;
+          if (CollectTargets(state, ability, me.position, targets, target_count))
+          {
+            // 조준 타일은 맞는 적 중 첫 번째 (CanCast 사거리 확인용)
+            int aim = -1;
+            for (int t = 0; t < target_count && aim < 0; ++t)
+              if (IsEnemy(state, m_actor, targets[t]))
+                aim = targets[t];
+            if (aim >= 0)
+            {
+              Action& a = out[count++];
+              a         = Action{};
+              a.type    = AIDecisionType::UseAbility;
+              a.target  = aim;
+              a.ability = k;
+              a.level   = level;
+            }
+          }
+        }
+
+        if (!ability.upcastable)
+          break;
+      }
+    }
+  }
+
+  if (!moved && me.current_speed > 0)
+  {
+    std::array<Action, MAX_MOVE_CANDIDATES> moves;
+    int                                     move_count = 0;
+    GenerateMoves(state, moves.data(), move_count);
+    for (int i = 0; i < move_count && count < MAX_ACTIONS; ++i)
+      out[count++] = moves[static_cast<std::size_t>(i)];
+  }
+}
+
+void SearchStrategy::Job::GenerateMoves(const BattleState& state, Action* out, int& count) const
+{
+  count                       = 0;
+  const BattleState::Unit& me = state.units[m_actor];
+
+  // 이동력 안의 BFS (용암/벽/점유 타일 제외)
+  std::array<std::int16_t, BattleState::MAX_TILES> steps;
+  std::array<std::int16_t, BattleState::MAX_TILES> queue;
+  const int                                        tile_count = state.width * state.height;
+  std::fill(steps.begin(), steps.begin() + tile_count, static_cast<std::int16_t>(-1));
+  int head = 0;
+  int tail = 0;
+  const int start = me.position.y * state.width + me.position.x;
+  steps[static_cast<std::size_t>(start)] = 0;
+  queue[static_cast<std::size_t>(tail++)] = static_cast<std::int16_t>(start);
+
+  // 사정거리: 쓸 수 있는 공격 수단 중 가장 긴 것
+  int reach = me.action_points > 0 && me.attack_dice_count > 0 ? me.attack_range : 0;
+  for (const AbilityModel& ability : m_abilities)
+    if (!ability.heal && me.action_points > 0)
+      reach = std::max(reach, ability.range < 0 ? 99 : ability.range);
+
+  struct Candidate
+  {
+    Math::ivec2 tile;
+    int         steps;
+    int         nearest;
+  };
+  Candidate in_range[MAX_MOVE_CANDIDATES];
+  int       in_range_count = 0;
+  Candidate approach{ me.position, 0, 1 << 20 };
+  Candidate retreat{ me.position, 0, -1 };
+
+  static const Math::ivec2 offsets[4] = { { 0, 1 }, { 0, -1 }, { -1, 0 }, { 1, 0 } };
+  while (head < tail)
+  {
+    const int         index = queue[static_cast<std::size_t>(head++)];
+    const int         step  = steps[static_cast<std::size_t>(index)];
+    const Math::ivec2 tile{ index % state.width, index / state.width };
+
+    if (step > 0)
+    {
+      int nearest = 1 << 20;
+      for (int i = 0; i < state.unit_count; ++i)
+        if (state.units[i].IsAlive() && IsEnemy(state, m_actor, i))
+          nearest = std::min(nearest, Manhattan(tile, state.units[i].position));
+
+      if (nearest <= reach)
+      {
+        // 사정거리 안이면 적에게서 먼 곳 우선 (원거리는 거리 유지, 근접은 어차피 1)
+        const Candidate c{ tile, step, nearest };
+        if (in_range_count < MAX_MOVE_CANDIDATES - 2)
+          in_range[in_range_count++] = c;
+        else
+        {
+          Candidate* worst = std::min_element(in_range, in_range + in_range_count,
+                                              [](const Candidate& a, const Candidate& b) { return a.nearest != b.nearest ? a.nearest < b.nearest : a.steps > b.steps; });
+          if (c.nearest > worst->nearest || (c.nearest == worst->nearest && c.steps < worst->steps))
+            *worst = c;
+        }
+      }
+      if (nearest < approach.nearest || (nearest == approach.nearest && step < approach.steps))
+        approach = { tile, step, nearest };
+      if (nearest > retreat.nearest)
+        retreat = { tile, step, nearest };
+    }
+
+    if (step >= me.current_speed)
+      continue;
+    for (const Math::ivec2& offset : offsets)
+    {
+      const Math::ivec2 next{ tile.x + offset.x, tile.y + offset.y };
+      if (!state.IsValidTile(next))
+        continue;
+      const int next_index = next.y * state.width + next.x;
+      if (steps[static_cast<std::size_t>(next_index)] >= 0 || state.TileAt(next) != GridSystem::TileType::Empty || state.UnitAt(next) >= 0)
+        continue;
+      steps[static_cast<std::size_t>(next_index)]  = static_cast<std::int16_t>(step + 1);
+      queue[static_cast<std::size_t>(tail++)]      = static_cast<std::int16_t>(next_index);
+    }
+  }
+
+  const auto push = [&](const Candidate& c)
+  {
+    if (c.steps <= 0 || count >= MAX_MOVE_CANDIDATES)
+      return;
+    for (int i = 0; i < count; ++i)
+      if (out[i].tile == c.tile)
+        return;
+    Action& a = out[count++];
+    a         = Action{};
+    a.type    = AIDecisionType::Move;
+    a.tile    = c.tile;
+    a.level   = c.steps;
+  };
+  for (int i = 0; i < in_range_count; ++i)
+    push(in_range[i]);
+  push(approach);
+  if (me.hp * 10 < me.max_hp * 4) // 체력 40% 미만이면 후퇴도 고려
+    push(retreat);
+}
+
+bool SearchStrategy::Job::CollectTargets(const BattleState& state, const AbilityModel& ability, Math::ivec2 aim, int* targets, int& count) const
+{
+  count                       = 0;
+  const BattleState::Unit& me = state.units[m_actor];
+  switch (ability.shape)
+  {
+    case AbilityModel::Shape::Single:
+    {
+      const int unit = state.UnitAt(aim);
+      if (unit >= 0)
+        targets[count++] = unit;
+      break;
+    }
+    case AbilityModel::Shape::Around:
+    {
+      const int radius = ability.range < 0 ? 99 : ability.range;
+      for (int i = 0; i < state.unit_count; ++i)
+        if (state.units[i].IsAlive() && (!ability.enemy_only || IsEnemy(state, m_actor, i)) && Manhattan(me.position, state.units[i].position) <= radius)
+          targets[count++] = i;
+      break;
+    }
+    case AbilityModel::Shape::Line:
+    {
+      // SpellSystem::ApplySpellEffect 와 같이 4방향, 벽에서 멈추고 아군도 맞는다
+      static const Math::ivec2 dirs[4] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+      const int                reach   = ability.range < 0 ? 99 : ability.range;
+      for (const Math::ivec2& dir : dirs)
+      {
+        for (int step = 1; step <= reach; ++step)
+        {
+          const Math::ivec2 tile{ me.position.x + dir.x * step, me.position.y + dir.y * step };
+          if (!state.IsValidTile(tile) || state.TileAt(tile) == GridSystem::TileType::Wall)
+            break;
+          const int unit = state.UnitAt(tile);
+          if (unit >= 0 && count < BattleState::MAX_UNITS)
+            targets[count++] = unit;
+        }
+      }
+      break;
+    }
+  }
+  return count > 0;
+}
+
+int SearchStrategy::Job::Outcomes(int dice_count, int dice_sides, int bonus, Outcome* out) const
+{
+  if (dice_count <= 0 || dice_sides <= 0)
+  {
+    out[0] = { 1.0, bonus };
+    return 1;
+  }
+  // 3점 Gauss-Hermite — 평균과 분산(그리고 정규 근사의 첨도)을 보존한다
+  const double mean   = dice_count * (dice_sides + 1) / 2.0;
+  const double spread = SQRT3 * std::sqrt(dice_count * (static_cast<double>(dice_sides) * dice_sides - 1.0) / 12.0);
+  const int    lo     = dice_count;
+  const int    hi     = dice_count * dice_sides;
+  const auto   point  = [&](double value) { return std::clamp(static_cast<int>(std::lround(value)), lo, hi) + bonus; };
+  out[0]              = { 1.0 / 6.0, point(mean - spread) };
+  out[1]              = { 2.0 / 3.0, point(mean) };
+  out[2]              = { 1.0 / 6.0, point(mean + spread) };
+  return 3;
+}
+
+bool SearchStrategy::Job::IsEnemy(const BattleState& state, int a, int b) const
+{
+  return (state.units[a].type == CharacterTypes::Dragon) != (state.units[b].type == CharacterTypes::Dragon);
+}
+
+bool SearchStrategy::Job::TimeUp()
+{
+  if (!m_aborted && IsCancelled())
+    m_aborted = true; // 결과는 버려지므로 깊이와 관계없이 바로 멈춘다
+  // 깊이 1 은 예산과 관계없이 끝까지 본다 (최소한 탐욕 수는 나오도록)
+  if (m_aborted || m_depth <= 1)
+    return m_aborted;
+  if (m_settings.node_budget > 0 && m_nodes >= m_settings.node_budget)
+    m_aborted = true;
+  else if (m_settings.time_budget_ms > 0.0 && (m_nodes & 63) == 0 && std::chrono::steady_clock::now() >= m_deadline)
+    m_aborted = true;
+  return m_aborted;
+}
+
+std::vector<SearchStrategy::AbilityModel> SearchStrategy::BuildAbilities(Character* actor) const
+{
+  std::vector<AbilityModel> abilities;
+  SpellSystem*              spells = Engine::GetGameStateManager().GetGSComponent<SpellSystem>();
+  if (!spells)
+    return abilities;
+
+  for (const SpellData* spell : spells->GetSpellsForClass(actor->TypeName()))
+  {
+    const SpellTargeting& t = spell->targeting;
+    AbilityModel          model;
+    if (t.geometry == "Single" && (t.filter == "Enemy" || t.filter == "Ally"))
+      model.shape = AbilityModel::Shape::Single;
+    else if (t.geometry == "Around" && t.filter == "Enemy")
+      model.shape = AbilityModel::Shape::Around;
+    else if (t.geometry == "Line")
+      model.shape = AbilityModel::Shape::Line;
+    else
+      continue; // Self / Point / OddEven — 탐색 모델 밖
+
+    std::string formula = spell->damage_formula;
+    model.heal          = formula.size() > 3 && formula[0] == '-' && formula[1] == '(';
+    if (model.heal)
+      formula = formula.substr(2, formula.size() - 3);
+
+    if (formula.rfind("flat_per_level:", 0) == 0)
+      model.flat = std::atoi(formula.c_str() + 15);
+    else if (!ParseDice(formula, model.dice_count, model.dice_sides))
+      continue; // 피해/회복 없는 주문 (상태 효과만) 은 모델 밖
+
+    if (model.heal != (t.filter == "Ally"))
+      continue;
+
+    model.id         = spell->id;
+    model.enemy_only = !model.heal;
+    model.range      = t.range;
+    model.level      = spell->spell_level;
+    model.upcastable = spell->upcastable;
+    if (model.upcastable && !spell->upcast_dice.empty())
+      ParseDice(spell->upcast_dice, model.upcast_count, model.upcast_sides);
+    if (model.level <= 0)
+      continue; // 슬롯 없는 주문은 CastSpell 의 소비 규칙이 달라 제외
+    abilities.push_back(model);
+  }
+  return abilities;
+}
+
+AIDecision SearchStrategy::Job::ToDecision(const Action& action) const
+{
+  AIDecision decision;
+  decision.type = action.type;
+  switch (action.type)
+  {
+    case AIDecisionType::Move:
+      decision.destination  = action.tile;
+      decision.lava_penalty = LAVA_TILE_PENALTY;
+      decision.reasoning    = "Search: move";
+      break;
+    case AIDecisionType::Attack:
+      decision.target    = m_roster[static_cast<std::size_t>(action.target)];
+      decision.reasoning = "Search: attack " + m_names[static_cast<std::size_t>(action.target)];
+      break;
+    case AIDecisionType::UseAbility:
+      decision.target       = m_roster[static_cast<std::size_t>(action.target)];
+      decision.abilityName  = m_abilities[static_cast<std::size_t>(action.ability)].id;
+      decision.upcast_level = action.level;
+      decision.reasoning    = "Search: cast " + decision.abilityName + " (level " + std::to_string(action.level) + ") on " + m_names[static_cast<std::size_t>(action.target)];
+      break;
+    default:
+      decision.type      = AIDecisionType::EndTurn;
+      decision.reasoning = "Search: end turn";
+      break;
+  }
+  return decision;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file SearchStrategy.h
+ * @author Taekyung Ho
+ * @brief BattleState 복사본 위에서 행동 순서를 탐색하는 expectimax AI 전략
+ * @date 2025 Fall
+ */
+#pragma once
+#include "IAIStrategy.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+/// 탐색 예산 — AISystem::Init 에서 타입별로 고른다
+struct SearchSettings
+{
+  double time_budget_ms = 20.0; // 결정 하나당. 0 이하면 시간 제한 없음
+  long long node_budget = 0;    // 0 보다 크면 노드 수로도 끊는다 (재현 가능한 벤치마크용)
+  int max_depth         = 4;    // 한 턴 안의 행동 수 (반복 심화 상한)
+};
+
+/// 누적 탐색 통계 — 벤치마크 / 디버그 출력용
+struct SearchStats
+{
+  long long decisions      = 0;
+  long long nodes          = 0;
+  double    seconds        = 0.0;
+  long long depth_sum      = 0; // 결정마다 끝까지 마친 반복 심화 깊이의 합
+  long long fallback_count = 0; // 스냅샷 용량 초과로 스크립트 전략을 쓴 횟수
+
+  double NodesPerSecond() const { return seconds > 0.0 ? static_cast<double>(nodes) / seconds : 0.0; }
+};
+
+/// 현재 턴의 행동 순서(이동 / 기본 공격 / 업캐스트 레벨별 주문 / 턴 종료)를 expectimax 로 탐색한다.
+///   - 라이브 GameObject 대신 BattleState 를 복사해 가며 전개한다 (노드당 memcpy 한 번)
+///   - 피해 주사위는 3점 chance 노드 (평균 ± √3σ, 확률 1/6 · 2/3 · 1/6) 로 근사
+///   - 시간/노드 예산 안에서 깊이 1 부터 반복 심화, 끝까지 마친 깊이의 최선 첫 수를 반환
+/// 모델이 다루는 것: 이동(용암 제외), 기본 공격, Single/Around/Line 피해·회복 주문.
+/// 상태 효과 / 지형 생성 / 넉백 주문과 상대 턴은 전개하지 않고 평가 함수로만 반영한다.
+/// 맵이 BattleState 용량을 넘으면 fallback 전략(보통 기존 스크립트 전략)에 맡긴다.
+/// 탐색은 PrepareDecision 이 만든 작업 안에서만 일어나므로 워커 스레드에서 돌려도 된다.
+class SearchStrategy : public IAIStrategy
+{
+  public:
+  SearchStrategy(const SearchSettings& settings, std::unique_ptr<IAIStrategy> fallback);
+
+  AIDecision                     MakeDecision(Character* actor) override;
+  std::unique_ptr<AIDecisionJob> PrepareDecision(Character* actor) override;
+  void                           FinishDecision(const AIDecisionJob& job) override;
+
+  const SearchStats& GetStats() const { return m_stats; }
+  void               ResetStats() { m_stats = SearchStats{}; }
+
+  private:
+  /// 탐색에서 쓸 수 있는 주문 (SpellData 에서 피해식을 미리 풀어 둔 것)
+  struct AbilityModel
+  {
+    std::string id;
+    enum class Shape { Single, Around, Line } shape = Shape::Single;
+    bool enemy_only  = true;  // Single: Enemy/Ally 필터, Around: Enemy 만
+    bool heal        = false; // "-(XdY)" 피해식
+    int  range       = 0;     // -1 = 무한
+    int  level       = 0;     // 요구 슬롯 레벨
+    bool upcastable  = false;
+    int  dice_count  = 0;     // 기본 피해 주사위
+    int  dice_sides  = 0;
+    int  flat        = 0;     // flat_per_level:N 이면 N (레벨당)
+    int  upcast_count = 0;    // 레벨 차이당 추가 주사위
+    int  upcast_sides = 0;
+  };
+
+  class Job; // 결정 하나의 탐색 (SearchStrategy.cpp)
+
+  std::vector<AbilityModel> BuildAbilities(Character* actor) const;
+
+  SearchSettings               m_settings;
+  std::unique_ptr<IAIStrategy> m_fallback;
+  SearchStats                  m_stats;
+};
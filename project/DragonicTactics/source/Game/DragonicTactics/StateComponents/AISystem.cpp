@@ -11,14 +11,18 @@
 /* have to include characters IA */
 
 #include "AI/ClericStrategy.h"
+#include "AI/DragonStrategy.h"
 #include "AI/FighterStrategy.h"
 // #include "AI/WizardStrategy.h" (TODO)
 
+#include "../StateComponents/BattleHash.h"
 #include "../StateComponents/CombatSystem.h"
 #include "../StateComponents/GridSystem.h"
 #include "../StateComponents/SpellSystem.h"
 #include "../StateComponents/TurnManager.h"
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/GameStateManager.h"
+#include "./Engine/Profiler.h"
 #include "./Game/DragonicTactics/Objects/Components/GridPosition.h"
 #include "./Game/DragonicTactics/Objects/Components/MovementComponent.h"
 #include "EventBus.h"
@@ -29,6 +33,14 @@ AISystem::AISystem()
 }
 
 AISystem::~AISystem()
+{
+  // 워커가 끝나야 future 가 사라진다 — 취소해 두면 다음 확인 지점에서 바로 돌아온다
+  CancelDecision();
+  m_cancelled.clear();
+  ClearStrategies();
+}
+
+void AISystem::ClearStrategies()
 {
   for (auto& pair : m_strategies)
   {
@@ -37,34 +49,190 @@ AISystem::~AISystem()
   m_strategies.clear();
 }
 
-void AISystem::Init()
+void AISystem::Init(const AIStrategyConfig& config)
 {
+  CancelDecision();
+  ClearStrategies();
+  m_cache.clear(); // 전략이 바뀌면 기억한 결정도 무효
+
   // [핵심] 캐릭터 타입에 맞는 두뇌를 갈아끼우는 곳
   m_strategies[CharacterTypes::Fighter] = new FighterStrategy();
   m_strategies[CharacterTypes::Cleric]  = new ClericStrategy();
+  // 드래곤은 게임에서 플레이어가 조작 — 시뮬레이터처럼 AI 로 돌릴 때만 사용
+  m_strategies[CharacterTypes::Dragon]  = new DragonStrategy();
 
   // 나중에 이렇게 추가하면 됩니다:
   // m_strategies[CharacterTypes::Wizard] = new WizardStrategy();
+
+  // 탐색 전략을 고른 타입은 스크립트 전략을 fallback 으로 감싼다 (스냅샷 용량 초과 시 사용)
+  for (CharacterTypes type : config.search_types)
+  {
+	auto it = m_strategies.find(type);
+	if (it == m_strategies.end())
+	  continue;
+	it->second = new SearchStrategy(config.search, std::unique_ptr<IAIStrategy>(it->second));
+  }
 }
 
 AIDecision AISystem::MakeDecision(Character* actor)
 {
+  PROFILE_SCOPE("AISystem::MakeDecision");
+  ALLOCATION_SCOPE(AI);
   if (!actor)
 	return { AIDecisionType::EndTurn, nullptr, {}, "", "Actor is null" };
 
+  std::uint64_t		key		 = 0;
+  const AIDecision* cached	 = nullptr;
+  const bool		cacheable = FindCachedDecision(actor, key, cached);
+  if (cached)
+	return *cached;
+
   CharacterTypes type = actor->GetCharacterType();
 
   if (m_strategies.find(type) != m_strategies.end())
   {
-	return m_strategies[type]->MakeDecision(actor);
+	AIDecision decision = m_strategies[type]->MakeDecision(actor);
+	if (cacheable)
+	  StoreDecision(actor, key, decision);
+	return decision;
   }
 
   return { AIDecisionType::EndTurn, nullptr, {}, "", "No strategy found" };
 }
 
+void AISystem::BeginDecision(Character* actor)
+{
+  CancelDecision();
+  ReapCancelled();
+  if (!actor)
+	return;
+
+  m_pending.actor = actor;
+
+  // 같은 상태에서 이미 내린 결정이면 워커를 띄우지 않는다
+  const AIDecision* cached = nullptr;
+  m_pending.cacheable		 = FindCachedDecision(actor, m_pending.cache_key, cached);
+  auto it					 = m_strategies.find(actor->GetCharacterType());
+  if (!cached && it != m_strategies.end())
+	m_pending.job = it->second->PrepareDecision(actor);
+
+  if (!m_pending.job)
+  {
+	// 캐시 적중이거나 스냅샷 작업이 없으면 지금 메인 스레드에서 결정해 둔다
+	std::promise<AIDecision> ready;
+	if (cached)
+	  ready.set_value(*cached);
+	else
+	{
+	  AIDecision decision = it != m_strategies.end() ? it->second->MakeDecision(actor) : AIDecision{ AIDecisionType::EndTurn, nullptr, {}, "", "No strategy found" };
+	  if (m_pending.cacheable)
+		StoreDecision(actor, m_pending.cache_key, decision);
+	  ready.set_value(std::move(decision));
+	}
+	m_pending.cacheable = false;
+	m_pending.result	= ready.get_future();
+	return;
+  }
+
+  m_pending.strategy = it->second;
+#if defined(__EMSCRIPTEN__)
+  // 웹 빌드는 스레드가 없으므로 PollDecision 에서 계산한다
+  const auto policy = std::launch::deferred;
+#else
+  const auto policy = std::launch::async;
+#endif
+  m_pending.result = std::async(policy, [job = m_pending.job] { return job->Run(); });
+}
+
+bool AISystem::PollDecision(AIDecision& out)
+{
+  ReapCancelled();
+  if (!m_pending.actor)
+	return false;
+  if (m_pending.result.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
+	return false;
+
+  out = m_pending.result.get();
+  if (m_pending.job)
+	m_pending.strategy->FinishDecision(*m_pending.job);
+  if (m_pending.cacheable)
+	StoreDecision(m_pending.actor, m_pending.cache_key, out);
+  m_pending = PendingDecision{};
+  return true;
+}
+
+void AISystem::CancelDecision()
+{
+  if (!m_pending.actor)
+	return;
+  if (m_pending.job)
+  {
+	m_pending.job->Cancel();
+	m_cancelled.push_back(std::move(m_pending));
+  }
+  m_pending = PendingDecision{};
+}
+
+void AISystem::ReapCancelled()
+{
+  // std::async future 의 소멸자는 작업이 끝날 때까지 막으므로 끝난 것만 지운다
+  std::erase_if(m_cancelled, [](const PendingDecision& p) { return p.result.wait_for(std::chrono::seconds(0)) != std::future_status::timeout; });
+}
+
+void AISystem::SetDecisionCacheEnabled(bool enabled)
+{
+  m_cache_enabled = enabled;
+  m_cache.clear();
+}
+
+bool AISystem::FindCachedDecision(Character* actor, std::uint64_t& key, const AIDecision*& hit)
+{
+  hit				= nullptr;
+  BattleHash* hash = Engine::GetGameStateManager().GetGSComponent<BattleHash>();
+  if (!m_cache_enabled || hash == nullptr)
+	return false;
+
+  hash->Refresh(actor); // AP 소비처럼 이벤트 없이 바뀐 값은 행동하는 본인 것만 맞추면 된다
+  key			 = hash->GetHash();
+  const auto it = m_cache.find({ key, actor });
+  if (it == m_cache.end())
+  {
+	++m_cache_stats.misses;
+	return true;
+  }
+  ++m_cache_stats.hits;
+  hit = &it->second;
+  return true;
+}
+
+void AISystem::StoreDecision(Character* actor, std::uint64_t key, const AIDecision& decision)
+{
+  if (m_cache.size() >= MAX_CACHED_DECISIONS)
+	m_cache.clear();
+  m_cache[{ key, actor }] = decision;
+}
+
+SearchStats AISystem::GetSearchStats() const
+{
+  SearchStats total;
+  for (const auto& pair : m_strategies)
+  {
+	if (const auto* search = dynamic_cast<const SearchStrategy*>(pair.second))
+	{
+	  const SearchStats& stats = search->GetStats();
+	  total.decisions += stats.decisions;
+	  total.nodes += stats.nodes;
+	  total.seconds += stats.seconds;
+	  total.depth_sum += stats.depth_sum;
+	  total.fallback_count += stats.fallback_count;
+	}
+  }
+  return total;
+}
+
 void AISystem::ExecuteDecision(Character* actor, const AIDecision& decision)
 {
-  Engine::GetLogger().LogEvent(actor->TypeName() + " AI Decision: " + decision.reasoning);
+  Engine::GetLogger().LogEvent("{} AI Decision: {}", actor->TypeName(), decision.reasoning);
 
   auto&			gs			 = Engine::GetGameStateManager();
   GridSystem*	grid		 = gs.GetGSComponent<GridSystem>();
@@ -105,7 +273,7 @@ void AISystem::ExecuteDecision(Character* actor, const AIDecision& decision)
 	case AIDecisionType::UseAbility:
 	  if (spell_system)
 	  {
-		spell_system->CastSpell(actor, decision.abilityName, decision.target->GetGridPosition()->Get());
+		spell_system->CastSpell(actor, decision.abilityName, decision.target->GetGridPosition()->Get(), decision.upcast_level);
 		actionExecuted = true;
 	  }
 	  break;
@@ -8,7 +8,21 @@
 #pragma once
 #include "./Engine/Component.h"
 #include "AI/IAIStrategy.h"
+#include "AI/SearchStrategy.h"
+#include <cstdint>
+#include <future>
 #include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/// 캐릭터 타입별 전략 선택 — 비어 있으면 모두 기존 스크립트 전략
+struct AIStrategyConfig
+{
+  std::set<CharacterTypes> search_types; // SearchStrategy 로 돌릴 타입 (스크립트 전략은 fallback 으로 남는다)
+  SearchSettings           search;
+};
 
 class AISystem : public CS230::Component
 {
@@ -16,11 +30,101 @@ class AISystem : public CS230::Component
   AISystem();
   ~AISystem();
 
-  void Init();
+  void Init(const AIStrategyConfig& config = {});
 
   AIDecision MakeDecision(Character* actor);
   void		 ExecuteDecision(Character* actor, const AIDecision& decision);
 
+  /// 비동기 결정 — 메인 스레드에서 스냅샷을 찍고 워커 스레드에서 계산한다.
+  /// 스냅샷 작업을 만들지 못하는 전략(라이브 객체를 읽는 스크립트 전략)은 여기서 바로 결정해 둔다.
+  /// 진행 중인 결정이 있으면 먼저 취소한다.
+  void BeginDecision(Character* actor);
+  /// 결정이 끝났으면 out 을 채우고 true. 아직 계산 중이면 false (프레임을 막지 않는다)
+  bool PollDecision(AIDecision& out);
+  /// 진행 중인 결정을 버린다. 워커는 다음 확인 지점에서 멈추고, 끝나는 것은 기다리지 않는다
+  void CancelDecision();
+
+  bool IsDecisionPending() const
+  {
+	return m_pending.actor != nullptr;
+  }
+
+  Character* GetPendingActor() const
+  {
+	return m_pending.actor;
+  }
+
+  /// SearchStrategy 들의 누적 통계 합 (탐색 전략이 없으면 0)
+  SearchStats GetSearchStats() const;
+
+  /// 결정 캐시 — (BattleHash, actor) 가 같으면 전략을 다시 돌리지 않고 기억한 결정을 돌려준다.
+  /// GS 에 BattleHash 가 없으면 캐시를 쓰지 않는다.
+  struct DecisionCacheStats
+  {
+	long long hits	 = 0;
+	long long misses = 0;
+
+	double HitRate() const
+	{
+	  return hits + misses > 0 ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+	}
+  };
+
+  void SetDecisionCacheEnabled(bool enabled);
+  bool IsDecisionCacheEnabled() const
+  {
+	return m_cache_enabled;
+  }
+  const DecisionCacheStats& GetDecisionCacheStats() const
+  {
+	return m_cache_stats;
+  }
+  std::size_t GetDecisionCacheSize() const
+  {
+	return m_cache.size();
+  }
+
   private:
+  void ClearStrategies();
+  void ReapCancelled();
+
+  /// 캐시 조회. 키를 만들 수 있으면 key 를 채우고 true, 그 중 기억한 결정이 있으면 hit 도 채운다
+  bool FindCachedDecision(Character* actor, std::uint64_t& key, const AIDecision*& hit);
+  void StoreDecision(Character* actor, std::uint64_t key, const AIDecision& decision);
+
+  struct CacheKey
+  {
+	std::uint64_t	 hash;
+	const Character* actor;
+
+	bool operator==(const CacheKey&) const = default;
+  };
+
+  struct CacheKeyHash
+  {
+	std::size_t operator()(const CacheKey& key) const
+	{
+	  return static_cast<std::size_t>(key.hash ^ (reinterpret_cast<std::uintptr_t>(key.actor) * 0x9E3779B97F4A7C15ULL));
+	}
+  };
+
+  static constexpr std::size_t MAX_CACHED_DECISIONS = 4096; // 넘으면 통째로 비운다 (전투 하나에 충분)
+
+  struct PendingDecision
+  {
+	Character*					   actor	= nullptr;
+	IAIStrategy*				   strategy = nullptr; // job 이 있을 때 FinishDecision 을 부를 전략
+	std::shared_ptr<AIDecisionJob> job;
+	std::future<AIDecision>		   result;
+	bool						   cacheable = false; // 끝나면 cache_key 로 기억한다
+	std::uint64_t				   cache_key = 0;
+  };
+
   std::map<CharacterTypes, IAIStrategy*> m_strategies;
+  PendingDecision						 m_pending;
+  std::vector<PendingDecision>			 m_cancelled; // 취소했지만 워커가 아직 돌고 있는 작업
+
+  bool														m_cache_enabled = true;
+  std::unordered_map<CacheKey, AIDecision, CacheKeyHash> m_cache;
+  DecisionCacheStats										m_cache_stats;
 };
\ No newline at end of file
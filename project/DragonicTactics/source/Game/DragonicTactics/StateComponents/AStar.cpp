@@ -7,8 +7,10 @@
 #include "pch.h"
 
 #include "./CS200/IRenderer2D.h"
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/Engine.h"
 #include "./Engine/Logger.h"
+#include "./Engine/Profiler.h"
 #include "./Game/DragonicTactics/Objects/Character.h"
 #include "GridSystem.h"
 #include <cassert>
@@ -43,6 +45,8 @@ std::vector<Math::ivec2> GridSystem::GetNeighbors(Math::ivec2 position) const
 
 std::vector<Math::ivec2> GridSystem::FindPath(Math::ivec2 start, Math::ivec2 goal, int lava_penalty)
 {
+  PROFILE_SCOPE("GridSystem::FindPath");
+  ALLOCATION_SCOPE(Pathfinding);
   // edge cases
   if (!IsValidTile(start) || !IsValidTile(goal))
   {
@@ -65,119 +69,180 @@ std::vector<Math::ivec2> GridSystem::FindPath(Math::ivec2 start, Math::ivec2 goa
 	return {};
   }
 
-  // A* algorithm
-  std::vector<Node*>				   openSet;
-  std::vector<Node*>				   closedSet;
-  std::map<std::pair<int, int>, Node*> allNodes; // to find nodes with positions easily!!
+  // 같은 start 의 거리장이 이미 있으면 탐색 없이 흐름장을 따라간다 (비용은 A* 와 같고 동률 경로 선택만 다를 수 있다)
+  std::vector<Math::ivec2> path;
+  if (const DistanceField* field = FindCachedDistanceField(start, lava_penalty))
+  {
+	if (field->PathTo(goal, path))
+	  return path;
+  }
+
+  // A* — 노드 상태/힙은 pathfinder_ 가 재사용 (탐색 중 할당 없음)
+  // 비용이 균일하면 JPS (경로 길이는 같고 동률 경로 중 세로 우선인 것을 고른다)
+  if (pathfinding_mode_ == PathfindingMode::Hierarchical)
+	hierarchy_.FindPath(*this, start, goal, lava_penalty, pathfinder_, path);
+  else if (UsesJumpPointSearch(lava_penalty))
+	pathfinder_.FindPathJumpPoint(*this, start, goal, path);
+  else
+	pathfinder_.FindPath(*this, start, goal, lava_penalty, path);
+
+  if (path.empty())
+  {
+	Engine::GetLogger().LogError("GridSystem: No path found from ({},{}) to ({},{})", start.x, start.y, goal.x, goal.y);
+  }
 
-  // create start node
-  Node* startNode = new Node(start, 0, ManhattanDistance(start, goal));
-  openSet.push_back(startNode);
-  allNodes[{ static_cast<int>(start.x), static_cast<int>(start.y) }] = startNode;
 
-  Node* goalNode = nullptr;
+  return path;
+}
 
-  while (!openSet.empty())
+GridSystem::NearestPathResult GridSystem::FindPathToNearest(Math::ivec2 start, const std::vector<Math::ivec2>& goals, int lava_penalty)
+{
+  PROFILE_SCOPE("GridSystem::FindPathToNearest");
+  ALLOCATION_SCOPE(Pathfinding);
+  NearestPathResult result;
+  if (!IsValidTile(start))
   {
-	// find node with lowest fCost
-	auto minIt = std::min_element(std::begin(openSet), std::end(openSet), [](Node* a, Node* b) { return static_cast<int>(a->fCost()) < static_cast<int>(b->fCost()); });
+	Engine::GetLogger().LogError("GridSystem : Invalid start position");
+	return result;
+  }
 
-	Node* current = *minIt;
-	openSet.erase(minIt);
-	closedSet.push_back(current);
+  // FindPath 의 목표 조건과 같은 필터 — AI 가 매 프레임 호출하므로 걸러진 목표는 로그를 남기지 않는다
+  std::vector<Math::ivec2> valid_goals;
+  valid_goals.reserve(goals.size());
+  for (const Math::ivec2& goal : goals)
+  {
+	if (!IsValidTile(goal) || goal == start)
+	  continue;
+	TileType goal_type = GetTileType(goal);
+	if ((goal_type != TileType::Empty && goal_type != TileType::Lava) || IsOccupied(goal))
+	  continue;
+	valid_goals.push_back(goal);
+  }
+  if (valid_goals.empty())
+	return result;
 
-	// check if we reached the goal
-	if (current->position == goal)
+  // 캐시된 거리장에서 비용이 가장 낮은 목표 선택 (같으면 앞쪽) 후 부모를 따라 경로 복원
+  const DistanceField& field	 = GetDistanceField(start, lava_penalty);
+  int					 best_cost = -1;
+  for (const Math::ivec2& goal : valid_goals)
+  {
+	int cost = field.Distance(goal);
+	if (cost > 0 && (best_cost < 0 || cost < best_cost))
 	{
-	  goalNode = current;
-	  break;
+	  best_cost	  = cost;
+	  result.goal = goal;
 	}
+  }
+  if (best_cost < 0)
+	return result;
+
+  result.found = field.PathTo(result.goal, result.path);
+  result.cost  = best_cost;
+  return result;
+}
 
-	// check neighbors
-	std::vector<Math::ivec2> neighbors = GetNeighbors(current->position);
-	for (const Math::ivec2& neighborPos : neighbors)
+// ========================================
+// 거리장 캐시
+// ========================================
+
+void GridSystem::SetPathfindingMode(PathfindingMode mode, int cluster_size)
+{
+  pathfinding_mode_ = mode;
+  if (mode == PathfindingMode::Hierarchical)
+	hierarchy_.Build(*this, cluster_size);
+  else
+	hierarchy_.Clear();
+}
+
+const DistanceField* GridSystem::FindCachedDistanceField(Math::ivec2 source, int lava_penalty)
+{
+  for (CachedField& entry : distance_fields_)
+  {
+	if (entry.valid && entry.field.source == source && entry.field.lava_penalty == lava_penalty)
 	{
-	  // skip if not passable (Wall/Invalid) or in closed set
-	  {
-	    TileType n_type    = GetTileType(neighborPos);
-	    bool     n_passable = (n_type == TileType::Empty || n_type == TileType::Lava)
-	                          && !IsOccupied(neighborPos);
-	    if (!n_passable)
-	      continue;
-	  }
-
-	  bool inClosedSet = false;
-	  for (Node* closed : closedSet)
-	  {
-		if (closed->position == neighborPos)
-		{
-		  inClosedSet = true;
-		  break;
-		}
-	  }
-
-	  if (inClosedSet)
-		continue;
-
-	  int tile_cost = 1 + (lava_penalty > 0 && GetTileType(neighborPos) == TileType::Lava ? lava_penalty : 0);
-	  int newGCost  = current->gCost + tile_cost;
-
-	  // check if neighbor is in open set
-	  Node* neighborNode = nullptr;
-	  auto	nodeKey		 = std::make_pair(static_cast<int>(neighborPos.x), static_cast<int>(neighborPos.y));
-	  auto  nodeIt       = allNodes.find(nodeKey);
-	  if (nodeIt == allNodes.end()) // not yet visited
-	  {
-		// create new node
-		neighborNode = new Node(neighborPos, newGCost, ManhattanDistance(neighborPos, goal), current);
-		openSet.push_back(neighborNode);
-		allNodes[nodeKey] = neighborNode;
-	  }
-	  else
-	  {
-		// already in open set — update if a cheaper path was found
-		neighborNode       = nodeIt->second;
-		bool inOpen        = std::find(openSet.begin(), openSet.end(), neighborNode) != openSet.end();
-		if (inOpen && newGCost < neighborNode->gCost)
-		{
-		  neighborNode->gCost  = newGCost;
-		  neighborNode->parent = current;
-		}
-	  }
+	  ++distance_field_stats_.hits;
+	  entry.last_used = ++distance_field_clock_;
+	  return &entry.field;
 	}
   }
+  return nullptr;
+}
 
-  // reconstruct path
-  std::vector<Math::ivec2> path;
+const DistanceField& GridSystem::GetDistanceField(Math::ivec2 source, int lava_penalty)
+{
+  if (const DistanceField* cached = FindCachedDistanceField(source, lava_penalty))
+	return *cached;
 
-  if (goalNode != nullptr)
+  ++distance_field_clock_;
+
+  CachedField* slot = nullptr;
+  for (CachedField& entry : distance_fields_)
   {
-	Node* current = goalNode;
-	while (current != nullptr)
-	{
-	  if (current->position != start)
-	  {
-		path.push_back(current->position);
-	  }
-	  current = current->parent;
-	}
-	std::reverse(path.begin(), path.end());
+	// 교체 후보: 빈 슬롯 우선, 없으면 가장 오래 안 쓴 슬롯
+	if (slot == nullptr || (slot->valid && (!entry.valid || entry.last_used < slot->last_used)))
+	  slot = &entry;
   }
 
-  // cleanup
-  for (auto& pair : allNodes)
+  ++distance_field_stats_.misses;
+  if (static_cast<int>(distance_fields_.size()) < MAX_DISTANCE_FIELDS && (slot == nullptr || slot->valid))
   {
-	delete pair.second;
+	assert(distance_fields_.size() < distance_fields_.capacity()); // 재할당되면 앞서 돌려준 참조가 깨진다
+	distance_fields_.emplace_back();
+	slot = &distance_fields_.back();
   }
 
-  if (path.empty())
+  pathfinder_.BuildDistanceField(*this, source, lava_penalty, slot->field);
+  slot->valid	  = true;
+  slot->last_used = distance_field_clock_;
+  return slot->field;
+}
+
+int GridSystem::GetPathCost(Math::ivec2 source, Math::ivec2 target, int lava_penalty)
+{
+  if (!IsValidTile(source) || !IsValidTile(target))
+	return -1;
+  return GetDistanceField(source, lava_penalty).Distance(target);
+}
+
+GridSystem::DistanceFieldStats GridSystem::GetDistanceFieldStats() const
+{
+  DistanceFieldStats stats = distance_field_stats_;
+  stats.cached			   = 0;
+  for (const CachedField& entry : distance_fields_)
   {
-	Engine::GetLogger().LogError(
-	  "GridSystem: No path found from (" + std::to_string(static_cast<int>(start.x)) + "," + std::to_string(static_cast<int>(start.y)) + ") to (" + std::to_string(static_cast<int>(goal.x)) + "," + std::to_string(static_cast<int>(goal.y)) + ")");
+	if (entry.valid)
+	  ++stats.cached;
   }
+  return stats;
+}
+
+void GridSystem::ResetDistanceFieldStats()
+{
+  distance_field_stats_ = DistanceFieldStats{};
+}
 
+void GridSystem::InvalidateDistanceFields(Math::ivec2 changed_tile)
+{
+  for (CachedField& entry : distance_fields_)
+  {
+	if (entry.valid && entry.field.Touches(changed_tile))
+	{
+	  entry.valid = false;
+	  ++distance_field_stats_.invalidations;
+	}
+  }
+}
 
-  return path;
+void GridSystem::ClearDistanceFields()
+{
+  for (CachedField& entry : distance_fields_)
+  {
+	if (entry.valid)
+	{
+	  entry.valid = false;
+	  ++distance_field_stats_.invalidations;
+	}
+  }
 }
 
 // int GridSystem::GetPathLength(Math::ivec2 start, Math::ivec2 goal)
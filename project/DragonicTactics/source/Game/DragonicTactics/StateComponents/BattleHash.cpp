@@ -0,0 +1,114 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "BattleHash.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include "EventBus.h"
+#include "GridSystem.h"
+#include "Zobrist.h"
+
+#include "../Objects/Character.h"
+#include "../Objects/Components/ActionPoints.h"
+#include "../Objects/Components/SpellSlots.h"
+#include "../Objects/Components/StatsComponent.h"
+#include "../Types/Events.h"
+
+namespace
+{
+  std::uint64_t UnitKey(Character* character)
+  {
+	return Zobrist::Key(Zobrist::Feature::Unit, reinterpret_cast<std::uintptr_t>(character), BattleHash::UnitStateHash(character));
+  }
+}
+
+std::uint64_t BattleHash::UnitStateHash(Character* character)
+{
+  const StatsComponent* stats = character->GetStatsComponent();
+  const ActionPoints*	ap	  = character->GetActionPointsComponent();
+
+  std::uint64_t h	= Zobrist::Mix(static_cast<std::uint64_t>(character->GetCharacterType()));
+  const auto	add = [&h](std::int64_t value) { h = Zobrist::Mix(h ^ static_cast<std::uint64_t>(value)); };
+  add(stats->GetCurrentHP());
+  add(stats->GetSpeed());
+  add(stats->GetAttackRange());
+  add(ap->GetCurrentPoints());
+  add(character->HasAttackedThisTurn() ? 1 : 0);
+  if (SpellSlots* slots = character->GetSpellSlots())
+  {
+	for (const auto& [level, max_count] : slots->GetMaxSlots())
+	  add(level * 256 + slots->GetSpellSlotCount(level));
+  }
+  for (const ActiveEffect& effect : character->GetActiveEffects())
+  {
+	// std::hash 는 표준 라이브러리마다 달라 저널 체크섬이 플랫폼 사이에서 어긋나므로 FNV-1a 로 섞는다
+	std::uint64_t name = 0xCBF29CE484222325ULL;
+	for (const char c : effect.name)
+	  name = (name ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+	add(static_cast<std::int64_t>(name));
+	add(effect.duration * 65536 + effect.magnitude);
+  }
+  return h;
+}
+
+void BattleHash::Subscribe(EventBus* event_bus)
+{
+  subscriptions_.clear();
+  Clear();
+  if (const GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>())
+  {
+	for (Character* character : grid->GetOccupants())
+	  Refresh(character);
+  }
+
+  // 이벤트가 온 유닛만 다시 계산한다 — 나머지 유닛 키는 그대로
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDamagedEvent>([this](const CharacterDamagedEvent& e) { Refresh(e.target); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterHealedEvent>([this](const CharacterHealedEvent& e) { Refresh(e.target); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterDeathEvent>([this](const CharacterDeathEvent& e) { Forget(e.character); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterMovedEvent>([this](const CharacterMovedEvent& e) { Refresh(e.character); }));
+  subscriptions_.push_back(event_bus->Subscribe<CharacterAttackedEvent>([this](const CharacterAttackedEvent& e) { Refresh(e.attacker); }));
+  subscriptions_.push_back(event_bus->Subscribe<SpellSlotConsumedEvent>([this](const SpellSlotConsumedEvent& e) { Refresh(e.character); }));
+  subscriptions_.push_back(event_bus->Subscribe<StatusEffectAddedEvent>([this](const StatusEffectAddedEvent& e) { Refresh(e.target); }));
+  subscriptions_.push_back(event_bus->Subscribe<StatusEffectRemovedEvent>([this](const StatusEffectRemovedEvent& e) { Refresh(e.target); }));
+  subscriptions_.push_back(event_bus->Subscribe<TurnStartedEvent>([this](const TurnStartedEvent& e) { Refresh(e.character); }));
+}
+
+std::uint64_t BattleHash::GetHash() const
+{
+  const GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  return (grid != nullptr ? grid->GetZobristKey() : 0) ^ units_;
+}
+
+void BattleHash::Refresh(Character* character)
+{
+  if (character == nullptr || !character->IsAlive())
+  {
+	Forget(character);
+	return;
+  }
+  std::uint64_t&	  key	  = unit_keys_[character];
+  const std::uint64_t updated = UnitKey(character);
+  units_ ^= key ^ updated;
+  key = updated;
+}
+
+void BattleHash::Forget(const Character* character)
+{
+  const auto it = unit_keys_.find(character);
+  if (it == unit_keys_.end())
+	return;
+  units_ ^= it->second;
+  unit_keys_.erase(it);
+}
+
+void BattleHash::Clear()
+{
+  unit_keys_.clear();
+  units_ = 0;
+}
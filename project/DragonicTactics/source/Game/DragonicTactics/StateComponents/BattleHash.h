@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Component.h"
+#include "EventBus.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Character;
+
+/// @brief 전투 상태의 64비트 Zobrist 해시 (AISystem 결정 캐시의 키)
+///
+/// 해시 = GridSystem::GetZobristKey() (타일 종류, 캐릭터 배치) ^ 유닛별 상태 키의 XOR.
+/// 유닛 상태 키는 HP / AP / 이동력 / 사거리 / 공격 여부 / 주문 슬롯 / 상태 효과를 섞은 값이며,
+/// 그 유닛에 관한 이벤트(피해, 회복, 이동, 주문, 상태 효과, 턴 시작)가 올 때 그 유닛 것만 다시 계산한다.
+/// 이벤트 없이 바뀌는 값(AP 소비 등)은 질의 직전에 Refresh(actor) 로 맞춘다.
+class BattleHash : public CS230::Component
+{
+  public:
+  /// 전투 시작 전, 캐릭터 배치 후에 한 번 호출 (그리드의 캐릭터로 유닛 키를 채운다). 다시 부르면 이전 구독은 해지된다
+  void Subscribe(EventBus* event_bus);
+
+  std::uint64_t GetHash() const;
+
+  /// character 의 상태 키를 다시 계산해 반영
+  void Refresh(Character* character);
+  /// 죽은 캐릭터를 뺀다 (이후 역참조하지 않는다)
+  void Forget(const Character* character);
+  void Clear();
+
+  /// 유닛 상태 요약 (포인터를 섞지 않으므로 다른 실행과도 비교할 수 있다 — BattleRecorder 체크섬에 쓴다)
+  static std::uint64_t UnitStateHash(Character* character);
+
+  private:
+  std::unordered_map<const Character*, std::uint64_t> unit_keys_;
+  std::uint64_t										 units_ = 0; // unit_keys_ 값의 XOR
+  std::vector<EventBus::Subscription>				 subscriptions_;
+};
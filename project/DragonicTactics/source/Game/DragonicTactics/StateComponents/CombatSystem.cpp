@@ -16,7 +16,6 @@
 #include "./Game/DragonicTactics/Objects/Components/GridPosition.h"
 #include "./Game/DragonicTactics/Objects/Components/StatsComponent.h"
 #include "./Game/DragonicTactics/StateComponents/GridSystem.h"
-#include "Game/DragonicTactics/Debugger/DebugManager.h"
 #include "Game/DragonicTactics/StateComponents/StatusEffectHandler.h"
 #include "CombatSystem.h"
 
@@ -46,8 +45,7 @@ int CombatSystem::CalculateDamage(Character* attacker, Character* defender, cons
 	}
   }
   int totalDamage = diceRoll + baseDamage;
-  Engine::GetLogger().LogEvent(
-	"CombatSystem: " + attacker->TypeName() + " rolled " + damageDice + " = " + std::to_string(diceRoll) + " + " + std::to_string(baseDamage) + " = " + std::to_string(totalDamage) + " damage");
+  Engine::GetLogger().LogEvent("CombatSystem: {} rolled {} = {} + {} = {} damage", attacker->TypeName(), damageDice, diceRoll, baseDamage, totalDamage);
 
   return totalDamage;
 }
@@ -61,9 +59,7 @@ void CombatSystem::ApplyDamage(Character* attacker, Character* defender, int dam
   }
 
   // God Mode: Dragon은 데미지 무효
-  auto* debug_mgr = Engine::GetGameStateManager().GetGSComponent<DebugManager>();
-  if (debug_mgr && debug_mgr->IsGodModeEnabled()
-	  && defender->GetCharacterType() == CharacterTypes::Dragon)
+  if (god_mode && defender->GetCharacterType() == CharacterTypes::Dragon)
   {
 	Engine::GetLogger().LogDebug("[GodMode] Damage blocked for Dragon");
 	return;
@@ -71,7 +67,7 @@ void CombatSystem::ApplyDamage(Character* attacker, Character* defender, int dam
 
   if (damage < 0)
   {
-	Engine::GetLogger().LogError("CombatSystem: Negative damage (" + std::to_string(damage) + ")");
+	Engine::GetLogger().LogError("CombatSystem: Negative damage ({})", damage);
 	damage = 0;
   }
 
@@ -80,7 +76,7 @@ void CombatSystem::ApplyDamage(Character* attacker, Character* defender, int dam
   defender->TakeDamage(damage, attacker);
   int hpAfter = defender->GetStatsComponent()->GetCurrentHP();
 
-  Engine::GetLogger().LogEvent("CombatSystem: " + defender->TypeName() + " took " + std::to_string(damage) + " damage (" + std::to_string(hpBefore) + " -> " + std::to_string(hpAfter) + " HP)");
+  Engine::GetLogger().LogEvent("CombatSystem: {} took {} damage ({} -> {} HP)", defender->TypeName(), damage, hpBefore, hpAfter);
 
   // Publish damage event
   auto* eventBus = Engine::GetGameStateManager().GetGSComponent<EventBus>();
@@ -92,7 +88,7 @@ void CombatSystem::ApplyDamage(Character* attacker, Character* defender, int dam
   // Check if defender died
   if (!defender->IsAlive())
   {
-	Engine::GetLogger().LogEvent("CombatSystem: " + defender->TypeName() + " died!");
+	Engine::GetLogger().LogEvent("CombatSystem: {} died!", defender->TypeName());
 	auto* eventBus2 = Engine::GetGameStateManager().GetGSComponent<EventBus>();
 	if (eventBus2)
 	{
@@ -117,7 +113,7 @@ bool CombatSystem::ExecuteAttack(Character* attacker, Character* defender)
 
   if (!defender->IsAlive())
   {
-	Engine::GetLogger().LogError("CombatSystem: Cannot attack dead " + defender->TypeName());
+	Engine::GetLogger().LogError("CombatSystem: Cannot attack dead {}", defender->TypeName());
 	return false;
   }
 
@@ -132,7 +128,7 @@ bool CombatSystem::ExecuteAttack(Character* attacker, Character* defender)
   int attackCost = 1;
   if (attacker->GetActionPoints() < attackCost)
   {
-	Engine::GetLogger().LogError("CombatSystem: " + attacker->TypeName() + " has no Action Points to attack!");
+	Engine::GetLogger().LogError("CombatSystem: {} has no Action Points to attack!", attacker->TypeName());
 	return false;
   }
 
@@ -165,8 +161,7 @@ bool CombatSystem::ExecuteAttack(Character* attacker, Character* defender)
   attacker->SetHasAttackedThisTurn(true);
 
   // Consume AP (갓모드 Dragon은 AP 소모 없음)
-  auto* debug_mgr = Engine::GetGameStateManager().GetGSComponent<DebugManager>();
-  if (!(debug_mgr && debug_mgr->IsGodModeEnabled() && attacker->GetCharacterType() == CharacterTypes::Dragon))
+  if (!(god_mode && attacker->GetCharacterType() == CharacterTypes::Dragon))
     attacker->GetActionPointsComponent()->Consume(attackCost);
 
   return true;
@@ -47,6 +47,18 @@ class CombatSystem : public CS230::Component
   bool IsInRange(Character* attacker, Character* target, int range);
   int  GetDistance(Character* char1, Character* char2);
 
+  // God Mode: Dragon 은 데미지 무효, 공격/주문에 AP 소모 없음 (DebugManager 가 켜고 끈다)
+  void SetGodMode(bool enabled)
+  {
+	god_mode = enabled;
+  }
+
+  bool IsGodModeEnabled() const
+  {
+	return god_mode;
+  }
+
   private:
   DiceManager* diceManager = nullptr;
+  bool		   god_mode	   = false;
 };
\ No newline at end of file
@@ -19,6 +19,51 @@ DiceManager::DiceManager()
 void DiceManager::SetSeed(int seed)
 {
   rng.seed(static_cast<unsigned int>(seed));
+  counter_mode = false;
+}
+
+void DiceManager::SetCounterStream(std::uint64_t key, std::uint64_t stream)
+{
+  counter_mode	 = true;
+  counter_key	 = key;
+  counter_stream = stream;
+  counter		 = 0;
+}
+
+DiceManager::StreamState DiceManager::GetStreamState() const
+{
+  return StreamState{ counter_mode, counter_key, counter_stream, counter };
+}
+
+void DiceManager::SetStreamState(const StreamState& state)
+{
+  if (!state.counter_mode)
+	return;
+  counter_mode	 = true;
+  counter_key	 = state.key;
+  counter_stream = state.stream;
+  counter		 = state.counter;
+}
+
+int DiceManager::NextRoll(int sides)
+{
+  if (!counter_mode)
+  {
+	std::uniform_int_distribution<int> dice(1, sides);
+	return dice(rng);
+  }
+
+  // splitmix64 finalizer 두 번 — (key, stream) 으로 스트림을 고르고 counter 로 위치를 고른다
+  auto mix = [](std::uint64_t z)
+  {
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+  };
+  const std::uint64_t bits = mix(mix(counter_key + 0x9E3779B97F4A7C15ull * (counter_stream + 1)) + 0x9E3779B97F4A7C15ull * ++counter);
+  // 상위 32비트 × sides 의 상위 워드 — modulo 없이 [0, sides)
+  const std::uint64_t scaled = ((bits >> 32) * static_cast<std::uint64_t>(sides)) >> 32;
+  return static_cast<int>(scaled) + 1;
 }
 
 const std::vector<int>& DiceManager::GetLastRolls() const
@@ -40,14 +85,13 @@ int DiceManager::RollDice(int count, int sides)
 	return 0;
   }
 
-  std::uniform_int_distribution<int> dice(1, sides);
   lastRolls.clear();
   lastNotation = std::to_string(count) + "d" + std::to_string(sides);
   int sum = 0;
 
   for (int i = 0; i < count; i++)
   {
-	int roll = dice(rng);
+	int roll = NextRoll(sides);
 	lastRolls.push_back(roll);
 	sum += roll;
   }
@@ -7,6 +7,7 @@
 #pragma once
 #include "./Engine/Component.h"
 #include "./Engine/Engine.h"
+#include <cstdint>
 #include <random>
 #include <string>
 #include <vector>
@@ -21,14 +22,41 @@ class DiceManager : public CS230::Component
   int RollDiceFromString(
 	const std::string& notation);
   void					  SetSeed(int seed);
+
+  /// @brief counter-based 스트림으로 전환 — n 번째 주사위 = hash(key, stream, n)
+  ///        병렬 시뮬레이션에서 전투 i 의 결과가 어느 워커에서 몇 번째로 돌든 같다
+  void		  SetCounterStream(std::uint64_t key, std::uint64_t stream);
+  std::uint64_t GetCounter() const
+  {
+	return counter;
+  }
+
+  /// @brief 주사위 스트림 위치 (BattleState 저장/복원용). mt19937 모드에서는 counter_mode = false 만 기록된다
+  struct StreamState
+  {
+	bool		  counter_mode = false;
+	std::uint64_t key		   = 0;
+	std::uint64_t stream	   = 0;
+	std::uint64_t counter	   = 0;
+  };
+
+  StreamState GetStreamState() const;
+  /// counter 모드 상태만 되돌린다 — mt19937 상태는 스냅샷에 담지 않으므로 그대로 둔다
+  void		  SetStreamState(const StreamState& state);
+
   const std::vector<int>& GetLastRolls() const;
   const std::string&      GetLastNotation() const;
 
   private:
   void LogRoll(const std::string& notation, int total) const;
+  int  NextRoll(int sides);
 
   private:
   std::mt19937	   rng;
+  bool			   counter_mode	  = false;
+  std::uint64_t	   counter_key	  = 0;
+  std::uint64_t	   counter_stream = 0;
+  std::uint64_t	   counter		  = 0;
   std::vector<int> lastRolls;
   std::string      lastNotation;
 };
@@ -6,17 +6,144 @@
  */
 #include "pch.h"
 
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/Engine.h"
 #include "./Engine/Logger.h"
 #include "EventBus.h"
+#include <algorithm>
+
+void EventBus::Subscription::Reset()
+{
+  if (id_ == 0)
+	return;
+  if (const std::shared_ptr<EventBus*> bus = bus_.lock())
+	(*bus)->Unsubscribe(event_type_, id_);
+  bus_.reset();
+  id_ = 0;
+}
+
+EventBus::EventBus() : self_(std::make_shared<EventBus*>(this))
+{
+}
+
+void EventBus::DispatchDeferred()
+{
+  ALLOCATION_SCOPE(EventBus);
+  if (dispatching_deferred_)
+	return;
+  dispatching_deferred_ = true;
+  std::swap(deferred_order_, delivering_);
+  for (EventQueueBase* queue : delivering_)
+	queue->Deliver(*this);
+  delivering_.clear();
+  dispatching_deferred_ = false;
+}
+
+void EventBus::SetDeferred(bool enabled)
+{
+  if (deferred_ && !enabled)
+	DispatchDeferred();
+  deferred_ = enabled;
+}
+
+std::size_t EventBus::GetQueuedEventCount() const
+{
+  std::size_t total = 0;
+  for (const std::unique_ptr<Channel>& channel : channels_)
+  {
+	if (channel != nullptr && channel->queue != nullptr)
+	  total += channel->queue->Size();
+  }
+  return total;
+}
 
 void EventBus::Clear()
 {
-  subscribers.clear();
+  deferred_order_.clear();
+  for (const std::unique_ptr<Channel>& channel : channels_)
+  {
+	if (channel == nullptr)
+	  continue;
+	if (channel->queue != nullptr)
+	  channel->queue->Discard();
+	channel->pending.clear();
+	if (channel->dispatch_depth > 0)
+	{
+	  // 지금 실행 중인 핸들러가 있으니 지우지 않고 표시만 해 둔다
+	  for (Entry& entry : channel->entries)
+		entry.id = 0;
+	  channel->has_removed = true;
+	}
+	else
+	{
+	  channel->entries.clear();
+	}
+  }
   Engine::GetLogger().LogEvent("EventBus: All subscriptions cleared");
 }
 
+EventBus::Channel& EventBus::ChannelFor(std::size_t type)
+{
+  if (type >= channels_.size())
+	channels_.resize(type + 1);
+  if (channels_[type] == nullptr)
+	channels_[type] = std::make_unique<Channel>();
+  return *channels_[type];
+}
+
+void EventBus::Flush(Channel& channel)
+{
+  if (channel.has_removed)
+  {
+	channel.entries.erase(std::remove_if(channel.entries.begin(), channel.entries.end(), [](const Entry& entry) { return entry.id == 0; }), channel.entries.end());
+	channel.has_removed = false;
+  }
+  if (!channel.pending.empty())
+  {
+	for (Entry& entry : channel.pending)
+	  channel.entries.push_back(std::move(entry));
+	channel.pending.clear();
+  }
+}
+
+void EventBus::Unsubscribe(std::size_t type, std::uint32_t id)
+{
+  if (type >= channels_.size() || channels_[type] == nullptr)
+	return;
+  Channel& channel = *channels_[type];
+
+  auto pending = std::find_if(channel.pending.begin(), channel.pending.end(), [id](const Entry& entry) { return entry.id == id; });
+  if (pending != channel.pending.end())
+  {
+	channel.pending.erase(pending);
+	return;
+  }
+
+  auto it = std::find_if(channel.entries.begin(), channel.entries.end(), [id](const Entry& entry) { return entry.id == id; });
+  if (it == channel.entries.end())
+	return;
+  if (channel.dispatch_depth > 0)
+  {
+	// 발행 루프가 entries 를 색인으로 돌고 있으므로 자리를 유지하고 발행이 끝날 때 지운다
+	it->id				= 0;
+	channel.has_removed = true;
+  }
+  else
+  {
+	channel.entries.erase(it);
+  }
+}
+
+std::size_t EventBus::CountSubscribers(std::size_t type) const
+{
+  if (type >= channels_.size() || channels_[type] == nullptr)
+	return 0;
+  const Channel& channel = *channels_[type];
+  const auto	 live	 = std::count_if(channel.entries.begin(), channel.entries.end(), [](const Entry& entry) { return entry.id != 0; });
+  return static_cast<std::size_t>(live) + channel.pending.size();
+}
+
 void EventBus::LogEvent(const std::string& eventType, [[maybe_unused]] const void* eventData)
 {
   Engine::GetLogger().LogDebug("EventBus: Publishing " + eventType);
-}
\ No newline at end of file
+}
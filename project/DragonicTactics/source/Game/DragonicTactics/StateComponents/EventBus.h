@@ -5,50 +5,213 @@
  * \copyright DigiPen Institute of Technology
  */
 #pragma once
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/Component.h"
-#include <functional>
-#include <map>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
 #include <string>
-#include <typeindex>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
+// 이벤트 타입마다 0 부터 촘촘하게 붙는 번호 (CS230::ComponentTypeId 와 같은 방식).
+// EventBus 는 이 번호로 채널 배열을 바로 색인한다
+class EventTypeId
+{
+  public:
+  template <typename T>
+  static std::size_t Of()
+  {
+	static const std::size_t id = counter().fetch_add(1, std::memory_order_relaxed);
+	return id;
+  }
+
+  private:
+  static std::atomic<std::size_t>& counter()
+  {
+	static std::atomic<std::size_t> next{ 0 };
+	return next;
+  }
+};
+
+// SubscribeBatched 구독자가 받는 이벤트 묶음 (발행 순서대로). 전달 중에만 유효하다
+template <typename T>
+struct EventBatch
+{
+  const T*	  events = nullptr;
+  std::size_t count	 = 0;
+
+  const T* begin() const
+  {
+	return events;
+  }
+
+  const T* end() const
+  {
+	return events + count;
+  }
+
+  std::size_t size() const
+  {
+	return count;
+  }
+
+  bool empty() const
+  {
+	return count == 0;
+  }
+
+  const T& operator[](std::size_t index) const
+  {
+	return events[index];
+  }
+};
+
+// 구독자는 람다를 그대로 고정 크기 버퍼에 담아 두므로 구독/발행 어디에서도 구독자마다 힙 할당이 없다.
+// Subscribe 가 돌려주는 Subscription 이 사라지면 구독도 풀린다 — 구독하는 쪽이 핸들을 멤버로 들고 있어야 한다.
+// 발행 도중 핸들러가 구독/해지해도 안전하다: 새 구독은 이번 발행이 끝난 뒤부터 받고, 해지된 구독은 즉시 더 받지 않는다.
+//
+// 구독은 두 가지다.
+//   Subscribe		  : 발행하는 그 자리에서 바로 받는다. 게임 규칙에 영향을 주는 구독자 (턴 순서, 사망 처리, AI 무효화, 해시)
+//   SubscribeBatched : 타입별 큐에 쌓였다가 DispatchDeferred() 에서 EventBatch 하나로 받는다. UI / 사운드 같은 표시용 구독자 —
+//						광역 주문 하나가 만든 피해 이벤트 여러 개를 한 번에 받아 효과음 등을 합칠 수 있다.
+// 묶음 구독자가 없는 타입은 큐도 없으므로 즉시 발행 비용은 그대로다.
 class EventBus : public CS230::Component
 {
   public:
-  EventBus()  = default;
+  // 구독 해지 핸들 (이동만 가능). EventBus 가 먼저 사라져도 안전하다
+  class Subscription
+  {
+	public:
+	Subscription() = default;
+
+	~Subscription()
+	{
+	  Reset();
+	}
+
+	Subscription(Subscription&& other) noexcept
+		: bus_(std::move(other.bus_)), event_type_(other.event_type_), id_(std::exchange(other.id_, 0u))
+	{
+	}
+
+	Subscription& operator=(Subscription&& other) noexcept
+	{
+	  if (this != &other)
+	  {
+		Reset();
+		bus_		= std::move(other.bus_);
+		event_type_ = other.event_type_;
+		id_			= std::exchange(other.id_, 0u);
+	  }
+	  return *this;
+	}
+
+	Subscription(const Subscription&)			 = delete;
+	Subscription& operator=(const Subscription&) = delete;
+
+	// 지금 바로 해지 (두 번 불러도 된다)
+	void Reset();
+
+	private:
+	friend class EventBus;
+
+	Subscription(std::weak_ptr<EventBus*> bus, std::size_t event_type, std::uint32_t id)
+		: bus_(std::move(bus)), event_type_(event_type), id_(id)
+	{
+	}
+
+	std::weak_ptr<EventBus*> bus_;
+	std::size_t				 event_type_ = 0;
+	std::uint32_t			 id_		 = 0;
+  };
+
+  EventBus();
   ~EventBus() = default;
 
-  // Subscribe to event type T with callback function
-  template <typename T>
-  void Subscribe(std::function<void(const T&)> callback)
+  EventBus(const EventBus&)			   = delete;
+  EventBus& operator=(const EventBus&) = delete;
+
+  // Subscribe to event type T. 콜백은 Handler::CAPACITY 바이트 안에 들어가야 한다
+  template <typename T, typename F>
+  [[nodiscard]] Subscription Subscribe(F&& callback)
   {
-	auto typeIndex = std::type_index(typeid(T));
-	subscribers[typeIndex].push_back([callback](const void* data) { callback(*static_cast<const T*>(data)); });
+	static_assert(std::is_invocable_v<std::decay_t<F>&, const T&>, "EventBus::Subscribe - callback must accept const T&");
+	const std::size_t type	  = EventTypeId::Of<T>();
+	Channel&		  channel = ChannelFor(type);
+	const std::uint32_t id	  = ++next_id_;
+
+	Entry entry{ id, Handler::Make<T>(std::forward<F>(callback)) };
+	(channel.dispatch_depth > 0 ? channel.pending : channel.entries).push_back(std::move(entry));
+	return Subscription(self_, type, id);
   }
 
   // Publish event of type T
   template <typename T>
   void Publish(const T& event)
   {
-	auto typeIndex = std::type_index(typeid(T));
-
+	ALLOCATION_SCOPE(EventBus);
 	// Optional: Log event for debugging
 	if (loggingEnabled)
 	{
 	  LogEvent(typeid(T).name(), &event);
 	}
 
-	// Call all subscribers for this event type
-	if (subscribers.find(typeIndex) != subscribers.end())
+	const std::size_t type = EventTypeId::Of<T>();
+	if (type >= channels_.size() || channels_[type] == nullptr)
+	  return;
+
+	// 발행 중에는 entries 를 옮기지 않는다 (새 구독은 pending 으로, 해지는 id 만 지움)
+	Channel& channel = *channels_[type];
 	{
-	  for (auto& callback : subscribers[typeIndex])
+	  DispatchScope		scope{ *this, channel };
+	  const std::size_t count = channel.entries.size();
+	  for (std::size_t i = 0; i < count; ++i)
 	  {
-		callback(&event);
+		Entry& entry = channel.entries[i];
+		if (entry.id != 0)
+		  entry.handler.Invoke(&event);
 	  }
 	}
+
+	if constexpr (!IsEventBatch<T>::value)
+	{
+	  if (channel.queue != nullptr)
+		Enqueue(*static_cast<EventQueue<T>*>(channel.queue.get()), event);
+	}
   }
 
-  // Unsubscribe all listeners (used for cleanup)
+  // T 를 DispatchDeferred() 에서 EventBatch<T> 로 묶어 받는다. 콜백은 const EventBatch<T>& 를 받는다
+  template <typename T, typename F>
+  [[nodiscard]] Subscription SubscribeBatched(F&& callback)
+  {
+	static_assert(!IsEventBatch<T>::value, "EventBus::SubscribeBatched - T is already a batch");
+	Channel& channel = ChannelFor(EventTypeId::Of<T>());
+	if (channel.queue == nullptr)
+	  channel.queue = std::make_unique<EventQueue<T>>();
+	return Subscribe<EventBatch<T>>(std::forward<F>(callback));
+  }
+
+  // 쌓인 이벤트를 타입별 묶음으로 전달한다. 타입 순서는 그 타입의 첫 이벤트가 발행된 순서를 따른다.
+  // 전달 중에 발행된 이벤트는 다음 호출에서 전달된다
+  void DispatchDeferred();
+
+  // false 면 묶음 구독자도 발행 즉시 (이벤트 하나짜리 묶음으로) 받는다. 끌 때 쌓인 것은 먼저 전달한다
+  void SetDeferred(bool enabled);
+
+  bool IsDeferred() const
+  {
+	return deferred_;
+  }
+
+  // 다음 DispatchDeferred() 를 기다리는 이벤트 수
+  std::size_t GetQueuedEventCount() const;
+
+  // Unsubscribe all listeners (used for cleanup). 남아 있는 핸들은 해지해도 아무 일도 하지 않는다. 쌓인 이벤트도 버린다
   void Clear();
 
   // Enable/disable event logging
@@ -57,12 +220,210 @@ class EventBus : public CS230::Component
 	loggingEnabled = enabled;
   }
 
+  // 지금 이벤트 T 를 받는 구독 수 (발행 중 추가된 구독 포함)
+  template <typename T>
+  std::size_t GetSubscriberCount() const
+  {
+	return CountSubscribers(EventTypeId::Of<T>());
+  }
+
   private:
-  // Type-erased callback wrapper
-  using CallbackWrapper = std::function<void(const void*)>;
+  template <typename T>
+  struct IsEventBatch : std::false_type
+  {
+  };
+
+  template <typename T>
+  struct IsEventBatch<EventBatch<T>> : std::true_type
+  {
+  };
+
+  class EventQueueBase
+  {
+	public:
+	virtual ~EventQueueBase() = default;
+
+	virtual void		Deliver(EventBus& bus) = 0;
+	virtual void		Discard()			   = 0;
+	virtual std::size_t Size() const		   = 0;
+  };
+
+  // 타입 T 의 지연 큐. 두 버퍼를 번갈아 쓴다 — 전달하는 동안 새로 발행된 이벤트는 다른 버퍼에 쌓인다.
+  // 버퍼는 비우기만 하고 용량을 유지하므로 첫 몇 프레임 이후에는 재할당이 없다
+  template <typename T>
+  class EventQueue final : public EventQueueBase
+  {
+	public:
+	// 이번 프레임 첫 이벤트면 true
+	bool Push(const T& event)
+	{
+	  const bool first = writing_.empty();
+	  writing_.push_back(event);
+	  return first;
+	}
+
+	void Deliver(EventBus& bus) override
+	{
+	  if (writing_.empty())
+		return;
+	  std::swap(writing_, reading_);
+	  bus.Publish(EventBatch<T>{ reading_.data(), reading_.size() });
+	  reading_.clear();
+	}
+
+	void Discard() override
+	{
+	  writing_.clear();
+	}
+
+	std::size_t Size() const override
+	{
+	  return writing_.size();
+	}
+
+	private:
+	std::vector<T> writing_;
+	std::vector<T> reading_;
+  };
+
+  template <typename T>
+  void Enqueue(EventQueue<T>& queue, const T& event)
+  {
+	if (!deferred_)
+	{
+	  Publish(EventBatch<T>{ &event, 1 });
+	  return;
+	}
+	if (queue.Push(event))
+	  deferred_order_.push_back(&queue);
+  }
+
+  // 람다를 버퍼에 그대로 보관하는 타입 지운 콜백. 함수 포인터 한 번으로 람다 본문까지 간다
+  class Handler
+  {
+	public:
+	static constexpr std::size_t CAPACITY = 64;
+
+	template <typename T, typename F>
+	static Handler Make(F&& callback)
+	{
+	  using Fn = std::decay_t<F>;
+	  static_assert(sizeof(Fn) <= CAPACITY, "EventBus handler too large - capture a pointer to a struct instead");
+	  static_assert(alignof(Fn) <= alignof(std::max_align_t), "EventBus handler is over-aligned");
+	  static_assert(std::is_nothrow_move_constructible_v<Fn>, "EventBus handler must be nothrow movable");
+
+	  Handler handler;
+	  ::new (static_cast<void*>(handler.storage_)) Fn(std::forward<F>(callback));
+	  handler.invoke_ = [](void* storage, const void* event) { (*static_cast<Fn*>(storage))(*static_cast<const T*>(event)); };
+	  handler.manage_ = [](void* storage, void* move_to)
+	  {
+		Fn* fn = static_cast<Fn*>(storage);
+		if (move_to != nullptr)
+		  ::new (move_to) Fn(std::move(*fn));
+		fn->~Fn();
+	  };
+	  return handler;
+	}
+
+	Handler() = default;
+
+	~Handler()
+	{
+	  if (manage_ != nullptr)
+		manage_(storage_, nullptr);
+	}
+
+	Handler(Handler&& other) noexcept
+	{
+	  MoveFrom(other);
+	}
+
+	Handler& operator=(Handler&& other) noexcept
+	{
+	  if (this != &other)
+	  {
+		if (manage_ != nullptr)
+		  manage_(storage_, nullptr);
+		MoveFrom(other);
+	  }
+	  return *this;
+	}
+
+	Handler(const Handler&)			   = delete;
+	Handler& operator=(const Handler&) = delete;
+
+	void Invoke(const void* event)
+	{
+	  invoke_(storage_, event);
+	}
+
+	private:
+	void MoveFrom(Handler& other) noexcept
+	{
+	  invoke_ = other.invoke_;
+	  manage_ = other.manage_;
+	  if (manage_ != nullptr)
+		manage_(other.storage_, storage_); // 옮긴 뒤 원본은 소멸
+	  other.invoke_ = nullptr;
+	  other.manage_ = nullptr;
+	}
+
+	void (*invoke_)(void*, const void*) = nullptr;
+	void (*manage_)(void*, void*)		= nullptr; // move_to 가 nullptr 이면 소멸만
+	alignas(std::max_align_t) unsigned char storage_[CAPACITY];
+  };
+
+  struct Entry
+  {
+	std::uint32_t id = 0; // 0 이면 해지됨 (발행이 끝나면 지운다)
+	Handler		  handler;
+  };
+
+  struct Channel
+  {
+	std::vector<Entry> entries;
+	std::vector<Entry> pending;			   // 발행 중에 들어온 구독
+	int				   dispatch_depth = 0; // 핸들러 안에서 같은 이벤트를 다시 발행하면 1 보다 커진다
+	bool			   has_removed	  = false;
+
+	std::unique_ptr<EventQueueBase> queue; // SubscribeBatched 구독자가 있는 타입만
+  };
+
+  struct DispatchScope
+  {
+	EventBus& bus;
+	Channel&  channel;
+
+	DispatchScope(EventBus& b, Channel& c) : bus(b), channel(c)
+	{
+	  ++channel.dispatch_depth;
+	}
+
+	~DispatchScope()
+	{
+	  if (--channel.dispatch_depth == 0 && (channel.has_removed || !channel.pending.empty()))
+		bus.Flush(channel);
+	}
+
+	DispatchScope(const DispatchScope&)			   = delete;
+	DispatchScope& operator=(const DispatchScope&) = delete;
+  };
+
+  Channel&	  ChannelFor(std::size_t type);
+  void		  Flush(Channel& channel);
+  void		  Unsubscribe(std::size_t type, std::uint32_t id);
+  std::size_t CountSubscribers(std::size_t type) const;
+
+  // 이벤트 타입 번호 -> 채널. 채널은 따로 할당해 두어 발행 중 새 타입이 구독돼도 주소가 바뀌지 않는다
+  std::vector<std::unique_ptr<Channel>> channels_;
+  std::uint32_t						  next_id_ = 0;
+  std::shared_ptr<EventBus*>		  self_; // Subscription 이 버스가 살아 있는지 확인하는 데 쓴다
 
-  // Map of event type -> list of callbacks
-  std::map<std::type_index, std::vector<CallbackWrapper>> subscribers;
+  // 이번 프레임에 이벤트가 쌓인 큐 (첫 이벤트 순서). 전달 중에는 delivering_ 과 바꿔 쓴다
+  std::vector<EventQueueBase*> deferred_order_;
+  std::vector<EventQueueBase*> delivering_;
+  bool						   deferred_			 = true;
+  bool						   dispatching_deferred_ = false;
 
   bool loggingEnabled = false;
 
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// @brief 타일 하나당 1비트 — 행 우선(y * width + x) 인덱스를 64비트 워드에 채운 비트보드
+///
+/// GridSystem 의 "통과 가능"/"점유" 상태를 워드 단위로 보관한다.
+/// 워드 단위 AND/OR 로 여러 타일을 한 번에 검사할 수 있다 (BFS 프런티어, 범위 마스크 등).
+class GridBitboard
+{
+  public:
+  void Resize(int width, int height)
+  {
+	width_	= width;
+	height_ = height;
+	words_.assign(WordCount(width * height), 0);
+  }
+
+  void Clear()
+  {
+	std::fill(words_.begin(), words_.end(), 0ULL);
+  }
+
+  bool Test(int index) const
+  {
+	return (words_[static_cast<std::size_t>(index >> 6)] >> (index & 63)) & 1ULL;
+  }
+
+  void Set(int index, bool value)
+  {
+	const std::uint64_t mask = 1ULL << (index & 63);
+	std::uint64_t&		word = words_[static_cast<std::size_t>(index >> 6)];
+	word					 = value ? (word | mask) : (word & ~mask);
+  }
+
+  int Count() const
+  {
+	int count = 0;
+	for (std::uint64_t word : words_)
+	  count += std::popcount(word);
+	return count;
+  }
+
+  /// @brief 켜진 비트마다 fn(index) 호출 (인덱스 오름차순)
+  template <typename Fn>
+  void ForEachSet(Fn&& fn) const
+  {
+	for (std::size_t w = 0; w < words_.size(); ++w)
+	{
+	  for (std::uint64_t word = words_[w]; word != 0; word &= word - 1)
+		fn(static_cast<int>(w * 64) + std::countr_zero(word));
+	}
+  }
+
+  int GetWidth() const
+  {
+	return width_;
+  }
+
+  int GetHeight() const
+  {
+	return height_;
+  }
+
+  const std::vector<std::uint64_t>& Words() const
+  {
+	return words_;
+  }
+
+  std::vector<std::uint64_t>& Words()
+  {
+	return words_;
+  }
+
+  static std::size_t WordCount(int bit_count)
+  {
+	return (static_cast<std::size_t>(bit_count) + 63) / 64;
+  }
+
+  private:
+  int						 width_	 = 0;
+  int						 height_ = 0;
+  std::vector<std::uint64_t> words_;
+};
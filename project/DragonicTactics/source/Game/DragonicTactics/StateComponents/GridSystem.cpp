@@ -7,15 +7,16 @@
 #include "pch.h"
 
 #include "./CS200/IRenderer2D.h"
+#include "./Engine/AllocationTracker.h"
 #include "./Engine/Engine.h"
 #include "./Engine/Logger.h"
+#include "./Engine/Profiler.h"
 #include "./Game/DragonicTactics/Objects/Character.h"
 #include "Engine/DrawDepth.h"
 #include "GridSystem.h"
+#include "Zobrist.h"
 #include <algorithm>
 #include <cassert>
-#include <queue>
-#include <set>
 
 void GridSystem::SetExitPosition(Math::ivec2 pos)
 {
@@ -36,31 +37,69 @@ GridSystem::GridSystem()
 {
 	ResizeGrid(8, 8);
 	Reset();
+	// 캐시 슬롯이 옮겨지지 않도록 미리 잡아 둔다 (GetDistanceField 가 돌려준 참조 보호)
+	distance_fields_.reserve(MAX_DISTANCE_FIELDS);
 	stone_tile_bright = Engine::GetTextureManager().Load("Assets/images/stone_tile_bright.png");
 	stone_tile_dark	  = Engine::GetTextureManager().Load("Assets/images/stone_tile_dark.png");
 	lava_tile         = Engine::GetTextureManager().Load("Assets/images/lava.png");
 	wall_tile         = Engine::GetTextureManager().Load("Assets/images/Wall.png");
 }
 
+namespace
+{
+	std::uint64_t TileKey(int index, GridSystem::TileType type)
+	{
+		return type == GridSystem::TileType::Empty ? 0 : Zobrist::Key(Zobrist::Feature::Tile, static_cast<std::uint64_t>(index), static_cast<std::uint64_t>(type));
+	}
+
+	std::uint64_t OccupantKey(int index, const Character* character)
+	{
+		return Zobrist::Key(Zobrist::Feature::Occupant, static_cast<std::uint64_t>(index), reinterpret_cast<std::uintptr_t>(character));
+	}
+}
+
 void GridSystem::ResizeGrid(int w, int h)
 {
 	map_width_  = w;
 	map_height_ = h;
-	tile_grid_.assign(static_cast<std::size_t>(h), std::vector<TileType>(static_cast<std::size_t>(w), TileType::Empty));
-	character_grid_.assign(static_cast<std::size_t>(h), std::vector<Character*>(static_cast<std::size_t>(w), nullptr));
+	const std::size_t count = static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
+	tiles_.assign(count, TileType::Empty);
+	occupant_index_.assign(count, 0);
+	occupants_.clear();
+	occupant_tiles_.clear();
+	passable_bits_.Resize(w, h);
+	occupied_bits_.Resize(w, h);
+	for (int i = 0; i < w * h; ++i)
+		passable_bits_.Set(i, true);
+	lava_tile_count_ = 0;
+	pathfinder_.Resize(w, h);
+	reach_engine_.Resize(w, h);
+	pathfinding_mode_ = PathfindingMode::Flat; // 크기가 바뀌면 계층 그래프는 LoadMap 끝에서 다시 만든다
+	hierarchy_.Clear();
+	spell_targetable_bits_.Resize(w, h);
+	attack_range_bits_.Resize(w, h);
+	movement_reachable_.Clear();
+	zobrist_ = 0;
+	++grid_version_;
+	ClearDistanceFields();
 }
 
 void GridSystem::Reset()
 {
-	for (int y = 0; y < map_height_; ++y)
-	{
-		for (int x = 0; x < map_width_; ++x)
-		{
-			tile_grid_[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)]	  = TileType::Empty;
-			character_grid_[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)] = nullptr;
-		}
-	}
+	std::fill(tiles_.begin(), tiles_.end(), TileType::Empty);
+	std::fill(occupant_index_.begin(), occupant_index_.end(), static_cast<std::uint16_t>(0));
+	occupants_.clear();
+	occupant_tiles_.clear();
+	occupied_bits_.Clear();
+	for (int i = 0; i < map_width_ * map_height_; ++i)
+		passable_bits_.Set(i, true);
+	lava_tile_count_ = 0;
 	exit_position_ = { -1, -1 };
+	zobrist_ = 0;
+	++grid_version_;
+	ClearDistanceFields();
+	if (pathfinding_mode_ == PathfindingMode::Hierarchical)
+		hierarchy_.Build(*this, hierarchy_.GetClusterSize());
 }
 
 bool GridSystem::IsValidTile(Math::ivec2 pos) const
@@ -75,7 +114,17 @@ void GridSystem::SetTileType(Math::ivec2 pos, TileType type)
 		Engine::GetLogger().LogError("SetTileType: Invalid tile position.");
 		return;
 	}
-	tile_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)] = type;
+	const int index = TileIndex(pos);
+	TileType& tile	= tiles_[static_cast<std::size_t>(index)];
+	if (tile == type)
+		return;
+	lava_tile_count_ += (type == TileType::Lava ? 1 : 0) - (tile == TileType::Lava ? 1 : 0);
+	zobrist_ ^= TileKey(index, tile) ^ TileKey(index, type);
+	tile = type;
+	passable_bits_.Set(index, type == TileType::Empty || type == TileType::Lava);
+	++grid_version_;
+	InvalidateDistanceFields(pos);
+	hierarchy_.MarkTileChanged(pos); // 계층 모드: 해당 클러스터와 이웃만 다음 질의 전에 갱신
 }
 
 GridSystem::TileType GridSystem::GetTileType(Math::ivec2 pos) const
@@ -84,7 +133,7 @@ GridSystem::TileType GridSystem::GetTileType(Math::ivec2 pos) const
 	{
 		return TileType::Invalid;
 	}
-	return tile_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)];
+	return tiles_[static_cast<std::size_t>(TileIndex(pos))];
 }
 
 bool GridSystem::IsOccupied(Math::ivec2 pos) const
@@ -93,11 +142,12 @@ bool GridSystem::IsOccupied(Math::ivec2 pos) const
 	{
 		return true;
 	}
-	return character_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)] != nullptr;
+	return occupied_bits_.Test(TileIndex(pos));
 }
 
 void GridSystem::Draw() const
 {
+	PROFILE_SCOPE("GridSystem::Draw");
 	auto renderer_2d = Engine::GetTextureManager().GetRenderer2D();
 
 
@@ -109,7 +159,7 @@ void GridSystem::Draw() const
 			int screen_x = x * TILE_SIZE + TILE_SIZE;
 			int screen_y = y * TILE_SIZE + TILE_SIZE;
 
-			switch (tile_grid_[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)])
+			switch (tiles_[static_cast<std::size_t>(y * map_width_ + x)])
 			{
 				case TileType::Wall:
 					if (wall_tile)
@@ -171,7 +221,7 @@ void GridSystem::Draw() const
 	if (movement_mode_active_)
 	{
 		int alpha{ 0 };
-		for (const auto& tile : reachable_tiles_)
+		for (const auto& tile : movement_reachable_.tiles)
 		{
 			int screen_x = tile.x * TILE_SIZE + TILE_SIZE;
 			int screen_y = tile.y * TILE_SIZE + TILE_SIZE;
@@ -226,15 +276,15 @@ void GridSystem::Draw() const
 	if (attack_range_mode_active_)
 	{
 		int alpha = static_cast<int>(80 + 40 * std::sin(pulse_timer_ * 3.0));
-		for (const auto& tile : attack_range_tiles_)
+		attack_range_bits_.ForEachSet([&](int index)
 		{
-			int screen_x = tile.x * TILE_SIZE + TILE_SIZE;
-			int screen_y = tile.y * TILE_SIZE + TILE_SIZE;
+			int screen_x = (index % map_width_) * TILE_SIZE + TILE_SIZE;
+			int screen_y = (index / map_width_) * TILE_SIZE + TILE_SIZE;
 			renderer_2d->DrawRectangle(
 				Math::TranslationMatrix(Math::ivec2{ screen_x - (TILE_SIZE / 2), screen_y - (TILE_SIZE / 2) }) * Math::ScaleMatrix(TILE_SIZE),
 				CS200::pack_color({ 1.0f, 0.647f, 0.0f, alpha / 255.0f }),
 				0U, 0.0, DrawDepth::OVERLAY);
-		}
+		});
 	}
 
 	// ========================================
@@ -243,10 +293,10 @@ void GridSystem::Draw() const
 	if (spell_targeting_mode_active_)
 	{
 		int alpha = static_cast<int>(80 + 40 * std::sin(pulse_timer_ * 3.0));
-		for (const auto& tile : spell_targetable_tiles_)
+		spell_targetable_bits_.ForEachSet([&](int index)
 		{
-			int screen_x = tile.x * TILE_SIZE + TILE_SIZE;
-			int screen_y = tile.y * TILE_SIZE + TILE_SIZE;
+			int screen_x = (index % map_width_) * TILE_SIZE + TILE_SIZE;
+			int screen_y = (index / map_width_) * TILE_SIZE + TILE_SIZE;
 			renderer_2d->DrawRectangle(
 				Math::TranslationMatrix(Math::ivec2{ screen_x - (TILE_SIZE / 2), screen_y - (TILE_SIZE / 2) }) * Math::ScaleMatrix(TILE_SIZE),
 				CS200::pack_color({ 255 / 255.0f, 0 / 255.0f, 0 / 255.0f, alpha / 255.0f }), // 빨간색
@@ -254,24 +304,25 @@ void GridSystem::Draw() const
 				0.0,																		 // line_width
 				DrawDepth::OVERLAY																		 // depth
 			);
-		}
+		});
 	}
 }
 
 void GridSystem::EnableSpellTargetingMode(Math::ivec2 center, const std::string& geometry, int range)
 {
 	spell_targeting_mode_active_ = true;
-	spell_targetable_tiles_.clear();
+	spell_targetable_bits_.Clear();
 
 	if (geometry == "Self")
 	{
-		spell_targetable_tiles_.insert(center);
+		if (IsValidTile(center))
+			spell_targetable_bits_.Set(TileIndex(center), true);
 	}
 	else if (geometry == "Line")
 	{
 		for (const auto& tile : GetLineTiles(center, (range < 0 ? map_height_ : range)))
 		if (GetTileType(tile) != TileType::Wall)
-			spell_targetable_tiles_.insert(tile);
+			spell_targetable_bits_.Set(TileIndex(tile), true);
 	}
 	else if (geometry == "OddEven")
 	{
@@ -279,7 +330,7 @@ void GridSystem::EnableSpellTargetingMode(Math::ivec2 center, const std::string&
 		for (int y = 0; y < map_height_; ++y)
 			for (int x = 0; x < map_width_; ++x)
 			if (GetTileType({x,y}) != TileType::Wall)
-				spell_targetable_tiles_.insert({ x, y });
+				spell_targetable_bits_.Set(TileIndex({ x, y }), true);
 	}
 	else
 	{
@@ -292,7 +343,7 @@ void GridSystem::EnableSpellTargetingMode(Math::ivec2 center, const std::string&
 				Math::ivec2 tile{ x, y };
 				// 수정 — Wall 제외
 				if (IsValidTile(tile) && GetTileType(tile) != TileType::Wall && ManhattanDistance(center, tile) <= r)
-					spell_targetable_tiles_.insert(tile);
+					spell_targetable_bits_.Set(TileIndex(tile), true);
 			}
 		}
 	}
@@ -325,27 +376,27 @@ std::vector<Math::ivec2> GridSystem::GetLineTiles(Math::ivec2 center, int reach)
 void GridSystem::DisableSpellTargetingMode()
 {
 	spell_targeting_mode_active_ = false;
-	spell_targetable_tiles_.clear();
+	spell_targetable_bits_.Clear();
 }
 
 void GridSystem::EnableAttackRangeMode(Math::ivec2 pos, int range)
 {
 	attack_range_mode_active_ = true;
-	attack_range_tiles_.clear();
+	attack_range_bits_.Clear();
 	for (int y = 0; y < map_height_; ++y)
 		for (int x = 0; x < map_width_; ++x)
 		{
 			Math::ivec2 t{ x, y };
 			if (IsValidTile(t) && GetTileType(t) != TileType::Wall
 				&& ManhattanDistance(pos, t) <= range)
-				attack_range_tiles_.insert(t);
+				attack_range_bits_.Set(TileIndex(t), true);
 		}
 }
 
 void GridSystem::DisableAttackRangeMode()
 {
 	attack_range_mode_active_ = false;
-	attack_range_tiles_.clear();
+	attack_range_bits_.Clear();
 }
 
 void GridSystem::SetWallPreviewTiles(const std::vector<Math::ivec2>& tiles)
@@ -375,14 +426,50 @@ void GridSystem::AddCharacter(Character* character, Math::ivec2 pos)
 		Engine::GetLogger().LogError("AddCharacter: Tile is already occupied.");
 		return;
 	}
-	character_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)] = character;
+	if (character == nullptr)
+		return;
+	if (occupants_.size() >= 0xFFFF)
+	{
+		Engine::GetLogger().LogError("AddCharacter: Too many characters on grid.");
+		return;
+	}
+	const int index = TileIndex(pos);
+	occupants_.push_back(character);
+	occupant_tiles_.push_back(index);
+	occupant_index_[static_cast<std::size_t>(index)] = static_cast<std::uint16_t>(occupants_.size());
+	occupied_bits_.Set(index, true);
+	zobrist_ ^= OccupantKey(index, character);
+	++grid_version_;
+	InvalidateDistanceFields(pos);
 }
 
 void GridSystem::RemoveCharacter(Math::ivec2 pos)
 {
 	if (!IsValidTile(pos))
 		return;
-	character_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)] = nullptr;
+	if (!occupied_bits_.Test(TileIndex(pos)))
+		return;
+	RemoveOccupantAt(TileIndex(pos));
+	++grid_version_;
+	InvalidateDistanceFields(pos);
+}
+
+void GridSystem::RemoveOccupantAt(int index)
+{
+	// 조밀 배열에서 swap-remove 후 옮겨진 캐릭터의 타일 인덱스를 갱신
+	const std::size_t slot = static_cast<std::size_t>(occupant_index_[static_cast<std::size_t>(index)] - 1);
+	const std::size_t last = occupants_.size() - 1;
+	zobrist_ ^= OccupantKey(index, occupants_[slot]);
+	if (slot != last)
+	{
+		occupants_[slot]															= occupants_[last];
+		occupant_tiles_[slot]														= occupant_tiles_[last];
+		occupant_index_[static_cast<std::size_t>(occupant_tiles_[slot])] = static_cast<std::uint16_t>(slot + 1);
+	}
+	occupants_.pop_back();
+	occupant_tiles_.pop_back();
+	occupant_index_[static_cast<std::size_t>(index)] = 0;
+	occupied_bits_.Set(index, false);
 }
 
 Character* GridSystem::GetCharacterAt(Math::ivec2 pos) const
@@ -391,7 +478,8 @@ Character* GridSystem::GetCharacterAt(Math::ivec2 pos) const
 	{
 		return nullptr;
 	}
-	return character_grid_[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)];
+	const std::uint16_t slot = occupant_index_[static_cast<std::size_t>(TileIndex(pos))];
+	return slot == 0 ? nullptr : occupants_[static_cast<std::size_t>(slot - 1)];
 }
 
 void GridSystem::MoveCharacter(Math::ivec2 old_pos, Math::ivec2 new_pos)
@@ -401,8 +489,30 @@ void GridSystem::MoveCharacter(Math::ivec2 old_pos, Math::ivec2 new_pos)
 		Engine::GetLogger().LogError("MoveCharacter: Invalid tile position.");
 		return;
 	}
-	character_grid_[static_cast<std::size_t>(new_pos.y)][static_cast<std::size_t>(new_pos.x)] = character_grid_[static_cast<std::size_t>(old_pos.y)][static_cast<std::size_t>(old_pos.x)];
-	character_grid_[static_cast<std::size_t>(old_pos.y)][static_cast<std::size_t>(old_pos.x)] = nullptr;
+	if (old_pos == new_pos)
+		return;
+
+	const int old_index = TileIndex(old_pos);
+	const int new_index = TileIndex(new_pos);
+
+	// 기존 동작 유지: 도착 칸에 있던 캐릭터는 그리드에서 빠진다
+	if (occupied_bits_.Test(new_index))
+		RemoveOccupantAt(new_index);
+
+	const std::uint16_t slot = occupant_index_[static_cast<std::size_t>(old_index)];
+	if (slot != 0)
+	{
+		const Character* mover = occupants_[static_cast<std::size_t>(slot - 1)];
+		zobrist_ ^= OccupantKey(old_index, mover) ^ OccupantKey(new_index, mover);
+		occupant_index_[static_cast<std::size_t>(new_index)] = slot;
+		occupant_index_[static_cast<std::size_t>(old_index)] = 0;
+		occupant_tiles_[static_cast<std::size_t>(slot - 1)]	 = new_index;
+		occupied_bits_.Set(new_index, true);
+		occupied_bits_.Set(old_index, false);
+	}
+	++grid_version_;
+	InvalidateDistanceFields(old_pos);
+	InvalidateDistanceFields(new_pos);
 }
 
 void GridSystem::Update([[maybe_unused]] double dt)
@@ -415,6 +525,7 @@ void GridSystem::Update([[maybe_unused]] double dt)
 	{
 		pulse_timer_ = 0.0;
 	}
+	RefreshMovementTree();
 }
 
 /// @brief //////////////////////
@@ -425,7 +536,7 @@ std::vector<Character*> GridSystem::GetAllCharacters()
 	{
 		for (int x = 0; x < map_width_; ++x)
 		{
-			result.push_back(character_grid_[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)]);
+			result.push_back(GetCharacterAt({ x, y }));
 		}
 	}
 	return result;
@@ -434,77 +545,84 @@ std::vector<Character*> GridSystem::GetAllCharacters()
 // ========================================
 // BFS 기반 이동 가능 타일 계산
 // ========================================
-std::vector<Math::ivec2> GridSystem::GetReachableTiles(Math::ivec2 start, int max_distance)
+std::vector<Math::ivec2> GridSystem::GetReachableTiles(Math::ivec2 start, int max_distance, int lava_penalty)
 {
-	std::vector<Math::ivec2> reachable;
-
 	if (!IsValidTile(start))
 	{
 		Engine::GetLogger().LogError("GetReachableTiles: Invalid start position");
-		return reachable;
+		return {};
 	}
 
-	// BFS 탐색
-	std::queue<std::pair<Math::ivec2, int>> queue; // {position, distance}
-	std::set<Math::ivec2>					visited;
-
-	queue.push({ start, 0 });
-	visited.insert(start);
+	return ComputeReachable(start, max_distance, lava_penalty).tiles;
+}
 
-	while (!queue.empty())
+const ReachableTiles& GridSystem::ComputeReachable(Math::ivec2 start, int max_distance, int lava_penalty)
+{
+	ALLOCATION_SCOPE(Pathfinding);
+	if (!IsValidTile(start))
 	{
-		auto [current_pos, distance] = queue.front();
-		queue.pop();
-
-		// 시작 위치는 제외 (현재 위치이므로 이동할 수 없음)
-		if (current_pos != start)
-		{
-			reachable.push_back(current_pos);
-		}
-
-		// 최대 거리 도달 시 더 이상 탐색 안 함
-		if (distance >= max_distance)
-		{
-			continue;
-		}
-
-		// 인접 타일 탐색
-		std::vector<Math::ivec2> neighbors = GetNeighbors(current_pos);
-		for (const auto& neighbor : neighbors)
-		{
-			// 방문하지 않았고, 통과 가능한 타일만 추가 (Empty + Lava 허용, Wall 차단)
-			TileType neighbor_type	   = GetTileType(neighbor);
-			bool	 neighbor_passable = (neighbor_type == TileType::Empty || neighbor_type == TileType::Lava) && !IsOccupied(neighbor);
-			if (visited.find(neighbor) == visited.end() && neighbor_passable)
-			{
-				visited.insert(neighbor);
-				queue.push({ neighbor, distance + 1 });
-			}
-		}
+		reach_scratch_.Clear();
+		return reach_scratch_;
 	}
 
-	Engine::GetLogger().LogEvent("GetReachableTiles: Found " + std::to_string(reachable.size()) + " reachable tiles");
-	return reachable;
+	// 시작 위치는 결과에서 제외 (현재 위치이므로 이동할 수 없음)
+	reach_engine_.ComputeWeighted(*this, start, max_distance, lava_penalty, reach_scratch_);
+	return reach_scratch_;
 }
 
 // ========================================
 // 이동 모드 활성화
 // ========================================
-void GridSystem::EnableMovementMode(Math::ivec2 character_pos, int movement_range)
+void GridSystem::EnableMovementMode(Math::ivec2 character_pos, int movement_range, int lava_penalty)
+{
+	// 호버 중 매 프레임 호출될 수 있다 — 같은 요청이면 기존 탐색 트리를 그대로 쓴다
+	if (movement_mode_active_ && movement_source_pos_ == character_pos && movement_range_ == movement_range && movement_lava_penalty_ == lava_penalty)
+	{
+		RefreshMovementTree();
+		return;
+	}
+
+	movement_mode_active_  = true;
+	movement_source_pos_   = character_pos;
+	movement_range_		   = movement_range;
+	movement_lava_penalty_ = lava_penalty;
+	movement_grid_version_ = 0; // 강제 재계산
+	hovered_tile_		   = { -1, -1 };
+	hovered_path_.clear();
+	RefreshMovementTree();
+
+	Engine::GetLogger().LogEvent("GridSystem: Movement mode enabled at ({}, {}) with range {}", character_pos.x, character_pos.y, movement_range);
+}
+
+void GridSystem::RefreshMovementTree()
 {
-	movement_mode_active_ = true;
-	movement_source_pos_  = character_pos;
+	if (!movement_mode_active_ || movement_grid_version_ == grid_version_)
+		return;
+	movement_grid_version_ = grid_version_;
 
-	// 이동 가능한 타일 계산
-	std::vector<Math::ivec2> reachable = GetReachableTiles(character_pos, movement_range);
-	reachable_tiles_.clear();
-	for (const auto& tile : reachable)
+	// 이동 가능한 타일 + 탐색 트리 계산
+	if (!IsValidTile(movement_source_pos_))
 	{
-		reachable_tiles_.insert(tile);
+		Engine::GetLogger().LogError("EnableMovementMode: Invalid start position");
+		movement_reachable_.Clear();
+	}
+	else
+	{
+		reach_engine_.ComputeWeighted(*this, movement_source_pos_, movement_range_, movement_lava_penalty_, movement_reachable_);
 	}
 
-	Engine::GetLogger().LogEvent(
-		"GridSystem: Movement mode enabled at (" + std::to_string(character_pos.x) + ", " + std::to_string(character_pos.y) + ") with range " + std::to_string(movement_range));
+	// 트리가 바뀌었으니 호버 경로도 다시 따라간다
+	if (hovered_tile_ != Math::ivec2{ -1, -1 })
+		movement_reachable_.PathTo(hovered_tile_, hovered_path_);
+}
+
+std::vector<Math::ivec2> GridSystem::GetMovementPath(Math::ivec2 goal)
+{
+	ALLOCATION_SCOPE(Pathfinding);
+	RefreshMovementTree();
+	std::vector<Math::ivec2> path;
+	movement_reachable_.PathTo(goal, path);
+	return path;
 }
 
 // ========================================
@@ -514,7 +632,8 @@ void GridSystem::DisableMovementMode()
 {
 	movement_mode_active_ = false;
 	movement_source_pos_  = { -1, -1 };
-	reachable_tiles_.clear();
+	movement_range_		  = 0;
+	movement_reachable_.Clear();
 	hovered_path_.clear();
 	hovered_tile_ = { -1, -1 };
 
@@ -526,6 +645,8 @@ void GridSystem::DisableMovementMode()
 // ========================================
 void GridSystem::SetHoveredTile(Math::ivec2 hovered_tile)
 {
+	RefreshMovementTree();
+
 	// 이미 호버 중인 타일이면 무시
 	if (hovered_tile_ == hovered_tile)
 	{
@@ -534,20 +655,12 @@ void GridSystem::SetHoveredTile(Math::ivec2 hovered_tile)
 
 	hovered_tile_ = hovered_tile;
 
-	// 이동 가능한 타일이 아니면 경로 초기화
-	if (!IsReachable(hovered_tile))
-	{
-		hovered_path_.clear();
-		return;
-	}
-
-	// A* 경로 찾기
-	hovered_path_ = FindPath(movement_source_pos_, hovered_tile);
+	// 이동 모드 탐색 트리의 부모를 따라간다 (O(경로 길이), 이동 가능한 타일이 아니면 빈 경로)
+	movement_reachable_.PathTo(hovered_tile, hovered_path_);
 
 	if (!hovered_path_.empty())
 	{
-		Engine::GetLogger().LogDebug(
-			"GridSystem: Path to (" + std::to_string(hovered_tile.x) + ", " + std::to_string(hovered_tile.y) + ") calculated (" + std::to_string(hovered_path_.size()) + " tiles)");
+		Engine::GetLogger().LogDebug("GridSystem: Path to ({}, {}) calculated ({} tiles)", hovered_tile.x, hovered_tile.y, hovered_path_.size());
 	}
 }
 
@@ -565,12 +678,12 @@ void GridSystem::ClearHoveredTile()
 // ========================================
 bool GridSystem::IsReachable(Math::ivec2 tile) const
 {
-	return reachable_tiles_.find(tile) != reachable_tiles_.end();
+	return movement_reachable_.Contains(tile);
 }
 
 void GridSystem::LoadMap(const MapData& map_data)
 {
-	Engine::GetLogger().LogEvent("GridSystem::LoadMap - Loading map: " + map_data.id);
+	Engine::GetLogger().LogEvent("GridSystem::LoadMap - Loading map: {}", map_data.id);
 
 	ResizeGrid(map_data.width, map_data.height);
 	Reset();
@@ -579,7 +692,7 @@ void GridSystem::LoadMap(const MapData& map_data)
 	{
 		if (y >= static_cast<int>(map_data.tiles.size()))
 		{
-			Engine::GetLogger().LogError("GridSystem::LoadMap - Row " + std::to_string(y) + " out of bounds");
+			Engine::GetLogger().LogError("GridSystem::LoadMap - Row {} out of bounds", y);
 			break;
 		}
 
@@ -589,7 +702,7 @@ void GridSystem::LoadMap(const MapData& map_data)
 		{
 			if (x >= static_cast<int>(row.length()))
 			{
-				Engine::GetLogger().LogError("GridSystem::LoadMap - Column " + std::to_string(x) + " out of bounds");
+				Engine::GetLogger().LogError("GridSystem::LoadMap - Column {} out of bounds", x);
 				break;
 			}
 
@@ -636,7 +749,14 @@ void GridSystem::LoadMap(const MapData& map_data)
 			std::to_string(map_data.exit_position.y) + ")");
 	}
 
-	Engine::GetLogger().LogEvent("GridSystem::LoadMap - Completed (" + std::to_string(map_data.width * map_data.height) + " tiles)");
+	if (map_data.pathfinding == "hierarchical")
+	{
+		SetPathfindingMode(PathfindingMode::Hierarchical, map_data.cluster_size);
+		Engine::GetLogger().LogEvent("GridSystem::LoadMap - Hierarchical pathfinding ({} clusters, {} entrances)", hierarchy_.GetStats().clusters,
+								 hierarchy_.GetStats().entrances);
+	}
+
+	Engine::GetLogger().LogEvent("GridSystem::LoadMap - Completed ({} tiles)", map_data.width * map_data.height);
 }
 
 ////////////////////////////////////
@@ -9,7 +9,11 @@
 #include "./Engine/Vec2.h"
 #include "./Game/DragonicTactics/Objects/Character.h"
 // #include "./Game/DragonicTactics/States/Test.h"
+#include "./Game/DragonicTactics/StateComponents/GridBitboard.h"
+#include "./Game/DragonicTactics/StateComponents/HierarchicalPathfinder.h"
 #include "./Game/DragonicTactics/StateComponents/MapDataRegistry.h"
+#include "./Game/DragonicTactics/StateComponents/PathfindingEngine.h"
+#include "./Game/DragonicTactics/StateComponents/ReachabilityEngine.h"
 #include "./Game/DragonicTactics/Test/Week1TestMocks.h"
 #include <map>
 #include <memory>
@@ -29,6 +33,12 @@ class GridSystem : public CS230::Component
 	Invalid
   };
 
+  enum class PathfindingMode
+  {
+	Flat,		  // 전체 타일 A*
+	Hierarchical  // 클러스터 입구 그래프 A* + 구간 정제 (큰 맵용)
+  };
+
   // 출구 위치 관리
   void SetExitPosition(Math::ivec2 pos);
 
@@ -43,13 +53,23 @@ class GridSystem : public CS230::Component
   /// @brief 이동 가능한 타일들을 계산 (BFS 기반)
   /// @param start 시작 위치
   /// @param max_distance 최대 이동 거리 (Speed)
+  /// @param lava_penalty 0 보다 크면 Lava 진입 비용 1 + lava_penalty 로 계산 (FindPath 와 같은 규칙)
   /// @return 이동 가능한 타일 목록
-  std::vector<Math::ivec2> GetReachableTiles(Math::ivec2 start, int max_distance);
+  std::vector<Math::ivec2> GetReachableTiles(Math::ivec2 start, int max_distance, int lava_penalty = 0);
 
-  /// @brief 이동 모드 활성화 (이동 가능 타일 계산 및 저장)
+  /// @brief GetReachableTiles 와 같은 계산, 결과를 비트마스크 + 목록으로 반환 (복사 없음)
+  ///        반환값은 다음 ComputeReachable 호출 전까지 유효
+  const ReachableTiles& ComputeReachable(Math::ivec2 start, int max_distance, int lava_penalty = 0);
+
+  /// @brief 이동 모드 활성화 (이동 가능 타일 + 탐색 트리 계산 및 저장)
+  ///        같은 인자로 다시 호출하면 그리드가 바뀌지 않은 한 재계산하지 않는다
   /// @param character_pos 캐릭터 현재 위치
   /// @param movement_range 캐릭터 이동 범위
-  void EnableMovementMode(Math::ivec2 character_pos, int movement_range);
+  /// @param lava_penalty 0 보다 크면 Lava 진입 비용 1 + lava_penalty (가중치 탐색)
+  void EnableMovementMode(Math::ivec2 character_pos, int movement_range, int lava_penalty = 0);
+
+  /// @brief 이동 모드 탐색 트리에서 목표까지 경로 (start 제외, goal 포함). 도달 불가면 빈 벡터
+  std::vector<Math::ivec2> GetMovementPath(Math::ivec2 goal);
 
   /// @brief 이동 모드 비활성화 (시각화 데이터 초기화)
   void DisableMovementMode();
@@ -95,29 +115,37 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
   private:
   int map_width_  = 8;
   int map_height_ = 8;
-  std::vector<std::vector<TileType>>   tile_grid_;
-  std::vector<std::vector<Character*>> character_grid_;
 
-  void ResizeGrid(int w, int h);
+  // 행 우선(y * width + x) 평면 저장소
+  std::vector<TileType>		 tiles_;
+  std::vector<std::uint16_t> occupant_index_; // 0 = 비어 있음, 그 외 occupants_[값 - 1]
+  std::vector<Character*>	 occupants_;	  // 배치된 캐릭터 (조밀 배열, 순서 무관)
+  std::vector<int>			 occupant_tiles_; // occupants_[i] 가 서 있는 타일 인덱스
+  GridBitboard				 passable_bits_;  // Empty 또는 Lava
+  GridBitboard				 occupied_bits_;
+  int						 lava_tile_count_ = 0; // 0 이면 FindPath 비용이 항상 균일 (JPS 선택)
 
-  // A* pathfinding node
-  struct Node
-  {
-	Math::ivec2 position;
-	int			gCost;
-	int			hCost;
+  void RemoveOccupantAt(int index);
 
-	int fCost() const
-	{
-	  return gCost + hCost;
-	}
+  // 타일/점유 변경마다 증가 — 이동 모드 탐색 트리 등 파생 데이터의 갱신 판단용
+  unsigned grid_version_ = 1;
+  std::uint64_t zobrist_ = 0; // 모든 타일이 Empty 이고 아무도 없으면 0
 
-	Node* parent;
+  /// @brief 그리드가 바뀌었으면 이동 모드 탐색 트리를 다시 계산하고 호버 경로를 갱신
+  void RefreshMovementTree();
 
-	Node(Math::ivec2 pos, int g, int h, Node* p = nullptr) : position(pos), gCost(g), hCost(h), parent(p)
-	{
-	}
-  };
+  void ResizeGrid(int w, int h);
+
+  // A*/JPS 엔진 (FindPath 용 scratch 버퍼 재사용)
+  PathfindingEngine pathfinder_;
+
+  // 계층 모드일 때 FindPath 를 처리 (LoadMap 에서 맵 설정에 따라 빌드)
+  PathfindingMode		 pathfinding_mode_ = PathfindingMode::Flat;
+  HierarchicalPathfinder hierarchy_;
+
+  // 이동 범위 BFS 엔진 (visited 비트셋/frontier 재사용) + ComputeReachable 결과 버퍼
+  ReachabilityEngine reach_engine_;
+  ReachableTiles	 reach_scratch_;
 
   Math::ivec2 exit_position_ = { -1, -1 }; // 출구 위치 (-1, -1은 없음)
 
@@ -126,7 +154,10 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
   // ========================================
   bool					   movement_mode_active_ = false;	   // 이동 모드 활성화 여부
   Math::ivec2			   movement_source_pos_	 = { -1, -1 }; // 이동 시작 위치
-  std::set<Math::ivec2>	   reachable_tiles_;				   // 이동 가능한 타일 집합
+  int					   movement_range_		 = 0;
+  int					   movement_lava_penalty_ = 0;
+  unsigned				   movement_grid_version_ = 0; // movement_reachable_ 을 계산한 시점의 grid_version_
+  ReachableTiles		   movement_reachable_;				   // 이동 가능한 타일 (비트마스크 + 목록)
   std::vector<Math::ivec2> hovered_path_;					   // 마우스 호버 시 경로
   Math::ivec2			   hovered_tile_ = { -1, -1 };		   // 현재 마우스 호버 타일
   double				   pulse_timer_	 = 0.0;
@@ -134,11 +165,11 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
 
   // ─ 스펠 타겟팅 시각화 ─
   bool					spell_targeting_mode_active_ = false;
-  std::set<Math::ivec2> spell_targetable_tiles_;
+  GridBitboard			spell_targetable_bits_;
 
   // ─ 공격 범위 시각화 ─
   bool                  attack_range_mode_active_ = false;
-  std::set<Math::ivec2> attack_range_tiles_;
+  GridBitboard          attack_range_bits_;
 
   // ─ 벽 배치 미리보기 시각화 ─
   std::vector<Math::ivec2> wall_preview_tiles_;
@@ -159,6 +190,23 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
   int GetWidth()  const { return map_width_; }
   int GetHeight() const { return map_height_; }
 
+  /// @brief 타일/캐릭터 배치가 바뀔 때마다 증가하는 버전 번호
+  unsigned GetGridVersion() const { return grid_version_; }
+
+  /// @brief 타일 종류 + 캐릭터 배치의 Zobrist 키. 변경 호출마다 바뀐 칸만 XOR 로 갱신한다 (BattleHash 가 사용)
+  std::uint64_t GetZobristKey() const { return zobrist_; }
+
+  // ─ 평면 인덱스 접근 (경로 탐색 등 내부 루프용, 범위 검사 없음) ─
+  int TileIndex(Math::ivec2 tile) const { return tile.y * map_width_ + tile.x; }
+  TileType GetTileTypeAt(int index) const { return tiles_[static_cast<std::size_t>(index)]; }
+  /// @brief Empty/Lava 이고 비어 있는 타일인지 (FindPath 의 통과 조건)
+  bool IsPassableAt(int index) const { return passable_bits_.Test(index) && !occupied_bits_.Test(index); }
+  const GridBitboard& GetPassableBits() const { return passable_bits_; }
+  const GridBitboard& GetOccupiedBits() const { return occupied_bits_; }
+
+  /// @brief 마지막 FindPath 에서 확장한 노드 수 (벤치마크/디버그용)
+  int GetLastPathExpandedCount() const { return pathfinder_.GetLastExpandedCount(); }
+
   GridSystem();
 
   void Reset();
@@ -177,7 +225,53 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
   Character* GetCharacterAt(Math::ivec2 pos) const;
 
   // week2 : pathfinding methods
+  /// @brief start → goal 경로 (start 제외, goal 포함). (start, lava_penalty) 거리장이 이미 캐시에 있으면
+  ///        그 흐름장을 따라가고, 없으면 탐색한다 (새 거리장은 만들지 않음)
   std::vector<Math::ivec2> FindPath(Math::ivec2 start, Math::ivec2 goal, int lava_penalty = 0);
+
+  /// @brief FindPath 방식 선택. Hierarchical 이면 현재 타일로 클러스터/입구 그래프를 새로 만든다
+  ///        (LoadMap 이 MapData::pathfinding 에 따라 호출)
+  void			  SetPathfindingMode(PathfindingMode mode, int cluster_size = 16);
+  PathfindingMode GetPathfindingMode() const { return pathfinding_mode_; }
+  const HierarchicalPathfinder::Stats& GetHierarchicalStats() const { return hierarchy_.GetStats(); }
+
+  /// @brief 평면 모드 FindPath 가 JPS 를 쓰는지 — 비용이 균일할 때 (lava_penalty <= 0 또는 맵에 Lava 없음)
+  bool UsesJumpPointSearch(int lava_penalty) const { return lava_penalty <= 0 || lava_tile_count_ == 0; }
+
+  /// @brief FindPathToNearest 결과
+  struct NearestPathResult
+  {
+	bool					 found = false;
+	Math::ivec2				 goal{ -1, -1 }; // 선택된 목표 타일
+	std::vector<Math::ivec2> path;			 // start 제외, goal 포함
+	int						 cost = 0;		 // 칸당 1 + 용암 패널티
+  };
+
+  /// @brief 여러 목표 중 비용이 가장 낮은 곳까지 한 번의 탐색으로 경로 계산
+  ///        걸을 수 없는 목표/start 와 같은 목표는 무시. 비용이 같으면 goals 앞쪽 우선
+  NearestPathResult FindPathToNearest(Math::ivec2 start, const std::vector<Math::ivec2>& goals, int lava_penalty = 0);
+
+  // ─ 거리장 캐시 ─
+  // (source, lava_penalty) 별 Dijkstra 결과를 보관. 타일/캐릭터 변경 시 영향받는 필드만 버린다.
+
+  /// @brief source 기준 거리장 (캐시에 없으면 계산 후 저장)
+  ///        돌려준 참조는 다음 캐시 조회 (GetDistanceField/GetPathCost/FindPathToNearest) 나 타일/캐릭터 변경 전까지만 유효.
+  ///        그 사이 LRU 교체로 같은 슬롯이 다른 source 로 덮일 수 있으니 오래 들고 있으려면 복사할 것
+  const DistanceField& GetDistanceField(Math::ivec2 source, int lava_penalty = 0);
+
+  /// @brief 캐시된 거리장으로 source → target 비용 (칸당 1 + 용암 패널티), 도달 불가 -1
+  int GetPathCost(Math::ivec2 source, Math::ivec2 target, int lava_penalty = 0);
+
+  struct DistanceFieldStats
+  {
+	int hits		  = 0;
+	int misses		  = 0;
+	int invalidations = 0; // 변경으로 버려진 필드 수
+	int cached		  = 0; // 현재 보관 중인 필드 수
+  };
+
+  DistanceFieldStats GetDistanceFieldStats() const;
+  void			   ResetDistanceFieldStats();
   // int						GetPathLength(Math::ivec2 start, Math::ivec2 goal);
   // std::vector<Math::ivec2> GetReachableTiles(Math::ivec2 start, int maxDistance);
 
@@ -187,11 +281,33 @@ std::vector<Math::ivec2> GetLineTiles(Math::ivec2 center, int reach) const;
 
   std::vector<Character*> GetAllCharacters();
 
+  /// @brief 배치된 캐릭터만 (순서 무관, 복사 없음) — GetAllCharacters 는 빈 타일마다 nullptr 를 넣는다
+  const std::vector<Character*>& GetOccupants() const { return occupants_; }
+
   void Draw() const;
 
   void Update(double dt) override;
 
   void LoadMap(const MapData& map_data);
+
+  private:
+  // 거리장 캐시 — 최근 사용 순으로 최대 MAX_DISTANCE_FIELDS 개, 교체 시 버퍼 재사용
+  // 생성자에서 MAX_DISTANCE_FIELDS 만큼 reserve 하므로 emplace_back 으로 늘어나도 슬롯 주소는 바뀌지 않는다
+  static constexpr int MAX_DISTANCE_FIELDS = 8;
+  struct CachedField
+  {
+	DistanceField field;
+	bool		  valid		= false;
+	unsigned	  last_used = 0;
+  };
+  std::vector<CachedField> distance_fields_;
+  unsigned				   distance_field_clock_ = 0;
+  DistanceFieldStats	   distance_field_stats_;
+
+  /// @brief 캐시에 (source, lava_penalty) 필드가 있으면 hit 로 세고 돌려준다. 없으면 nullptr (계산하지 않음)
+  const DistanceField* FindCachedDistanceField(Math::ivec2 source, int lava_penalty);
+  void				   InvalidateDistanceFields(Math::ivec2 changed_tile);
+  void				   ClearDistanceFields();
 };
 
 // ========================================
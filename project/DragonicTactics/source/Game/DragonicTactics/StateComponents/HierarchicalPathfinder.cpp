@@ -0,0 +1,594 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "GridSystem.h"
+#include "HierarchicalPathfinder.h"
+#include "PathfindingEngine.h"
+#include <algorithm>
+
+namespace
+{
+  constexpr int kDirX[4] = { 0, 0, -1, 1 };
+  constexpr int kDirY[4] = { 1, -1, 0, 0 };
+
+  // 이 길이 이상인 경계 구간은 양 끝에 입구 두 개, 짧으면 가운데 하나
+  constexpr int kLongEntrance = 6;
+
+  int TileCost(const GridSystem& grid, int tile, int lava_penalty)
+  {
+	return 1 + (lava_penalty > 0 && grid.GetTileTypeAt(tile) == GridSystem::TileType::Lava ? lava_penalty : 0);
+  }
+}
+
+void HierarchicalPathfinder::Clear()
+{
+  width_        = 0;
+  height_       = 0;
+  cluster_size_ = 0;
+  clusters_x_   = 0;
+  clusters_y_   = 0;
+  clusters_.clear();
+  east_.clear();
+  north_.clear();
+  dirty_.clear();
+  stats_ = Stats{};
+}
+
+void HierarchicalPathfinder::Build(const GridSystem& grid, int cluster_size)
+{
+  Clear();
+  if (cluster_size <= 0)
+	return;
+
+  width_        = grid.GetWidth();
+  height_       = grid.GetHeight();
+  cluster_size_ = cluster_size;
+  clusters_x_   = (width_ + cluster_size - 1) / cluster_size;
+  clusters_y_   = (height_ + cluster_size - 1) / cluster_size;
+
+  const std::size_t cluster_count = static_cast<std::size_t>(clusters_x_) * static_cast<std::size_t>(clusters_y_);
+  clusters_.assign(cluster_count, Cluster{});
+  east_.assign(cluster_count, {});
+  north_.assign(cluster_count, {});
+
+  const std::size_t count = static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_);
+  local_stamp_.assign(count, 0);
+  local_closed_.assign(count, 0);
+  local_cost_.assign(count, 0);
+  local_parent_.assign(count, -1);
+  abstract_stamp_.assign(count, 0);
+  abstract_closed_.assign(count, 0);
+  abstract_cost_.assign(count, 0);
+  abstract_parent_.assign(count, -1);
+  local_generation_    = 0;
+  abstract_generation_ = 0;
+
+  for (int cy = 0; cy < clusters_y_; ++cy)
+  {
+	for (int cx = 0; cx < clusters_x_; ++cx)
+	{
+	  Cluster& cluster = clusters_[static_cast<std::size_t>(cy * clusters_x_ + cx)];
+	  cluster.x0       = cx * cluster_size;
+	  cluster.y0       = cy * cluster_size;
+	  cluster.x1       = std::min(width_, cluster.x0 + cluster_size);
+	  cluster.y1       = std::min(height_, cluster.y0 + cluster_size);
+	}
+  }
+
+  for (int c = 0; c < static_cast<int>(cluster_count); ++c)
+  {
+	if (c % clusters_x_ + 1 < clusters_x_)
+	  ScanBorder(grid, c, true);
+	if (c / clusters_x_ + 1 < clusters_y_)
+	  ScanBorder(grid, c, false);
+  }
+
+  for (int c = 0; c < static_cast<int>(cluster_count); ++c)
+  {
+	RebuildNodes(c);
+	IntraCosts(grid, c, 0);
+  }
+
+  stats_.clusters = static_cast<int>(cluster_count);
+  RecountStats();
+}
+
+void HierarchicalPathfinder::MarkTileChanged(Math::ivec2 tile)
+{
+  if (!IsBuilt() || tile.x < 0 || tile.x >= width_ || tile.y < 0 || tile.y >= height_)
+	return;
+
+  const int c       = ClusterOf(tile.y * width_ + tile.x);
+  Cluster&  cluster = clusters_[static_cast<std::size_t>(c)];
+  if (!cluster.dirty)
+  {
+	cluster.dirty = true;
+	dirty_.push_back(c);
+  }
+}
+
+int HierarchicalPathfinder::ClusterOf(int tile) const
+{
+  const int x = tile % width_;
+  const int y = tile / width_;
+  return (y / cluster_size_) * clusters_x_ + (x / cluster_size_);
+}
+
+int HierarchicalPathfinder::NodeSlot(const Cluster& cluster, int tile) const
+{
+  auto it = std::lower_bound(cluster.nodes.begin(), cluster.nodes.end(), tile);
+  if (it == cluster.nodes.end() || *it != tile)
+	return -1;
+  return static_cast<int>(it - cluster.nodes.begin());
+}
+
+void HierarchicalPathfinder::ScanBorder(const GridSystem& grid, int cluster, bool east)
+{
+  const Cluster&         c    = clusters_[static_cast<std::size_t>(cluster)];
+  std::vector<Entrance>& list = east ? east_[static_cast<std::size_t>(cluster)] : north_[static_cast<std::size_t>(cluster)];
+  list.clear();
+
+  // 동쪽 경계: x1 - 1 | x1 열을 y 방향으로, 북쪽 경계: y1 - 1 | y1 행을 x 방향으로 훑는다
+  const int lo = east ? c.y0 : c.x0;
+  const int hi = east ? c.y1 : c.x1;
+  auto      near_tile = [&](int k) { return east ? k * width_ + (c.x1 - 1) : (c.y1 - 1) * width_ + k; };
+  auto      far_tile  = [&](int k) { return east ? k * width_ + c.x1 : c.y1 * width_ + k; };
+
+  const GridBitboard& passable  = grid.GetPassableBits();
+  int                 run_start = -1;
+  for (int k = lo; k <= hi; ++k)
+  {
+	const bool open = k < hi && passable.Test(near_tile(k)) && passable.Test(far_tile(k));
+	if (open && run_start < 0)
+	  run_start = k;
+	if (!open && run_start >= 0)
+	{
+	  const int run_end = k - 1;
+	  if (run_end - run_start + 1 >= kLongEntrance)
+	  {
+		list.push_back({ near_tile(run_start), far_tile(run_start) });
+		list.push_back({ near_tile(run_end), far_tile(run_end) });
+	  }
+	  else
+	  {
+		const int mid = (run_start + run_end) / 2;
+		list.push_back({ near_tile(mid), far_tile(mid) });
+	  }
+	  run_start = -1;
+	}
+  }
+}
+
+void HierarchicalPathfinder::RebuildNodes(int cluster)
+{
+  Cluster& c = clusters_[static_cast<std::size_t>(cluster)];
+  c.nodes.clear();
+  c.intra.clear();
+
+  const int cx = cluster % clusters_x_;
+  const int cy = cluster / clusters_x_;
+  for (const Entrance& e : east_[static_cast<std::size_t>(cluster)])
+	c.nodes.push_back(e.near_tile);
+  for (const Entrance& e : north_[static_cast<std::size_t>(cluster)])
+	c.nodes.push_back(e.near_tile);
+  if (cx > 0)
+	for (const Entrance& e : east_[static_cast<std::size_t>(cluster - 1)])
+	  c.nodes.push_back(e.far_tile);
+  if (cy > 0)
+	for (const Entrance& e : north_[static_cast<std::size_t>(cluster - clusters_x_)])
+	  c.nodes.push_back(e.far_tile);
+
+  std::sort(c.nodes.begin(), c.nodes.end());
+  c.nodes.erase(std::unique(c.nodes.begin(), c.nodes.end()), c.nodes.end());
+}
+
+void HierarchicalPathfinder::RecountStats()
+{
+  stats_.entrances      = 0;
+  stats_.abstract_nodes = 0;
+  for (std::size_t c = 0; c < clusters_.size(); ++c)
+  {
+	stats_.entrances += static_cast<int>(east_[c].size() + north_[c].size());
+	stats_.abstract_nodes += static_cast<int>(clusters_[c].nodes.size());
+  }
+}
+
+void HierarchicalPathfinder::Refresh(const GridSystem& grid)
+{
+  if (dirty_.empty())
+	return;
+
+  // 바뀐 클러스터의 네 경계를 다시 훑고, 경계를 공유하는 이웃까지 입구/내부 비용을 다시 만든다
+  std::vector<int> affected;
+  for (int c : dirty_)
+  {
+	const int cx = c % clusters_x_;
+	const int cy = c / clusters_x_;
+	affected.push_back(c);
+	if (cx + 1 < clusters_x_)
+	{
+	  ScanBorder(grid, c, true);
+	  affected.push_back(c + 1);
+	}
+	if (cx > 0)
+	{
+	  ScanBorder(grid, c - 1, true);
+	  affected.push_back(c - 1);
+	}
+	if (cy + 1 < clusters_y_)
+	{
+	  ScanBorder(grid, c, false);
+	  affected.push_back(c + clusters_x_);
+	}
+	if (cy > 0)
+	{
+	  ScanBorder(grid, c - clusters_x_, false);
+	  affected.push_back(c - clusters_x_);
+	}
+	clusters_[static_cast<std::size_t>(c)].dirty = false;
+  }
+  dirty_.clear();
+
+  std::sort(affected.begin(), affected.end());
+  affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+  for (int c : affected)
+  {
+	RebuildNodes(c);
+	IntraCosts(grid, c, 0);
+  }
+  stats_.rebuilt_clusters += static_cast<int>(affected.size());
+  RecountStats();
+}
+
+const std::vector<int>& HierarchicalPathfinder::IntraCosts(const GridSystem& grid, int cluster, int lava_penalty)
+{
+  Cluster& c = clusters_[static_cast<std::size_t>(cluster)];
+  for (const auto& [penalty, costs] : c.intra)
+	if (penalty == lava_penalty)
+	  return costs;
+
+  const std::size_t n = c.nodes.size();
+  std::vector<int>  costs(n * n, -1);
+  std::vector<int>  row;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+	LocalCosts(grid, c.nodes[i], cluster, lava_penalty, false, row);
+	std::copy(row.begin(), row.end(), costs.begin() + static_cast<std::ptrdiff_t>(i * n));
+  }
+  c.intra.emplace_back(lava_penalty, std::move(costs));
+  return c.intra.back().second;
+}
+
+bool HierarchicalPathfinder::HeapGreater(const HeapEntry& a, const HeapEntry& b)
+{
+  if (a.f != b.f)
+	return a.f > b.f;
+  return a.order > b.order;
+}
+
+void HierarchicalPathfinder::HeapPush(std::vector<HeapEntry>& heap, HeapEntry entry)
+{
+  heap.push_back(entry);
+  std::push_heap(heap.begin(), heap.end(), HeapGreater);
+}
+
+int HierarchicalPathfinder::HeapPop(std::vector<HeapEntry>& heap)
+{
+  std::pop_heap(heap.begin(), heap.end(), HeapGreater);
+  const int tile = heap.back().tile;
+  heap.pop_back();
+  return tile;
+}
+
+void HierarchicalPathfinder::LocalCosts(const GridSystem& grid, int source, int cluster, int lava_penalty, bool reverse, std::vector<int>& out_costs)
+{
+  const Cluster&      c        = clusters_[static_cast<std::size_t>(cluster)];
+  const GridBitboard& passable = grid.GetPassableBits();
+
+  ++local_generation_;
+  local_cost_[static_cast<std::size_t>(source)] = 0;
+
+  if (lava_penalty <= 0)
+  {
+	// 모든 칸 비용 1 — 힙 없이 BFS (방향도 상관없다)
+	local_queue_.clear();
+	local_queue_.push_back(source);
+	local_closed_[static_cast<std::size_t>(source)] = local_generation_;
+	for (std::size_t head = 0; head < local_queue_.size(); ++head)
+	{
+	  const int current = local_queue_[head];
+	  const int cx		= current % width_;
+	  const int cy		= current / width_;
+	  for (int d = 0; d < 4; ++d)
+	  {
+		const int nx = cx + kDirX[d];
+		const int ny = cy + kDirY[d];
+		if (nx < c.x0 || nx >= c.x1 || ny < c.y0 || ny >= c.y1)
+		  continue;
+
+		const int		  neighbor = ny * width_ + nx;
+		const std::size_t n		   = static_cast<std::size_t>(neighbor);
+		if (!passable.Test(neighbor) || local_closed_[n] == local_generation_)
+		  continue;
+		local_closed_[n] = local_generation_;
+		local_cost_[n]	 = local_cost_[static_cast<std::size_t>(current)] + 1;
+		local_queue_.push_back(neighbor);
+	  }
+	}
+  }
+  else
+  {
+	local_heap_.clear();
+	local_order_ = 0;
+
+	local_stamp_[static_cast<std::size_t>(source)] = local_generation_;
+	HeapPush(local_heap_, { 0, local_order_++, source });
+
+	while (!local_heap_.empty())
+	{
+	  const int         current = HeapPop(local_heap_);
+	  const std::size_t cur     = static_cast<std::size_t>(current);
+	  if (local_closed_[cur] == local_generation_)
+		continue;
+	  local_closed_[cur] = local_generation_;
+
+	  const int cx = current % width_;
+	  const int cy = current / width_;
+	  for (int d = 0; d < 4; ++d)
+	  {
+		const int nx = cx + kDirX[d];
+		const int ny = cy + kDirY[d];
+		if (nx < c.x0 || nx >= c.x1 || ny < c.y0 || ny >= c.y1)
+		  continue;
+
+		const int         neighbor = ny * width_ + nx;
+		const std::size_t n        = static_cast<std::size_t>(neighbor);
+		if (!passable.Test(neighbor) || local_closed_[n] == local_generation_)
+		  continue;
+
+		// 정방향: 들어가는 타일 비용, 역방향(입구 → source): 지금 타일로 들어가는 비용
+		const int new_cost = local_cost_[cur] + TileCost(grid, reverse ? current : neighbor, lava_penalty);
+		if (local_stamp_[n] != local_generation_ || new_cost < local_cost_[n])
+		{
+		  local_stamp_[n] = local_generation_;
+		  local_cost_[n]  = new_cost;
+		  HeapPush(local_heap_, { new_cost, local_order_++, neighbor });
+		}
+	  }
+	}
+  }
+
+  out_costs.resize(c.nodes.size());
+  for (std::size_t i = 0; i < c.nodes.size(); ++i)
+  {
+	const std::size_t node = static_cast<std::size_t>(c.nodes[i]);
+	out_costs[i]           = local_closed_[node] == local_generation_ ? local_cost_[node] : -1;
+  }
+}
+
+bool HierarchicalPathfinder::LocalPath(const GridSystem& grid, int from, int to, int cluster, int lava_penalty, std::vector<Math::ivec2>& out_path)
+{
+  const Cluster& c  = clusters_[static_cast<std::size_t>(cluster)];
+  const int      tx = to % width_;
+  const int      ty = to / width_;
+
+  ++local_generation_;
+  local_heap_.clear();
+  local_order_ = 0;
+
+  local_stamp_[static_cast<std::size_t>(from)]  = local_generation_;
+  local_cost_[static_cast<std::size_t>(from)]   = 0;
+  local_parent_[static_cast<std::size_t>(from)] = -1;
+  HeapPush(local_heap_, { std::abs(from % width_ - tx) + std::abs(from / width_ - ty), local_order_++, from });
+
+  bool found = false;
+  while (!local_heap_.empty())
+  {
+	const int         current = HeapPop(local_heap_);
+	const std::size_t cur     = static_cast<std::size_t>(current);
+	if (local_closed_[cur] == local_generation_)
+	  continue;
+	local_closed_[cur] = local_generation_;
+	if (current == to)
+	{
+	  found = true;
+	  break;
+	}
+
+	const int cx = current % width_;
+	const int cy = current / width_;
+	for (int d = 0; d < 4; ++d)
+	{
+	  const int nx = cx + kDirX[d];
+	  const int ny = cy + kDirY[d];
+	  if (nx < c.x0 || nx >= c.x1 || ny < c.y0 || ny >= c.y1)
+		continue;
+
+	  const int         neighbor = ny * width_ + nx;
+	  const std::size_t n        = static_cast<std::size_t>(neighbor);
+	  if (!grid.IsPassableAt(neighbor) || local_closed_[n] == local_generation_)
+		continue;
+
+	  const int new_cost = local_cost_[cur] + TileCost(grid, neighbor, lava_penalty);
+	  if (local_stamp_[n] != local_generation_ || new_cost < local_cost_[n])
+	  {
+		local_stamp_[n]  = local_generation_;
+		local_cost_[n]   = new_cost;
+		local_parent_[n] = current;
+		HeapPush(local_heap_, { new_cost + std::abs(nx - tx) + std::abs(ny - ty), local_order_++, neighbor });
+	  }
+	}
+  }
+  if (!found)
+	return false;
+
+  const std::size_t first = out_path.size();
+  for (int i = to; i != from; i = local_parent_[static_cast<std::size_t>(i)])
+	out_path.push_back({ i % width_, i / width_ });
+  std::reverse(out_path.begin() + static_cast<std::ptrdiff_t>(first), out_path.end());
+  return true;
+}
+
+bool HierarchicalPathfinder::AbstractSearch(const GridSystem& grid, int start, int goal, int lava_penalty)
+{
+  const int start_cluster = ClusterOf(start);
+  const int goal_cluster  = ClusterOf(goal);
+  LocalCosts(grid, start, start_cluster, lava_penalty, false, start_costs_);
+  LocalCosts(grid, goal, goal_cluster, lava_penalty, true, goal_costs_);
+
+  ++abstract_generation_;
+  abstract_heap_.clear();
+  abstract_order_      = 0;
+  stats_.last_expanded = 0;
+
+  const int gx        = goal % width_;
+  const int gy        = goal / width_;
+  auto      heuristic = [&](int tile) { return std::abs(tile % width_ - gx) + std::abs(tile / width_ - gy); };
+  auto      relax     = [&](int from, int to, int edge_cost)
+  {
+	const std::size_t t        = static_cast<std::size_t>(to);
+	const int         new_cost = abstract_cost_[static_cast<std::size_t>(from)] + edge_cost;
+	if (abstract_closed_[t] == abstract_generation_)
+	  return;
+	if (abstract_stamp_[t] != abstract_generation_ || new_cost < abstract_cost_[t])
+	{
+	  abstract_stamp_[t]  = abstract_generation_;
+	  abstract_cost_[t]   = new_cost;
+	  abstract_parent_[t] = from;
+	  HeapPush(abstract_heap_, { new_cost + heuristic(to), abstract_order_++, to });
+	}
+  };
+
+  abstract_stamp_[static_cast<std::size_t>(start)]  = abstract_generation_;
+  abstract_cost_[static_cast<std::size_t>(start)]   = 0;
+  abstract_parent_[static_cast<std::size_t>(start)] = -1;
+  HeapPush(abstract_heap_, { heuristic(start), abstract_order_++, start });
+
+  bool found = false;
+  while (!abstract_heap_.empty())
+  {
+	const int         current = HeapPop(abstract_heap_);
+	const std::size_t cur     = static_cast<std::size_t>(current);
+	if (abstract_closed_[cur] == abstract_generation_)
+	  continue;
+	abstract_closed_[cur] = abstract_generation_;
+	++stats_.last_expanded;
+	if (current == goal)
+	{
+	  found = true;
+	  break;
+	}
+
+	const int      cluster_index = ClusterOf(current);
+	const Cluster& cluster       = clusters_[static_cast<std::size_t>(cluster_index)];
+	const int      slot          = NodeSlot(cluster, current);
+
+	// 클러스터 내부 간선: start 는 미리 구한 비용, 입구는 비용 행렬
+	if (current == start)
+	{
+	  for (std::size_t k = 0; k < cluster.nodes.size(); ++k)
+		if (start_costs_[k] > 0)
+		  relax(current, cluster.nodes[k], start_costs_[k]);
+	}
+	else if (slot >= 0)
+	{
+	  const std::vector<int>& costs = IntraCosts(grid, cluster_index, lava_penalty);
+	  const std::size_t       n     = cluster.nodes.size();
+	  for (std::size_t k = 0; k < n; ++k)
+	  {
+		const int cost = costs[static_cast<std::size_t>(slot) * n + k];
+		if (cost > 0)
+		  relax(current, cluster.nodes[k], cost);
+	  }
+	}
+
+	// 목표 클러스터의 입구 → goal
+	if (cluster_index == goal_cluster && slot >= 0 && goal_costs_[static_cast<std::size_t>(slot)] > 0)
+	  relax(current, goal, goal_costs_[static_cast<std::size_t>(slot)]);
+
+	// 경계 건너기: 같은 입구 쌍의 반대편 타일
+	const int x  = current % width_;
+	const int y  = current / width_;
+	const int cx = cluster_index % clusters_x_;
+	const int cy = cluster_index / clusters_x_;
+	if (x == cluster.x1 - 1 && cx + 1 < clusters_x_)
+	  for (const Entrance& e : east_[static_cast<std::size_t>(cluster_index)])
+		if (e.near_tile == current)
+		  relax(current, e.far_tile, TileCost(grid, e.far_tile, lava_penalty));
+	if (x == cluster.x0 && cx > 0)
+	  for (const Entrance& e : east_[static_cast<std::size_t>(cluster_index - 1)])
+		if (e.far_tile == current)
+		  relax(current, e.near_tile, TileCost(grid, e.near_tile, lava_penalty));
+	if (y == cluster.y1 - 1 && cy + 1 < clusters_y_)
+	  for (const Entrance& e : north_[static_cast<std::size_t>(cluster_index)])
+		if (e.near_tile == current)
+		  relax(current, e.far_tile, TileCost(grid, e.far_tile, lava_penalty));
+	if (y == cluster.y0 && cy > 0)
+	  for (const Entrance& e : north_[static_cast<std::size_t>(cluster_index - clusters_x_)])
+		if (e.far_tile == current)
+		  relax(current, e.near_tile, TileCost(grid, e.near_tile, lava_penalty));
+  }
+  if (!found)
+	return false;
+
+  abstract_path_.clear();
+  for (int i = goal; i != -1; i = abstract_parent_[static_cast<std::size_t>(i)])
+	abstract_path_.push_back(i);
+  std::reverse(abstract_path_.begin(), abstract_path_.end());
+  return true;
+}
+
+bool HierarchicalPathfinder::FindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty, PathfindingEngine& flat, std::vector<Math::ivec2>& out_path)
+{
+  out_path.clear();
+  Refresh(grid);
+  stats_.last_used_flat = false;
+
+  const int start_index = start.y * width_ + start.x;
+  const int goal_index  = goal.y * width_ + goal.x;
+
+  // 같은 클러스터이거나 클러스터 한 칸 거리 이내면 평면 A* 가 더 싸다.
+  // start 는 통과 검사를 하지 않으므로 (벽 위 등) 입구 그래프에 붙일 수 없는 경우도 평면 A* 로 처리
+  if (ClusterOf(start_index) == ClusterOf(goal_index) || std::abs(start.x - goal.x) + std::abs(start.y - goal.y) <= cluster_size_ ||
+	  !grid.GetPassableBits().Test(start_index))
+  {
+	stats_.last_used_flat = true;
+	return flat.FindPath(grid, start, goal, lava_penalty, out_path);
+  }
+
+  // 지형만 본 그래프에서 경로가 없으면 점유를 반영한 평면 탐색도 실패한다
+  if (!AbstractSearch(grid, start_index, goal_index, lava_penalty))
+	return false;
+
+  // 정제: 경계를 건너는 간선은 한 칸, 나머지는 해당 클러스터 안에서만 A*
+  for (std::size_t i = 0; i + 1 < abstract_path_.size(); ++i)
+  {
+	const int from = abstract_path_[i];
+	const int to   = abstract_path_[i + 1];
+	const int from_cluster = ClusterOf(from);
+	bool      ok           = true;
+	if (from_cluster != ClusterOf(to))
+	{
+	  ok = grid.IsPassableAt(to);
+	  if (ok)
+		out_path.push_back({ to % width_, to / width_ });
+	}
+	else
+	{
+	  ok = LocalPath(grid, from, to, from_cluster, lava_penalty, out_path);
+	}
+
+	if (!ok)
+	{
+	  // 캐릭터가 입구/구간을 막고 있다 — 평면 A* 로 다시 찾는다
+	  stats_.last_used_flat = true;
+	  return flat.FindPath(grid, start, goal, lava_penalty, out_path);
+	}
+  }
+  return !out_path.empty();
+}
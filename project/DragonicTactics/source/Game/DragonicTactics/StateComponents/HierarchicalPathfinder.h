@@ -0,0 +1,142 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Vec2.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class GridSystem;
+class PathfindingEngine;
+
+/// @brief 큰 맵용 계층 경로 탐색 (HPA*)
+///
+/// 그리드를 cluster_size 정사각 클러스터로 나누고, 인접 클러스터 경계에서 양쪽이 모두
+/// 통과 가능한 구간마다 입구(타일 쌍)를 둔다. 클러스터 안 입구끼리의 비용은 미리 계산해 두고
+/// (lava_penalty 별로 처음 필요할 때 추가), 질의는 입구 그래프에서 A* 를 돌린 뒤
+/// 실제로 지나가는 클러스터 구간만 타일 단위로 정제한다.
+///
+/// 추상 그래프는 지형(Empty/Lava)만 본다. 캐릭터 점유는 정제 단계에서만 반영하고,
+/// 정제가 막히면 평면 A* 로 다시 찾는다. 지형이 바뀌면 해당 클러스터와 이웃만 다시 만든다.
+class HierarchicalPathfinder
+{
+  public:
+  struct Stats
+  {
+	int	 clusters		  = 0;
+	int	 entrances		  = 0; // 경계를 건너는 입구 쌍 수
+	int	 abstract_nodes	  = 0; // 입구 타일 수 (양쪽 합)
+	int	 rebuilt_clusters = 0; // Build 이후 부분 갱신된 클러스터 수 (누적)
+	int	 last_expanded	  = 0; // 마지막 추상 탐색에서 확장한 노드 수
+	bool last_used_flat	  = false; // 마지막 질의를 평면 A* 로 처리했는지 (짧은 질의/정제 실패)
+  };
+
+  /// @brief 클러스터/입구/클러스터 내부 비용(penalty 0) 전체 계산 — LoadMap 에서 호출
+  void Build(const GridSystem& grid, int cluster_size);
+  void Clear();
+
+  bool IsBuilt() const
+  {
+	return cluster_size_ > 0;
+  }
+
+  int GetClusterSize() const
+  {
+	return cluster_size_;
+  }
+
+  /// @brief 지형 변경 알림 — 다음 질의 전에 해당 클러스터와 이웃만 다시 만든다
+  void MarkTileChanged(Math::ivec2 tile);
+
+  /// @brief start → goal 경로 (start 제외). GridSystem::FindPath 와 같은 통과/비용 규칙
+  ///        같은 클러스터 안이거나 가까운 질의, 정제 실패 시에는 flat 엔진을 쓴다
+  bool FindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty, PathfindingEngine& flat, std::vector<Math::ivec2>& out_path);
+
+  const Stats& GetStats() const
+  {
+	return stats_;
+  }
+
+  private:
+  struct Cluster
+  {
+	int											  x0 = 0, y0 = 0, x1 = 0, y1 = 0; // [x0, x1) x [y0, y1)
+	std::vector<int>							  nodes;						  // 이 클러스터 쪽 입구 타일 인덱스 (정렬, 중복 없음)
+	std::vector<std::pair<int, std::vector<int>>> intra;						  // (lava_penalty, nodes x nodes 비용 행렬, -1 = 불가)
+	bool										  dirty = false;
+  };
+
+  struct Entrance
+  {
+	int near_tile; // 경계 안쪽 (동쪽/북쪽 경계를 가진 클러스터)
+	int far_tile;  // 경계 바깥쪽 (이웃 클러스터)
+  };
+
+  struct HeapEntry
+  {
+	int			  f;
+	std::uint32_t order;
+	int			  tile;
+  };
+
+  int width_		= 0;
+  int height_		= 0;
+  int cluster_size_ = 0;
+  int clusters_x_	= 0;
+  int clusters_y_	= 0;
+
+  std::vector<Cluster>				 clusters_;
+  std::vector<std::vector<Entrance>> east_;	 // east_[c]  : c 와 c + 1 사이
+  std::vector<std::vector<Entrance>> north_; // north_[c] : c 와 c + clusters_x_ 사이
+  std::vector<int>					 dirty_;
+  Stats								 stats_;
+
+  // 타일 인덱스별 scratch — stamp 가 현재 세대일 때만 유효
+  std::vector<std::uint32_t> local_stamp_;
+  std::vector<std::uint32_t> local_closed_;
+  std::vector<int>			 local_cost_;
+  std::vector<int>			 local_parent_;
+  std::uint32_t				 local_generation_ = 0;
+
+  std::vector<std::uint32_t> abstract_stamp_;
+  std::vector<std::uint32_t> abstract_closed_;
+  std::vector<int>			 abstract_cost_;
+  std::vector<int>			 abstract_parent_;
+  std::uint32_t				 abstract_generation_ = 0;
+
+  std::vector<HeapEntry>   local_heap_;
+  std::vector<int>		   local_queue_;
+  std::vector<HeapEntry>   abstract_heap_;
+  std::uint32_t			   local_order_	   = 0;
+  std::uint32_t			   abstract_order_ = 0;
+  std::vector<int>		   start_costs_;
+  std::vector<int>		   goal_costs_;
+  std::vector<int>		   abstract_path_;
+
+  int  ClusterOf(int tile) const;
+  int  NodeSlot(const Cluster& cluster, int tile) const;
+  void ScanBorder(const GridSystem& grid, int cluster, bool east);
+  void RebuildNodes(int cluster);
+  void RecountStats();
+  void Refresh(const GridSystem& grid);
+
+  /// @brief 클러스터 내부 입구 간 비용 행렬 (해당 penalty 가 처음이면 계산 후 보관)
+  const std::vector<int>& IntraCosts(const GridSystem& grid, int cluster, int lava_penalty);
+
+  /// @brief 클러스터 안에서 source 와 각 입구 사이 비용 (지형만, reverse 면 입구 → source)
+  void LocalCosts(const GridSystem& grid, int source, int cluster, int lava_penalty, bool reverse, std::vector<int>& out_costs);
+
+  /// @brief 클러스터 안 from → to 타일 경로를 out_path 뒤에 붙인다 (from 제외, 점유 반영)
+  bool LocalPath(const GridSystem& grid, int from, int to, int cluster, int lava_penalty, std::vector<Math::ivec2>& out_path);
+
+  /// @brief 입구 그래프 A* — 성공하면 abstract_path_ 에 start..goal 타일 순서로 채운다
+  bool AbstractSearch(const GridSystem& grid, int start, int goal, int lava_penalty);
+
+  static bool HeapGreater(const HeapEntry& a, const HeapEntry& b);
+  static void HeapPush(std::vector<HeapEntry>& heap, HeapEntry entry);
+  static int  HeapPop(std::vector<HeapEntry>& heap);
+};
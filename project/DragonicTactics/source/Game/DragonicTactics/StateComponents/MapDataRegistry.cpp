@@ -48,6 +48,13 @@ void MapDataRegistry::LoadMaps(const std::string& json_path) {
             map_data.has_exit = true;
         }
 
+        if (map_json.contains("pathfinding")) {
+            map_data.pathfinding = map_json["pathfinding"];
+        }
+        if (map_json.contains("cluster_size")) {
+            map_data.cluster_size = map_json["cluster_size"];
+        }
+
         maps_[map_data.id] = map_data;
         Engine::GetLogger().LogEvent("Loaded map: " + map_data.id);
     }
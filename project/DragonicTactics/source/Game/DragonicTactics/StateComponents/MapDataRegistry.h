@@ -38,6 +38,9 @@ struct MapData {
     std::map<std::string, Math::ivec2> spawn_points;
     bool has_exit = false;
     Math::ivec2 exit_position{0, 0};
+    // 경로 탐색 모드: "flat" (기본) 또는 "hierarchical" (큰 맵용 HPA*)
+    std::string pathfinding = "flat";
+    int cluster_size = 16;
 };
 
 class MapDataRegistry : public CS230::Component {
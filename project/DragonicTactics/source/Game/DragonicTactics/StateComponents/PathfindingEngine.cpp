@@ -0,0 +1,549 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "GridSystem.h"
+#include "PathfindingEngine.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+  // GridSystem::GetNeighbors 와 같은 순서 (up, down, left, right) — 순서가 바뀌면 동률 경로가 달라진다
+  constexpr int kDirX[4] = { 0, 0, -1, 1 };
+  constexpr int kDirY[4] = { 1, -1, 0, 0 };
+
+  int Manhattan(int ax, int ay, int bx, int by)
+  {
+	return std::abs(ax - bx) + std::abs(ay - by);
+  }
+}
+
+void PathfindingEngine::Resize(int width, int height)
+{
+  if (width == width_ && height == height_)
+	return;
+
+  width_  = width;
+  height_ = height;
+
+  const std::size_t count = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+  stamp_.assign(count, 0);
+  g_cost_.assign(count, 0);
+  f_cost_.assign(count, 0);
+  parent_.assign(count, -1);
+  order_.assign(count, 0);
+  heap_pos_.assign(count, -1);
+  closed_bits_.assign((count + 63) / 64, 0);
+  arrival_dir_.assign(count, 0);
+  heap_.clear();
+  heap_.reserve(count);
+  generation_ = 0;
+}
+
+void PathfindingEngine::BeginSearch()
+{
+  ++generation_;
+  if (generation_ == 0)
+  {
+	// stamp 가 한 바퀴 돌았다 — 오래된 stamp 가 우연히 일치하지 않도록 전체 초기화
+	std::fill(stamp_.begin(), stamp_.end(), 0u);
+	generation_ = 1;
+  }
+  std::fill(closed_bits_.begin(), closed_bits_.end(), 0ULL);
+  heap_.clear();
+  next_order_	 = 0;
+  last_expanded_ = 0;
+}
+
+bool PathfindingEngine::FindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty, std::vector<Math::ivec2>& out_path)
+{
+  out_path.clear();
+  Resize(grid.GetWidth(), grid.GetHeight());
+  BeginSearch();
+
+  const int start_index = start.y * width_ + start.x;
+  const int goal_index  = goal.y * width_ + goal.x;
+
+  {
+	const std::size_t s = static_cast<std::size_t>(start_index);
+	stamp_[s]			= generation_;
+	g_cost_[s]			= 0;
+	f_cost_[s]			= Manhattan(start.x, start.y, goal.x, goal.y);
+	parent_[s]			= -1;
+	HeapPush(start_index);
+  }
+
+  bool found = false;
+  while (!heap_.empty())
+  {
+	const int current = HeapPop();
+	SetClosed(current);
+	++last_expanded_;
+
+	if (current == goal_index)
+	{
+	  found = true;
+	  break;
+	}
+
+	const int cx		= current % width_;
+	const int cy		= current / width_;
+	const int current_g = g_cost_[static_cast<std::size_t>(current)];
+
+	for (int d = 0; d < 4; ++d)
+	{
+	  const int nx = cx + kDirX[d];
+	  const int ny = cy + kDirY[d];
+	  if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_)
+		continue;
+
+	  const int neighbor = ny * width_ + nx;
+	  if (!grid.IsPassableAt(neighbor) || IsClosed(neighbor))
+		continue;
+
+	  const bool is_lava = grid.GetTileTypeAt(neighbor) == GridSystem::TileType::Lava;
+
+	  const int		   tile_cost = 1 + (lava_penalty > 0 && is_lava ? lava_penalty : 0);
+	  const int		   new_g	 = current_g + tile_cost;
+	  const std::size_t n		 = static_cast<std::size_t>(neighbor);
+
+	  if (stamp_[n] != generation_)
+	  {
+		// 처음 보는 노드
+		stamp_[n]  = generation_;
+		g_cost_[n] = new_g;
+		f_cost_[n] = new_g + Manhattan(nx, ny, goal.x, goal.y);
+		parent_[n] = current;
+		HeapPush(neighbor);
+	  }
+	  else if (new_g < g_cost_[n])
+	  {
+		// open 에 있는 노드 — decrease-key (삽입 순서는 그대로 유지)
+		f_cost_[n] -= g_cost_[n] - new_g;
+		g_cost_[n]	= new_g;
+		parent_[n]	= current;
+		SiftUp(heap_pos_[n]);
+	  }
+	}
+  }
+
+  if (!found)
+	return false;
+
+  // 경로 길이를 먼저 센 뒤 뒤에서부터 채운다 (start 제외)
+  std::size_t length = 0;
+  for (int i = goal_index; i != start_index; i = parent_[static_cast<std::size_t>(i)])
+	++length;
+
+  out_path.resize(length);
+  std::size_t slot = length;
+  for (int i = goal_index; i != start_index; i = parent_[static_cast<std::size_t>(i)])
+  {
+	out_path[--slot] = Math::ivec2{ i % width_, i / width_ };
+  }
+  return !out_path.empty();
+}
+
+// ========================================
+// Jump Point Search (4방향)
+// ========================================
+//
+// 균일 비용 4방향 그리드에서 최단 경로는 "세로 우선" 표준형으로 바꿀 수 있다:
+// 가로로 가다가 세로로 꺾는 지점의 직전 칸에서 같은 쪽 세로 칸이 비어 있으면 거기서 먼저
+// 꺾어도 길이가 같다. 그래서
+//  - 세로 이동 중에는 매 칸에서 좌우 가로 탐색을 해 보고, 무언가 찾으면 그 칸이 jump point
+//  - 가로 이동은 위/아래 칸이 "직전 칸에서는 막혔는데 지금은 열린" 경우(forced)에만 멈춘다
+// 중간 타일은 open set 에 들어가지 않고, 경로 복원 때 jump point 사이를 직선으로 채운다.
+
+void PathfindingEngine::BuildJumpBits(const GridSystem& grid)
+{
+  // 타일 하나 = 1비트, 행 y 의 x 는 (y + 1) 번째 행의 x + 1 번째 비트
+  jump_row_words_ = static_cast<int>(GridBitboard::WordCount(width_ + 2));
+  jump_bits_.assign(static_cast<std::size_t>(jump_row_words_) * static_cast<std::size_t>(height_ + 2), 0);
+
+  const std::vector<std::uint64_t>& passable = grid.GetPassableBits().Words();
+  const std::vector<std::uint64_t>& occupied = grid.GetOccupiedBits().Words();
+  const auto						read	 = [&](const std::vector<std::uint64_t>& words, int bit)
+  {
+	const std::size_t w		= static_cast<std::size_t>(bit >> 6);
+	const int		  shift = bit & 63;
+	std::uint64_t	  value = words[w] >> shift;
+	if (shift != 0 && w + 1 < words.size())
+	  value |= words[w + 1] << (64 - shift);
+	return value;
+  };
+
+  for (int y = 0; y < height_; ++y)
+  {
+	std::uint64_t* row = &jump_bits_[static_cast<std::size_t>((y + 1) * jump_row_words_)];
+	for (int x = 0; x < width_; x += 64)
+	{
+	  const int			  bit	= y * width_ + x;
+	  const int			  count = std::min(64, width_ - x);
+	  std::uint64_t		  chunk = read(passable, bit) & ~read(occupied, bit);
+	  if (count < 64)
+		chunk &= (1ULL << count) - 1;
+
+	  // x + 1 위치로 한 칸 밀어서 기록
+	  const std::size_t w = static_cast<std::size_t>((x + 1) >> 6);
+	  row[w] |= chunk << 1;
+	  row[w + 1] |= chunk >> 63;
+	}
+  }
+}
+
+int PathfindingEngine::JumpHorizontal(int x, int y, int dx, int goal_index) const
+{
+  // 세 행(위, 현재, 아래)을 워드 단위로 보며 "막힘 | forced | goal" 중 가장 가까운 비트를 찾는다
+  const std::uint64_t* row  = &jump_bits_[static_cast<std::size_t>((y + 1) * jump_row_words_)];
+  const std::uint64_t* up	= row + jump_row_words_;
+  const std::uint64_t* down = row - jump_row_words_;
+  const int			   goal_bit = goal_index / width_ == y ? goal_index % width_ + 1 : -1;
+  const int			   from		= x + 1;
+
+  // forced: 이 칸 위/아래는 열렸는데 직전 칸(x - dx)의 위/아래는 막힌 경우
+  const auto forced = [&](const std::uint64_t* r, int w)
+  {
+	const std::uint64_t prev = dx > 0 ? (r[w] << 1) | (w > 0 ? r[w - 1] >> 63 : 0) : (r[w] >> 1) | (w + 1 < jump_row_words_ ? r[w + 1] << 63 : 0);
+	return r[w] & ~prev;
+  };
+
+  for (int w = from >> 6; w >= 0 && w < jump_row_words_; w += dx)
+  {
+	const std::uint64_t blocked = ~row[w];
+	std::uint64_t		stop	= blocked | forced(up, w) | forced(down, w);
+	if (goal_bit >= 0 && (goal_bit >> 6) == w)
+	  stop |= 1ULL << (goal_bit & 63);
+
+	// 시작 칸과 그 뒤쪽 비트는 제외
+	if (w == from >> 6)
+	{
+	  const int		   shift = from & 63;
+	  const std::uint64_t ahead = dx > 0 ? (shift == 63 ? 0 : ~0ULL << (shift + 1)) : (1ULL << shift) - 1;
+	  stop &= ahead;
+	}
+	if (stop == 0)
+	  continue;
+
+	const int bit = dx > 0 ? std::countr_zero(stop) : 63 - std::countl_zero(stop);
+	if ((blocked >> bit) & 1ULL)
+	  return -1;
+	return y * width_ + (w * 64 + bit - 1);
+  }
+  return -1;
+}
+
+int PathfindingEngine::JumpVertical(int x, int y, int dy, int goal_index) const
+{
+  while (true)
+  {
+	y += dy;
+	if (!IsFree(x, y))
+	  return -1;
+
+	const int index = y * width_ + x;
+	if (index == goal_index)
+	  return index;
+	if (JumpHorizontal(x, y, -1, goal_index) >= 0 || JumpHorizontal(x, y, 1, goal_index) >= 0)
+	  return index;
+  }
+}
+
+void PathfindingEngine::PushJumpPoint(int index, int parent, int g, int dir, Math::ivec2 goal)
+{
+  const std::size_t n = static_cast<std::size_t>(index);
+  if (IsClosed(index))
+	return;
+
+  if (stamp_[n] != generation_)
+  {
+	stamp_[n]		= generation_;
+	g_cost_[n]		= g;
+	f_cost_[n]		= g + Manhattan(index % width_, index / width_, goal.x, goal.y);
+	parent_[n]		= parent;
+	arrival_dir_[n] = static_cast<std::uint8_t>(dir);
+	HeapPush(index);
+  }
+  else if (g < g_cost_[n])
+  {
+	f_cost_[n] -= g_cost_[n] - g;
+	g_cost_[n]		= g;
+	parent_[n]		= parent;
+	arrival_dir_[n] = static_cast<std::uint8_t>(dir);
+	SiftUp(heap_pos_[n]);
+  }
+}
+
+bool PathfindingEngine::FindPathJumpPoint(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, std::vector<Math::ivec2>& out_path)
+{
+  out_path.clear();
+  Resize(grid.GetWidth(), grid.GetHeight());
+  BeginSearch();
+  BuildJumpBits(grid);
+
+  const int start_index = start.y * width_ + start.x;
+  const int goal_index  = goal.y * width_ + goal.x;
+
+  {
+	const std::size_t s = static_cast<std::size_t>(start_index);
+	stamp_[s]			= generation_;
+	g_cost_[s]			= 0;
+	f_cost_[s]			= Manhattan(start.x, start.y, goal.x, goal.y);
+	parent_[s]			= -1;
+	arrival_dir_[s]		= 4;
+	HeapPush(start_index);
+  }
+
+  bool found = false;
+  while (!heap_.empty())
+  {
+	const int current = HeapPop();
+	SetClosed(current);
+	++last_expanded_;
+
+	if (current == goal_index)
+	{
+	  found = true;
+	  break;
+	}
+
+	const int cx		= current % width_;
+	const int cy		= current / width_;
+	const int current_g = g_cost_[static_cast<std::size_t>(current)];
+	const int dir		= arrival_dir_[static_cast<std::size_t>(current)];
+
+	for (int d = 0; d < 4; ++d)
+	{
+	  const bool vertical = kDirX[d] == 0;
+	  if (dir != 4)
+	  {
+		if (d == (dir ^ 1))
+		  continue; // 되돌아가는 방향
+		if (kDirX[dir] != 0 && vertical)
+		{
+		  // 가로로 들어온 점: forced 인 세로 방향만
+		  if (!IsFree(cx, cy + kDirY[d]) || IsFree(cx - kDirX[dir], cy + kDirY[d]))
+			continue;
+		}
+	  }
+
+	  const int next = vertical ? JumpVertical(cx, cy, kDirY[d], goal_index) : JumpHorizontal(cx, cy, kDirX[d], goal_index);
+	  if (next < 0)
+		continue;
+	  PushJumpPoint(next, current, current_g + Manhattan(cx, cy, next % width_, next / width_), d, goal);
+	}
+  }
+
+  if (!found)
+	return false;
+
+  // jump point 사이는 항상 한 직선 — 길이는 g 비용과 같다
+  std::size_t length = static_cast<std::size_t>(g_cost_[static_cast<std::size_t>(goal_index)]);
+  out_path.resize(length);
+  for (int i = goal_index; i != start_index; i = parent_[static_cast<std::size_t>(i)])
+  {
+	const int parent = parent_[static_cast<std::size_t>(i)];
+	const int step	 = parent / width_ == i / width_ ? (parent > i ? 1 : -1) : (parent > i ? width_ : -width_);
+	for (int tile = i; tile != parent; tile += step)
+	  out_path[--length] = Math::ivec2{ tile % width_, tile / width_ };
+  }
+  return !out_path.empty();
+}
+
+void PathfindingEngine::BuildDistanceField(const GridSystem& grid, Math::ivec2 source, int lava_penalty, DistanceField& out_field)
+{
+  Resize(grid.GetWidth(), grid.GetHeight());
+  BeginSearch();
+
+  const std::size_t count = static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_);
+  out_field.source		  = source;
+  out_field.lava_penalty  = lava_penalty;
+  out_field.width		  = width_;
+  out_field.height		  = height_;
+  out_field.distance.assign(count, -1);
+  out_field.parent.assign(count, -1);
+  out_field.settle_order.clear();
+
+  // 휴리스틱 없는 A* (f = g) — 힙과 stamp 버퍼를 그대로 재사용
+  const int source_index = source.y * width_ + source.x;
+  {
+	const std::size_t s = static_cast<std::size_t>(source_index);
+	stamp_[s]			= generation_;
+	g_cost_[s]			= 0;
+	f_cost_[s]			= 0;
+	parent_[s]			= -1;
+	HeapPush(source_index);
+  }
+
+  while (!heap_.empty())
+  {
+	const int		  current = HeapPop();
+	const std::size_t c		  = static_cast<std::size_t>(current);
+	SetClosed(current);
+	++last_expanded_;
+
+	out_field.distance[c] = g_cost_[c];
+	out_field.parent[c]	  = parent_[c];
+	out_field.settle_order.push_back(current);
+
+	const int cx		= current % width_;
+	const int cy		= current / width_;
+	const int current_g = g_cost_[c];
+
+	for (int d = 0; d < 4; ++d)
+	{
+	  const int nx = cx + kDirX[d];
+	  const int ny = cy + kDirY[d];
+	  if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_)
+		continue;
+
+	  const int neighbor = ny * width_ + nx;
+	  if (!grid.IsPassableAt(neighbor) || IsClosed(neighbor))
+		continue;
+
+	  const bool is_lava = grid.GetTileTypeAt(neighbor) == GridSystem::TileType::Lava;
+
+	  const int		   new_g = current_g + 1 + (lava_penalty > 0 && is_lava ? lava_penalty : 0);
+	  const std::size_t n	 = static_cast<std::size_t>(neighbor);
+
+	  if (stamp_[n] != generation_)
+	  {
+		stamp_[n]  = generation_;
+		g_cost_[n] = new_g;
+		f_cost_[n] = new_g;
+		parent_[n] = current;
+		HeapPush(neighbor);
+	  }
+	  else if (new_g < g_cost_[n])
+	  {
+		g_cost_[n] = new_g;
+		f_cost_[n] = new_g;
+		parent_[n] = current;
+		SiftUp(heap_pos_[n]);
+	  }
+	}
+  }
+}
+
+bool PathfindingEngine::HeapLess(int a, int b) const
+{
+  const std::size_t ia = static_cast<std::size_t>(a);
+  const std::size_t ib = static_cast<std::size_t>(b);
+  if (f_cost_[ia] != f_cost_[ib])
+	return f_cost_[ia] < f_cost_[ib];
+  return order_[ia] < order_[ib];
+}
+
+void PathfindingEngine::HeapPush(int index)
+{
+  const std::size_t i = static_cast<std::size_t>(index);
+  order_[i]			 = next_order_++;
+  heap_pos_[i]		 = static_cast<int>(heap_.size());
+  heap_.push_back(index);
+  SiftUp(heap_pos_[i]);
+}
+
+int PathfindingEngine::HeapPop()
+{
+  const int top							  = heap_.front();
+  heap_pos_[static_cast<std::size_t>(top)] = -1;
+
+  const int last = heap_.back();
+  heap_.pop_back();
+  if (!heap_.empty())
+  {
+	heap_.front()							  = last;
+	heap_pos_[static_cast<std::size_t>(last)] = 0;
+	SiftDown(0);
+  }
+  return top;
+}
+
+void PathfindingEngine::SiftUp(int pos)
+{
+  const int item = heap_[static_cast<std::size_t>(pos)];
+  while (pos > 0)
+  {
+	const int parent_pos = (pos - 1) / 2;
+	const int parent	 = heap_[static_cast<std::size_t>(parent_pos)];
+	if (!HeapLess(item, parent))
+	  break;
+	heap_[static_cast<std::size_t>(pos)]		= parent;
+	heap_pos_[static_cast<std::size_t>(parent)] = pos;
+	pos											= parent_pos;
+  }
+  heap_[static_cast<std::size_t>(pos)]	  = item;
+  heap_pos_[static_cast<std::size_t>(item)] = pos;
+}
+
+void PathfindingEngine::SiftDown(int pos)
+{
+  const int size = static_cast<int>(heap_.size());
+  const int item = heap_[static_cast<std::size_t>(pos)];
+  while (true)
+  {
+	int child = pos * 2 + 1;
+	if (child >= size)
+	  break;
+	if (child + 1 < size && HeapLess(heap_[static_cast<std::size_t>(child + 1)], heap_[static_cast<std::size_t>(child)]))
+	  ++child;
+	const int child_item = heap_[static_cast<std::size_t>(child)];
+	if (!HeapLess(child_item, item))
+	  break;
+	heap_[static_cast<std::size_t>(pos)]			= child_item;
+	heap_pos_[static_cast<std::size_t>(child_item)] = pos;
+	pos												= child;
+  }
+  heap_[static_cast<std::size_t>(pos)]	  = item;
+  heap_pos_[static_cast<std::size_t>(item)] = pos;
+}
+
+// ========================================
+// DistanceField
+// ========================================
+
+int DistanceField::Distance(Math::ivec2 tile) const
+{
+  if (tile.x < 0 || tile.x >= width || tile.y < 0 || tile.y >= height)
+	return -1;
+  return distance[static_cast<std::size_t>(tile.y * width + tile.x)];
+}
+
+bool DistanceField::PathTo(Math::ivec2 goal, std::vector<Math::ivec2>& out_path) const
+{
+  out_path.clear();
+  if (Distance(goal) <= 0)
+	return false; // 도달 불가 또는 source 자신
+
+  const int source_index = source.y * width + source.x;
+  const int goal_index	 = goal.y * width + goal.x;
+
+  std::size_t length = 0;
+  for (int i = goal_index; i != source_index; i = parent[static_cast<std::size_t>(i)])
+	++length;
+
+  out_path.resize(length);
+  std::size_t slot = length;
+  for (int i = goal_index; i != source_index; i = parent[static_cast<std::size_t>(i)])
+  {
+	out_path[--slot] = Math::ivec2{ i % width, i / width };
+  }
+  return true;
+}
+
+bool DistanceField::Touches(Math::ivec2 tile) const
+{
+  if (Distance(tile) >= 0)
+	return true;
+  for (int d = 0; d < 4; ++d)
+  {
+	if (Distance({ tile.x + kDirX[d], tile.y + kDirY[d] }) >= 0)
+	  return true;
+  }
+  return false;
+}
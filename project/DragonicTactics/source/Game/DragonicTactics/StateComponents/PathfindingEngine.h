@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Vec2.h"
+#include <cstdint>
+#include <vector>
+
+class GridSystem;
+
+/// @brief 한 source 기준 거리/흐름장 (GridSystem 이 (source, lava_penalty) 키로 캐시)
+struct DistanceField
+{
+  Math::ivec2 source{ -1, -1 };
+  int		  lava_penalty = 0;
+  int		  width		   = 0;
+  int		  height	   = 0;
+
+  std::vector<int> distance;	 // 타일 인덱스별 비용, -1 = 도달 불가
+  std::vector<int> parent;		 // source 쪽으로 한 칸 이전 타일 인덱스 (흐름 방향)
+  std::vector<int> settle_order; // 확정된 순서 — penalty 0 이면 BFS 방문 순서와 같다
+
+  int  Distance(Math::ivec2 tile) const;
+  /// @brief source → goal 경로 (source 제외). 도달 불가면 false
+  bool PathTo(Math::ivec2 goal, std::vector<Math::ivec2>& out_path) const;
+  /// @brief tile 의 통과 여부/비용이 바뀌면 이 필드가 달라질 수 있는지
+  ///        (tile 자신이나 이웃이 도달 가능했던 경우만 영향을 받는다)
+  bool Touches(Math::ivec2 tile) const;
+};
+
+/// @brief GridSystem::FindPath 뒤에서 동작하는 A* 엔진
+///
+/// 노드 상태(gCost, parent, 힙 위치)는 타일 인덱스로 접근하는 평면 배열에 두고,
+/// generation stamp 로 "이번 탐색에서 건드린 타일"만 유효하게 취급한다.
+/// open set 은 (fCost, 삽입 순서) 키의 indexed binary heap (decrease-key 지원),
+/// closed set 은 64비트 워드 비트셋이다. Resize 이후 탐색 중에는 힙 할당이 없다.
+///
+/// 삽입 순서를 보조 키로 쓰는 이유: 기존 구현은 open 벡터에서 std::min_element 로
+/// "가장 먼저 들어온 최소 fCost 노드"를 꺼냈다. 같은 순서로 꺼내야 같은 경로가 나온다.
+class PathfindingEngine
+{
+  public:
+  void Resize(int width, int height);
+
+  /// @brief start → goal A* 탐색 (4방향, Empty/Lava 통과, 점유 타일 차단)
+  /// @param lava_penalty Lava 타일 진입 시 추가 비용 (0 = 무시)
+  /// @param out_path     start 를 제외한 goal 까지의 경로. 실패 시 비어 있음
+  /// @return 경로를 찾았으면 true
+  bool FindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty, std::vector<Math::ivec2>& out_path);
+
+  /// @brief 균일 비용(lava_penalty 0 또는 Lava 없음) 전용 Jump Point Search (4방향 변형)
+  ///        FindPath 와 같은 통과 규칙, 경로 길이도 같다. 동률 경로 중 어떤 것을 고르는지만 다르다
+  ///        (세로 이동 우선 — 가로 → 세로 전환은 막힌 칸 옆에서만 일어난다)
+  bool FindPathJumpPoint(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, std::vector<Math::ivec2>& out_path);
+
+  /// @brief source 에서 모든 타일까지의 비용/부모를 한 번에 계산 (Dijkstra)
+  ///        FindPath 와 같은 통과/비용 규칙. 결과는 out_field 의 버퍼를 재사용한다
+  void BuildDistanceField(const GridSystem& grid, Math::ivec2 source, int lava_penalty, DistanceField& out_field);
+
+  /// @brief 마지막 탐색에서 closed 로 확정된 노드 수 (벤치마크/디버그용)
+  int GetLastExpandedCount() const
+  {
+	return last_expanded_;
+  }
+
+  private:
+  int width_  = 0;
+  int height_ = 0;
+
+  // 타일 인덱스(y * width + x) 별 노드 상태 — stamp_[i] == generation_ 일 때만 유효
+  std::vector<std::uint32_t> stamp_;
+  std::vector<int>			 g_cost_;
+  std::vector<int>			 f_cost_;
+  std::vector<int>			 parent_;
+  std::vector<std::uint32_t> order_;	  // open set 삽입 순서 (tie-break)
+  std::vector<int>			 heap_pos_;	  // heap_ 내 위치, -1 = 힙에 없음
+  std::vector<std::uint64_t> closed_bits_;
+  std::vector<std::uint8_t>	 arrival_dir_; // JPS: 부모에서 들어온 방향 (kDirX/kDirY 인덱스, 4 = 시작점)
+
+  std::vector<int> heap_; // 타일 인덱스의 binary min-heap
+  std::uint32_t	   generation_ = 0;
+  std::uint32_t	   next_order_ = 0;
+  int			   last_expanded_ = 0;
+
+  void BeginSearch();
+
+  bool IsClosed(int index) const
+  {
+	return (closed_bits_[static_cast<std::size_t>(index >> 6)] >> (index & 63)) & 1ULL;
+  }
+
+  void SetClosed(int index)
+  {
+	closed_bits_[static_cast<std::size_t>(index >> 6)] |= (1ULL << (index & 63));
+  }
+
+  // JPS 용 통과 비트 (통과 가능 && 비어 있음). 행마다 워드 경계에서 시작하고 좌우/위아래에
+  // 0 인 테두리 한 칸을 둔다 — 가로 탐색이 64칸씩 진행되고 경계 검사가 필요 없다
+  std::vector<std::uint64_t> jump_bits_;
+  int						 jump_row_words_ = 0;
+
+  void BuildJumpBits(const GridSystem& grid);
+
+  bool IsFree(int x, int y) const
+  {
+	const int bit = x + 1;
+	return (jump_bits_[static_cast<std::size_t>((y + 1) * jump_row_words_ + (bit >> 6))] >> (bit & 63)) & 1ULL;
+  }
+
+  // JPS 직선 탐색 — 다음 jump point 의 타일 인덱스, 없으면 -1
+  int  JumpHorizontal(int x, int y, int dx, int goal_index) const;
+  int  JumpVertical(int x, int y, int dy, int goal_index) const;
+  void PushJumpPoint(int index, int parent, int g, int dir, Math::ivec2 goal);
+
+  bool HeapLess(int a, int b) const;
+  void HeapPush(int index);
+  int  HeapPop();
+  void SiftUp(int pos);
+  void SiftDown(int pos);
+};
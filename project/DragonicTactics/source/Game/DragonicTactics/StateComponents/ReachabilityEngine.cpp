@@ -0,0 +1,195 @@
+/**
+* \file
+* \author Taekyung Ho
+* \date 2025 Fall
+* \copyright DigiPen Institute of Technology
+*/
+#include "pch.h"
+
+#include "GridSystem.h"
+#include "ReachabilityEngine.h"
+
+namespace
+{
+  // GridSystem::GetNeighbors 와 같은 순서 (up, down, left, right) — 결과 목록 순서가 기존 BFS 와 같아진다
+  constexpr int kDirX[4] = { 0, 0, -1, 1 };
+  constexpr int kDirY[4] = { 1, -1, 0, 0 };
+}
+
+bool ReachableTiles::PathTo(Math::ivec2 goal, std::vector<Math::ivec2>& out_path) const
+{
+  out_path.clear();
+  if (!Contains(goal))
+	return false;
+
+  const int width		 = mask.GetWidth();
+  const int source_index = source.y * width + source.x;
+  const int goal_index	 = goal.y * width + goal.x;
+
+  // 길이를 먼저 센 뒤 뒤에서부터 채운다
+  std::size_t length = 0;
+  for (int i = goal_index; i != source_index; i = parent[static_cast<std::size_t>(i)])
+	++length;
+  out_path.resize(length);
+  for (int i = goal_index; i != source_index; i = parent[static_cast<std::size_t>(i)])
+	out_path[--length] = { i % width, i / width };
+  return true;
+}
+
+void ReachabilityEngine::Resize(int width, int height)
+{
+  if (width == width_ && height == height_)
+	return;
+
+  width_  = width;
+  height_ = height;
+
+  const std::size_t count = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+  visited_.Resize(width, height);
+  ring_.assign(count, 0);
+  ring_head_  = 0;
+  ring_count_ = 0;
+  cost_.assign(count, 0);
+}
+
+void ReachabilityEngine::BeginSearch(const GridSystem& grid, Math::ivec2 start, ReachableTiles& out)
+{
+  Resize(grid.GetWidth(), grid.GetHeight());
+  visited_.Clear();
+  ring_head_  = 0;
+  ring_count_ = 0;
+
+  if (out.mask.GetWidth() != width_ || out.mask.GetHeight() != height_)
+  {
+	out.mask.Resize(width_, height_);
+	out.parent.assign(static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_), -1);
+  }
+  else
+	out.mask.Clear();
+  out.tiles.clear();
+  out.source = start;
+
+  visited_.Set(start.y * width_ + start.x, true);
+}
+
+void ReachabilityEngine::RingPush(int index)
+{
+  std::size_t tail = ring_head_ + ring_count_;
+  if (tail >= ring_.size())
+	tail -= ring_.size();
+  ring_[tail] = index;
+  ++ring_count_;
+}
+
+int ReachabilityEngine::RingPop()
+{
+  const int index = ring_[ring_head_];
+  if (++ring_head_ == ring_.size())
+	ring_head_ = 0;
+  --ring_count_;
+  return index;
+}
+
+void ReachabilityEngine::Compute(const GridSystem& grid, Math::ivec2 start, int max_distance, ReachableTiles& out)
+{
+  BeginSearch(grid, start, out);
+  RingPush(start.y * width_ + start.x);
+
+  // 레벨 단위로 꺼내서 거리를 따로 저장하지 않는다
+  for (int distance = 0; ring_count_ > 0 && distance < max_distance; ++distance)
+  {
+	for (std::size_t level_size = ring_count_; level_size > 0; --level_size)
+	{
+	  const int current = RingPop();
+	  const int cx      = current % width_;
+	  const int cy      = current / width_;
+
+	  for (int d = 0; d < 4; ++d)
+	  {
+		const int nx = cx + kDirX[d];
+		const int ny = cy + kDirY[d];
+		if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_)
+		  continue;
+
+		const int neighbor = ny * width_ + nx;
+		if (visited_.Test(neighbor) || !grid.IsPassableAt(neighbor))
+		  continue;
+
+		visited_.Set(neighbor, true);
+		out.mask.Set(neighbor, true);
+		out.parent[static_cast<std::size_t>(neighbor)] = current;
+		out.tiles.push_back({ nx, ny });
+		RingPush(neighbor);
+	  }
+	}
+  }
+}
+
+void ReachabilityEngine::ComputeWeighted(const GridSystem& grid, Math::ivec2 start, int max_cost, int lava_penalty, ReachableTiles& out)
+{
+  if (lava_penalty <= 0)
+  {
+	Compute(grid, start, max_cost, out);
+	return;
+  }
+
+  BeginSearch(grid, start, out);
+
+  // 간선 비용이 최대 1 + lava_penalty 이므로 버킷 2 + lava_penalty 개면 겹치지 않는다
+  const std::size_t bucket_count = static_cast<std::size_t>(lava_penalty) + 2;
+  if (buckets_.size() < bucket_count)
+	buckets_.resize(bucket_count);
+  for (std::vector<int>& bucket : buckets_)
+	bucket.clear();
+
+  const int start_index                        = start.y * width_ + start.x;
+  cost_[static_cast<std::size_t>(start_index)] = 0;
+  buckets_[0].push_back(start_index);
+  std::size_t pending = 1;
+
+  for (int cost = 0; pending > 0 && cost <= max_cost; ++cost)
+  {
+	std::vector<int>& bucket = buckets_[static_cast<std::size_t>(cost) % bucket_count];
+	// 처리 중 새로 들어가는 항목은 다른 버킷으로 가므로 인덱스 순회가 안전하다
+	for (std::size_t i = 0; i < bucket.size(); ++i)
+	{
+	  const int current = bucket[i];
+	  --pending;
+	  if (cost_[static_cast<std::size_t>(current)] != cost)
+		continue; // 더 싼 비용으로 이미 확정됨
+
+	  if (current != start_index)
+	  {
+		out.mask.Set(current, true);
+		out.tiles.push_back({ current % width_, current / width_ });
+	  }
+
+	  const int cx = current % width_;
+	  const int cy = current / width_;
+	  for (int d = 0; d < 4; ++d)
+	  {
+		const int nx = cx + kDirX[d];
+		const int ny = cy + kDirY[d];
+		if (nx < 0 || nx >= width_ || ny < 0 || ny >= height_)
+		  continue;
+
+		const int neighbor = ny * width_ + nx;
+		if (!grid.IsPassableAt(neighbor))
+		  continue;
+
+		const bool        is_lava  = grid.GetTileTypeAt(neighbor) == GridSystem::TileType::Lava;
+		const int         new_cost = cost + 1 + (is_lava ? lava_penalty : 0);
+		const std::size_t n        = static_cast<std::size_t>(neighbor);
+		if (new_cost > max_cost || (visited_.Test(neighbor) && new_cost >= cost_[n]))
+		  continue;
+
+		visited_.Set(neighbor, true);
+		cost_[n]		= new_cost;
+		out.parent[n] = current;
+		buckets_[static_cast<std::size_t>(new_cost) % bucket_count].push_back(neighbor);
+		++pending;
+	  }
+	}
+	bucket.clear();
+  }
+}
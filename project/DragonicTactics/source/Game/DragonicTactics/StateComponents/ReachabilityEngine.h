@@ -0,0 +1,77 @@
+/**
+* \file
+* \author Taekyung Ho
+* \date 2025 Fall
+* \copyright DigiPen Institute of Technology
+*/
+#pragma once
+#include "./Engine/Vec2.h"
+#include "./Game/DragonicTactics/StateComponents/GridBitboard.h"
+#include <vector>
+
+class GridSystem;
+
+/// @brief 이동 가능 범위 계산 결과 — 같은 타일 집합을 비트마스크와 목록 두 가지로 보관
+struct ReachableTiles
+{
+  Math::ivec2              source{ -1, -1 };
+  GridBitboard             mask;  // 도달 가능 타일 (source 제외)
+  std::vector<Math::ivec2> tiles; // 방문 순서 = 비용 오름차순 (동률은 BFS 순서)
+  std::vector<int>		   parent; // 탐색 트리: source 쪽 이전 타일 인덱스 (mask 가 켜진 타일만 유효)
+
+  bool Contains(Math::ivec2 tile) const
+  {
+	if (tile.x < 0 || tile.x >= mask.GetWidth() || tile.y < 0 || tile.y >= mask.GetHeight())
+	  return false;
+	return mask.Test(tile.y * mask.GetWidth() + tile.x);
+  }
+
+  /// @brief 탐색 트리의 부모를 따라 source → goal 경로 (source 제외, goal 포함). O(경로 길이)
+  ///        goal 이 mask 에 없으면 false, out_path 는 비운다
+  bool PathTo(Math::ivec2 goal, std::vector<Math::ivec2>& out_path) const;
+
+  void Clear()
+  {
+	source = { -1, -1 };
+	mask.Clear();
+	tiles.clear();
+  }
+};
+
+/// @brief GridSystem::GetReachableTiles 뒤에서 동작하는 범위 탐색 엔진
+///
+/// visited 비트셋과 링 버퍼 frontier 를 호출 사이에 재사용한다 (Resize 이후 할당 없음).
+/// 통과 규칙은 FindPath 와 같다: Empty/Lava 이고 비어 있는 타일, 시작 타일은 검사하지 않는다.
+///  - Compute         : 칸당 비용 1 (BFS)
+///  - ComputeWeighted : Lava 진입 시 1 + lava_penalty (버킷 큐 Dijkstra)
+class ReachabilityEngine
+{
+  public:
+  void Resize(int width, int height);
+
+  /// @brief start 에서 max_distance 걸음 이내의 타일
+  void Compute(const GridSystem& grid, Math::ivec2 start, int max_distance, ReachableTiles& out);
+
+  /// @brief start 에서 누적 비용 max_cost 이내의 타일 (FindPath 와 같은 용암 비용)
+  ///        lava_penalty <= 0 이면 Compute 와 같다
+  void ComputeWeighted(const GridSystem& grid, Math::ivec2 start, int max_cost, int lava_penalty, ReachableTiles& out);
+
+  private:
+  int width_  = 0;
+  int height_ = 0;
+
+  GridBitboard visited_;
+
+  // BFS frontier — 타일마다 최대 한 번 들어가므로 용량 = 타일 수
+  std::vector<int> ring_;
+  std::size_t      ring_head_  = 0;
+  std::size_t      ring_count_ = 0;
+
+  // 가중치 모드: 비용 % 버킷 수 로 순환하는 버킷 큐 (간선 비용 <= 1 + lava_penalty)
+  std::vector<int>              cost_;
+  std::vector<std::vector<int>> buckets_;
+
+  void BeginSearch(const GridSystem& grid, Math::ivec2 start, ReachableTiles& out);
+  void RingPush(int index);
+  int  RingPop();
+};
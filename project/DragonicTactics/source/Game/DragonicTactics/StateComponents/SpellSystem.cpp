@@ -24,7 +24,6 @@
 #include "Game/DragonicTactics/Objects/Components/ActionPoints.h"
 #include "Game/DragonicTactics/Objects/Components/SpellSlots.h"
 #include "Game/DragonicTactics/StateComponents/StatusEffectHandler.h"
-#include "Game/DragonicTactics/Debugger/DebugManager.h"
 #include "Game/DragonicTactics/StateComponents/TurnManager.h"
 #include "Game/Particles.h"
 #include "SpellSystem.h"
@@ -282,7 +281,7 @@ void SpellSystem::ApplySpecialEffect(Character* caster, const SpellData& spell,
 		if (slots)
 		{
 			slots->RestoreOne(restore_level);
-			Engine::GetLogger().LogEvent(caster->TypeName() + " recovered 1 level-" + std::to_string(restore_level) + " slot via Mana Conversion");
+			Engine::GetLogger().LogEvent("{} recovered 1 level-{} slot via Mana Conversion", caster->TypeName(), restore_level);
 		}
 	}
 	// 향후 다른 Special 패턴은 여기 추가
@@ -531,7 +530,7 @@ void SpellSystem::ApplySpellEffect(Character* caster, const SpellData& spell, Ma
 		{
 			grid->SetTileType(target_tile, GridSystem::TileType::Wall);
 			m_terrain_effects.push_back({ { target_tile }, 0, current_round, spell.effect_duration });
-			Engine::GetLogger().LogEvent("SpellSystem: Wall created at (" + std::to_string(target_tile.x) + "," + std::to_string(target_tile.y) + ")");
+			Engine::GetLogger().LogEvent("SpellSystem: Wall created at ({},{})", target_tile.x, target_tile.y);
 		}
 	}
 	else if (spell.summon_type == "Lava Zone")
@@ -565,7 +564,7 @@ bool SpellSystem::CastSpell(Character* caster, const std::string& spell_id, Math
 	auto it = spells_.find(spell_id);
 	if (it == spells_.end())
 	{
-		Engine::GetLogger().LogError("SpellSystem: Unknown spell id " + spell_id);
+		Engine::GetLogger().LogError("SpellSystem: Unknown spell id {}", spell_id);
 		return false;
 	}
 
@@ -580,8 +579,8 @@ bool SpellSystem::CastSpell(Character* caster, const std::string& spell_id, Math
 
 	// AP 소모 — 갓모드 Dragon은 AP 소모 없음
 	{
-		auto* debug_mgr = Engine::GetGameStateManager().GetGSComponent<DebugManager>();
-		if (!(debug_mgr && debug_mgr->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
+		auto* combat = Engine::GetGameStateManager().GetGSComponent<CombatSystem>();
+		if (!(combat && combat->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
 			caster->GetActionPointsComponent()->Consume(1);
 	}
 
@@ -616,7 +615,7 @@ bool SpellSystem::CastSpell(Character* caster, const std::string& spell_id, Math
 		gom->Add(std::unique_ptr<CS230::GameObject>(new SpellDelayObject(delayTime, callback)));
 	}
 
-	Engine::GetLogger().LogEvent(caster->TypeName() + " cast " + spell.spell_name + " [" + spell_id + "]");
+	Engine::GetLogger().LogEvent("{} cast {} [{}]", caster->TypeName(), spell.spell_name, spell_id);
 
 	// SpellCastEvent 발행 — UI 스펠 로그 표시용
 	auto& gs = Engine::GetGameStateManager();
@@ -647,6 +646,18 @@ std::vector<std::string> SpellSystem::GetAvailableSpells(Character* caster) cons
 	return available_spells;
 }
 
+std::vector<const SpellData*> SpellSystem::GetSpellsForClass(const std::string& class_name) const
+{
+	std::vector<const SpellData*> result;
+	for (const auto& pair : spells_)
+	{
+		const auto& classes = pair.second.usable_classes;
+		if (std::find(classes.begin(), classes.end(), class_name) != classes.end())
+			result.push_back(&pair.second);
+	}
+	return result;
+}
+
 bool SpellSystem::CanCast(Character* caster, const std::string& spell_id, Math::ivec2 target_tile, int upcast_level) const
 {
 	if (!caster)
@@ -871,8 +882,8 @@ bool SpellSystem::CastWalls(Character* caster, const std::string& spell_id, cons
 	if (consume_level > 0)
 		caster->ConsumeSpell(consume_level);
 	{
-		auto* debug_mgr = Engine::GetGameStateManager().GetGSComponent<DebugManager>();
-		if (!(debug_mgr && debug_mgr->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
+		auto* combat = Engine::GetGameStateManager().GetGSComponent<CombatSystem>();
+		if (!(combat && combat->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
 			caster->GetActionPointsComponent()->Consume(1);
 	}
 
@@ -887,7 +898,7 @@ bool SpellSystem::CastWalls(Character* caster, const std::string& spell_id, cons
 		}
 	}
 
-	Engine::GetLogger().LogEvent(caster->TypeName() + " cast Wall Creation: " + std::to_string(tiles.size()) + " wall(s)");
+	Engine::GetLogger().LogEvent("{} cast Wall Creation: {} wall(s)", caster->TypeName(), tiles.size());
 	return true;
 }
 
@@ -910,8 +921,8 @@ bool SpellSystem::CastLavaZones(Character* caster, const std::string& spell_id,
 	if (consume_level > 0)
 		caster->ConsumeSpell(consume_level);
 	{
-		auto* debug_mgr = Engine::GetGameStateManager().GetGSComponent<DebugManager>();
-		if (!(debug_mgr && debug_mgr->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
+		auto* combat = Engine::GetGameStateManager().GetGSComponent<CombatSystem>();
+		if (!(combat && combat->IsGodModeEnabled() && caster->GetCharacterType() == CharacterTypes::Dragon))
 			caster->GetActionPointsComponent()->Consume(1);
 	}
 
@@ -927,7 +938,7 @@ bool SpellSystem::CastLavaZones(Character* caster, const std::string& spell_id,
 		}
 	}
 
-	Engine::GetLogger().LogEvent(caster->TypeName() + " cast Magma Blast: " + std::to_string(tiles.size()) + " lava zone(s)");
+	Engine::GetLogger().LogEvent("{} cast Magma Blast: {} lava zone(s)", caster->TypeName(), tiles.size());
 	return true;
 }
 
@@ -997,7 +1008,7 @@ void SpellSystem::ApplyMoveEffect(Character* caster, const std::vector<Character
 		{
 			grid->MoveCharacter(caster_pos, dest);
 			caster->SetGridPosition(dest);
-			Engine::GetLogger().LogEvent(caster->TypeName() + " teleported to (" + std::to_string(dest.x) + ", " + std::to_string(dest.y) + ")");
+			Engine::GetLogger().LogEvent("{} teleported to ({}, {})", caster->TypeName(), dest.x, dest.y);
 		}
 	}
 }
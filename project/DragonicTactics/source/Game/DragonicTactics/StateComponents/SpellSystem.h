@@ -80,6 +80,9 @@ class SpellSystem : public CS230::Component
 
   const SpellData* GetSpellData(const std::string& spell_id) const;
 
+  /// @brief class_name (Character::TypeName) 이 쓸 수 있는 모든 스펠 — 슬롯/사거리/대상은 보지 않는다
+  std::vector<const SpellData*> GetSpellsForClass(const std::string& class_name) const;
+
   // 지형 효과 관리
   void TickTerrainEffects(int current_round);
   int  GetLavaDamageAt(Math::ivec2 tile) const;
@@ -88,6 +91,10 @@ class SpellSystem : public CS230::Component
   bool CastLavaZones(Character* caster, const std::string& spell_id,
                      const std::vector<Math::ivec2>& tiles, int upcast_level);
 
+  // BattleState 저장/복원용 — 타일 타입은 GridSystem 쪽에서 따로 되돌린다
+  const std::vector<TerrainEffect>& GetTerrainEffects() const { return m_terrain_effects; }
+  void SetTerrainEffects(std::vector<TerrainEffect> effects) { m_terrain_effects = std::move(effects); }
+
   private:
   std::map<std::string, SpellData> spells_;
   std::vector<TerrainEffect>       m_terrain_effects;
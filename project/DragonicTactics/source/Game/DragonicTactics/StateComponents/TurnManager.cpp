@@ -55,7 +55,7 @@ void TurnManager::InitializeTurnOrder(const std::vector<Character*>& characters)
   roundNumber	   = 1;
   combatActive	   = false;
 
-  Engine::GetLogger().LogEvent("TurnManager: Turn order initialized with " + std::to_string(turnOrder.size()) + " characters");
+  Engine::GetLogger().LogEvent("TurnManager: Turn order initialized with {} characters", turnOrder.size());
 }
 
 void TurnManager::StartCombat()
@@ -118,7 +118,7 @@ void TurnManager::StartNextTurn()
     
     // 안전하게 현재 캐릭터 가져오기
     Character* currentChar = turnOrder[static_cast<std::size_t>(currentTurnIndex)];
-    Engine::GetLogger().LogEvent("TurnManager: Turn " + std::to_string(turnNumber) + " - " + currentChar->TypeName() + "'s turn");
+    Engine::GetLogger().LogEvent("TurnManager: Turn {} - {}'s turn", turnNumber, currentChar->TypeName());
 
     // [수정 후 순서 적용 완료]
     // 1. AP/Speed 리프레시
@@ -147,7 +147,7 @@ void TurnManager::StartNextTurn()
                 int dmg = spell_system->GetLavaDamageAt(gp->Get());
                 if (dmg > 0)
                 {
-                    Engine::GetLogger().LogEvent(currentChar->TypeName() + " takes " + std::to_string(dmg) + " lava damage at turn start");
+                    Engine::GetLogger().LogEvent("{} takes {} lava damage at turn start", currentChar->TypeName(), dmg);
                     combat->ApplyDamage(nullptr, currentChar, dmg);
                 }
             }
@@ -186,7 +186,7 @@ void TurnManager::EndCurrentTurn()
   if (currentTurnIndex == 0)
   {
 	roundNumber++;
-	Engine::GetLogger().LogEvent("TurnManager: Round " + std::to_string(roundNumber) + " started");
+	Engine::GetLogger().LogEvent("TurnManager: Round {} started", roundNumber);
 
 	// 지형 효과 만료 처리
 	auto* spell_system = Engine::GetGameStateManager().GetGSComponent<SpellSystem>();
@@ -257,14 +257,27 @@ void TurnManager::RemoveFromTurnOrder(Character* character)
   else if (currentTurnIndex >= static_cast<int>(turnOrder.size()))
     currentTurnIndex = 0;
 
-  Engine::GetLogger().LogEvent("[TurnManager] Removed " + character->TypeName()
-      + " from turnOrder on death. Remaining: " + std::to_string(turnOrder.size()));
+  Engine::GetLogger().LogEvent("[TurnManager] Removed {} from turnOrder on death. Remaining: {}", character->TypeName(), turnOrder.size());
+}
+
+void TurnManager::RestoreTurnState(const std::vector<Character*>& order, int current_index, int turn_number, int round_number, bool combat_active)
+{
+  initiativeOrder.erase(
+	  std::remove_if(initiativeOrder.begin(), initiativeOrder.end(),
+		  [&order](const InitiativeEntry& e) { return std::find(order.begin(), order.end(), e.character) == order.end(); }),
+	  initiativeOrder.end());
+
+  turnOrder		   = order;
+  currentTurnIndex = current_index;
+  turnNumber	   = turn_number;
+  roundNumber	   = round_number;
+  combatActive	   = combat_active;
 }
 
 void TurnManager::EndCombat()
 {
   combatActive = false;
-  Engine::GetLogger().LogEvent("TurnManager: Combat ended after " + std::to_string(turnNumber) + " turns (" + std::to_string(roundNumber) + " rounds)");
+  Engine::GetLogger().LogEvent("TurnManager: Combat ended after {} turns ({} rounds)", turnNumber, roundNumber);
 
   // Publish combat end event
   if (eventBus)
@@ -424,7 +437,7 @@ void TurnManager::RollInitiative(const std::vector<Character*>& characters)
 	initiativeOrder.push_back(entry);
 
 	// Log result
-	Engine::GetLogger().LogEvent(character->TypeName() + " 's speed is " + std::to_string(speed));
+	Engine::GetLogger().LogEvent("{} 's speed is {}", character->TypeName(), speed);
 
 	// Publish individual initiative rolled event
 	InitiativeEvent event{ character, speed };
@@ -464,7 +477,7 @@ void TurnManager::RollInitiative(const std::vector<Character*>& characters)
   Engine::GetLogger().LogEvent("=== TURN ORDER ESTABLISHED ===");
   for (const auto& entry : initiativeOrder)
   {
-	Engine::GetLogger().LogEvent("  " + std::to_string(entry.speed) + ": " + entry.character->TypeName());
+	Engine::GetLogger().LogEvent("  {}: {}", entry.speed, entry.character->TypeName());
   }
 }
 
@@ -92,6 +92,9 @@ class TurnManager : public CS230::Component
   // 캐릭터 사망 즉시 turnOrder에서 제거 — CharacterDeathEvent 핸들러에서 호출
   void RemoveFromTurnOrder(Character* character);
 
+  // BattleState 복원용 — 이벤트 없이 턴 상태를 덮어쓴다. order 에 없는 캐릭터는 initiativeOrder 에서도 뺀다
+  void RestoreTurnState(const std::vector<Character*>& order, int current_index, int turn_number, int round_number, bool combat_active);
+
   private:
   TurnManager(const TurnManager&)			 = delete;
   TurnManager& operator=(const TurnManager&) = delete;
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include <cstdint>
+
+/// @brief 전투 상태 해시용 64비트 키
+///
+/// 고전 Zobrist 는 (칸, 값) 마다 난수 표를 두지만 여기서는 값 범위(HP, 캐릭터 포인터 등)가 열려 있으므로
+/// splitmix64 로 (종류, 위치, 값) 을 섞어 같은 성질의 키를 즉석에서 만든다.
+/// 상태 해시는 항목 키의 XOR 이므로 항목 하나가 바뀌면 (옛 키 ^ 새 키) 만 반영하면 된다.
+namespace Zobrist
+{
+  enum class Feature : std::uint64_t
+  {
+	Tile = 1, // (타일 인덱스, TileType) — Empty 는 0 으로 둔다
+	Occupant, // (타일 인덱스, 캐릭터)
+	Unit	  // (캐릭터, 상태 요약)
+  };
+
+  constexpr std::uint64_t Mix(std::uint64_t x)
+  {
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+  }
+
+  constexpr std::uint64_t Key(Feature feature, std::uint64_t where, std::uint64_t value)
+  {
+	return Mix(Mix(static_cast<std::uint64_t>(feature) ^ Mix(where)) ^ value);
+  }
+}
@@ -11,12 +11,11 @@ Created:    November 24, 2025
 #include "BattleOrchestrator.h"
 #include "./CS200/IRenderer2D.h"
 #include "./CS200/NDC.h"
-#include "Engine/Timer.h"
+#include "./Engine/Profiler.h"
 #include "GamePlay.h"
 #include "pch.h"
 
 
-#include "../Debugger/DebugManager.h"
 #include "../StateComponents/GridSystem.h"
 #include "../StateComponents/TurnManager.h"
 #include "Game/DragonicTactics/Objects/Actions/ActionAttack.h"
@@ -28,17 +27,39 @@ Created:    November 24, 2025
 #include "Game/DragonicTactics/StateComponents/CombatSystem.h"
 #include "Game/DragonicTactics/StateComponents/DiceManager.h"
 #include "Game/DragonicTactics/StateComponents/EventBus.h"
+#include "Game/DragonicTactics/Types/Events.h"
 #include "Game/MainMenu.h"
 
 #include "Game/DragonicTactics/Objects/Components/GridPosition.h"
 #include "Game/DragonicTactics/Objects/Dragon.h"
 #include "Game/DragonicTactics/Objects/Fighter.h"
+#include "Game/DragonicTactics/Simulation/BattleCommand.h"
 #include "Game/DragonicTactics/StateComponents/SpellSystem.h"
 
-void BattleOrchestrator::Update([[maybe_unused]] double dt, TurnManager* turn_manager, AISystem* ai_system)
+void BattleOrchestrator::Init(EventBus* event_bus)
 {
+  // 이 이벤트들이 오면 진행 중인 AI 계산의 스냅샷은 더 이상 현재 전투가 아니다 (예: 지연 주문이 적을 쓰러뜨림)
+  m_subscriptions.clear();
+  const auto invalidate = [this] { ++m_state_version; };
+  m_subscriptions.push_back(event_bus->Subscribe<CharacterDamagedEvent>([invalidate](const CharacterDamagedEvent&) { invalidate(); }));
+  m_subscriptions.push_back(event_bus->Subscribe<CharacterHealedEvent>([invalidate](const CharacterHealedEvent&) { invalidate(); }));
+  m_subscriptions.push_back(event_bus->Subscribe<CharacterDeathEvent>([invalidate](const CharacterDeathEvent&) { invalidate(); }));
+  m_subscriptions.push_back(event_bus->Subscribe<StatusEffectAddedEvent>([invalidate](const StatusEffectAddedEvent&) { invalidate(); }));
+  m_subscriptions.push_back(event_bus->Subscribe<StatusEffectRemovedEvent>([invalidate](const StatusEffectRemovedEvent&) { invalidate(); }));
+}
+
+void BattleOrchestrator::Update(double dt, TurnManager* turn_manager, AISystem* ai_system, bool fast_forward)
+{
+  PROFILE_SCOPE("BattleOrchestrator::Update");
   if (!turn_manager->IsCombatActive())
+  {
+	ai_system->CancelDecision();
 	return;
+  }
+
+  m_current_delay = fast_forward ? m_pacing.fast_forward_delay : m_pacing.step_delay;
+  // 빨리감기로 바뀌면 남은 대기도 새 간격을 넘지 않게 줄인다
+  m_ai_wait_remaining = std::min(m_ai_wait_remaining, m_current_delay);
 
   Character* current	   = turn_manager->GetCurrentCharacter();
   int		 current_round = turn_manager->GetRoundNumber();
@@ -49,8 +70,23 @@ void BattleOrchestrator::Update([[maybe_unused]] double dt, TurnManager* turn_ma
 
   if (current->GetCharacterType() != CharacterTypes::Dragon)
   {
-	HandleAITurn(current, turn_manager, ai_system);
+	HandleAITurn(dt, current, turn_manager, ai_system);
   }
+  else
+  {
+	m_ai_waiting_for = nullptr;
+	ai_system->CancelDecision();
+  }
+}
+
+void BattleOrchestrator::SetAIPacing(const AIPacing& pacing)
+{
+  m_pacing = pacing;
+}
+
+const AIPacing& BattleOrchestrator::GetAIPacing() const
+{
+  return m_pacing;
 }
 
 // bool BattleOrchestrator::ShouldContinueTurn(Character* current_character, AISystem* ai_system, CS230::GameObjectManager* go_manager) {
@@ -78,7 +114,7 @@ void BattleOrchestrator::Update([[maybe_unused]] double dt, TurnManager* turn_ma
 // }
 
 
-void BattleOrchestrator::HandleAITurn(Character* ai_character, TurnManager* turn_manager, AISystem* ai_system)
+void BattleOrchestrator::HandleAITurn(double dt, Character* ai_character, [[maybe_unused]] TurnManager* turn_manager, AISystem* ai_system)
 {
   // 1. 캐릭터가 이동 중이거나 애니메이션 중이라면 대기 (기존 유지)
   MovementComponent* move_comp = ai_character->GetGOComponent<MovementComponent>();
@@ -87,29 +123,50 @@ void BattleOrchestrator::HandleAITurn(Character* ai_character, TurnManager* turn
 	return;
   }
 
-  auto timer = Engine::GetGameStateManager().GetGSComponent<util::Timer>();
-  timer->ResetTimeStamp();
-  while (timer->GetElapsedSeconds() < 0.6)
+  // 2. AISystem에게 "지금 뭐 할래?"라고 물어봅니다. (전략 패턴 활용)
+  // 탐색 전략은 스냅샷을 워커 스레드에서 계산하므로, 연출 대기와 계산이 겹치고 프레임은 막히지 않습니다.
+  // 계산 도중 전투 상태가 바뀌었거나 (지연 주문의 피해, 사망 등) 다른 캐릭터의 결정이라면 버리고 다시 시작합니다.
+  if (ai_system->GetPendingActor() != ai_character || m_decision_version != m_state_version)
   {
+	if (ai_system->IsDecisionPending())
+	  Engine::GetLogger().LogDebug(ai_character->TypeName() + " AI decision restarted: battle state changed");
+	ai_system->BeginDecision(ai_character);
+	m_decision_version = m_state_version;
   }
 
-  // 2. AISystem에게 "지금 뭐 할래?"라고 물어봅니다. (전략 패턴 활용)
-  // 기존의 fighter->Action() 대신 시스템을 직접 이용합니다.
-  AIDecision decision = ai_system->MakeDecision(ai_character);
+  // 행동 사이 연출 대기 — 메인 스레드를 붙잡지 않고 프레임마다 dt 만큼 줄인다
+  if (m_ai_waiting_for != ai_character)
+  {
+	m_ai_waiting_for	= ai_character;
+	m_ai_wait_remaining = m_current_delay;
+  }
+  if (m_ai_wait_remaining > 0.0)
+  {
+	m_ai_wait_remaining -= dt;
+	if (m_ai_wait_remaining > 0.0)
+	  return;
+  }
+
+  AIDecision decision;
+  if (!ai_system->PollDecision(decision))
+	return; // 아직 계산 중 — 다음 프레임에 다시 확인
+  m_ai_wait_remaining = m_current_delay; // 다음 행동 전 대기
 
   // 3. 결정에 따른 분기 처리
   if (decision.type == AIDecisionType::EndTurn)
   {
 	// AI가 "턴 종료"를 선언했으면 턴을 넘깁니다.
 	Engine::GetLogger().LogEvent(ai_character->TypeName() + " ends turn. Reason: " + decision.reasoning);
-	turn_manager->EndCurrentTurn();
+	BattleCommand::FromDecision(decision).Execute(ai_character);
+	m_ai_waiting_for = nullptr;
   }
   else
   {
 	// 이동, 공격, 스킬 등의 행동을 실행합니다.
 	// 실행 후에는 함수를 빠져나가고, 다음 Update 프레임에 다시 들어와서
-	// AI가 또 다른 행동(예: 이동 후 공격)을 할지 다시 MakeDecision을 통해 확인하게 됩니다.
-	ai_system->ExecuteDecision(ai_character, decision);
+	// AI가 또 다른 행동(예: 이동 후 공격)을 할지 새 스냅샷으로 다시 결정을 요청합니다.
+	// BattleCommand 를 거쳐 실행해야 BattleRecorder 가 저널에 남긴다
+	BattleCommand::FromDecision(decision).Execute(ai_character);
   }
 }
 
@@ -9,6 +9,9 @@ Created:    November 24, 2025
 */
 
 #pragma once
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
+#include <cstdint>
+#include <vector>
 class TurnManager;
 class Character;
 class AISystem;
@@ -18,13 +21,35 @@ namespace CS230
   class GameObjectManager;
 }
 
+/// AI 행동 사이 연출용 대기 (초). 프레임을 막지 않고 Update 의 dt 로 줄어든다
+struct AIPacing
+{
+  double step_delay			= 0.6; // 일반 진행
+  double fast_forward_delay = 0.0; // 빨리감기 중 (0 = 대기 없음)
+};
+
 class BattleOrchestrator
 {
   public:
-  void Update(double dt, TurnManager* turn_manager, AISystem* ai_system);
+  /// AI 가 계산 중인 스냅샷을 무효로 만드는 이벤트(피해/회복/사망/상태 효과)를 구독한다
+  void Init(EventBus* event_bus);
+  void Update(double dt, TurnManager* turn_manager, AISystem* ai_system, bool fast_forward = false);
   bool CheckVictoryCondition();
 
+  void			SetAIPacing(const AIPacing& pacing);
+  const AIPacing& GetAIPacing() const;
+
   private:
-  void HandleAITurn(Character* ai_character, TurnManager* turn_manager, AISystem* ai_system);
+  void HandleAITurn(double dt, Character* ai_character, TurnManager* turn_manager, AISystem* ai_system);
   int  m_previous_round = 0;
+
+  AIPacing	 m_pacing;
+  double	 m_current_delay	 = 0.0;		// 이번 프레임에 적용되는 대기 (일반/빨리감기 중 하나)
+  Character* m_ai_waiting_for	 = nullptr; // 대기 중인 AI 캐릭터 — 턴이 바뀌면 대기를 새로 건다
+  double	 m_ai_wait_remaining = 0.0;
+
+  // AISystem 이 워커에서 계산 중인 결정이 어느 전투 상태에서 시작됐는지
+  std::uint64_t m_state_version	   = 0; // 전투 상태를 바꾸는 이벤트마다 증가
+  std::uint64_t m_decision_version = 0;
+  std::vector<EventBus::Subscription> m_subscriptions;
 };
@@ -13,18 +13,27 @@
 
 #include "../StateComponents/DataRegistry.h"
 #include "Game/DragonicTactics/Factories/CharacterFactory.h"
+#include "Game/DragonicTactics/StateComponents/BattleHash.h"
+#include "Game/DragonicTactics/StateComponents/CombatSystem.h"
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
 #include "Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "Game/DragonicTactics/StateComponents/MapDataRegistry.h"
+#include "Game/DragonicTactics/StateComponents/SpellSystem.h"
+#include "Game/DragonicTactics/StateComponents/TurnManager.h"
 #include "Game/DragonicTactics/Test/TestAI.h"
 #include "Game/DragonicTactics/Test/TestAStar.h"
+#include "Game/DragonicTactics/Test/TestBattleState.h"
 #include "Game/DragonicTactics/Test/TestCombatSystem.h"
 #include "Game/DragonicTactics/Test/TestDataRegistry.h"
 #include "Game/DragonicTactics/Test/TestDiceManager.h"
 #include "Game/DragonicTactics/Test/TestEventBus.h"
 #include "Game/DragonicTactics/Test/TestMemory.h"
 #include "Game/DragonicTactics/Test/TestNew.h"
+#include "Game/DragonicTactics/Test/TestPathfindingBenchmark.h"
 #include "Game/DragonicTactics/Test/TestTurnInit.h"
 #include "Game/DragonicTactics/Test/TestTurnManager.h"
 #include "Game/MainMenu.h"
+#include <imgui.h>
 
 
 bool TestAStar		  = false;
@@ -37,6 +46,10 @@ bool TestTrunManager  = false;
 bool TestAI			  = false;
 bool TestNewFile	  = false;
 bool TestMemory		  = false;
+bool TestPathfindingBench = false;
+bool TestBattleSnapshot	  = false;
+bool TestFrameAllocations = false;
+int	 BattleFrameAllocationBudget = 6; // 측정한 최악 프레임 4 (호버 경로 1 + AI 경로 3) + 여유 2 — FindPath 호출마다 1 개씩 늘면 넘는다
 
 ConsoleTest::ConsoleTest()
 {
@@ -67,6 +80,13 @@ void ConsoleTest::Update([[maybe_unused]] double dt)
 	TestPathfindingInvalidStart();
 	TestPathfindingInvalidGoal();
 	TestPathfindingUnwalkableGoal();
+	TestPathfindingToNearestGoal();
+	TestDistanceFieldCache();
+	TestReachableTiles();
+	TestMovementModePath();
+	TestPathfindingMatchesReference();
+	TestHierarchicalPathfinding();
+	TestJumpPointMatchesAStar();
 
 	RemoveGSComponent<GridSystem>();
 
@@ -80,6 +100,9 @@ void ConsoleTest::Update([[maybe_unused]] double dt)
 	test_multiple_different_events();
 	test_EventData_CompleteTransfer();
 	test_EventData_MultiplePublishes();
+	test_subscription_handle_unsubscribes();
+	test_subscribe_unsubscribe_during_publish();
+	test_batched_subscriber_receives_frame_batch();
 
 	TestEventBus = false;
   }
@@ -198,13 +221,75 @@ void ConsoleTest::Update([[maybe_unused]] double dt)
 	AddGSComponent(new CS230::GameObjectManager());
 	AddGSComponent(new CharacterFactory());
 	AddGSComponent(new DataRegistry());
+	AddGSComponent(new EventBus());
+	AddGSComponent(new GridSystem());
+	AddGSComponent(new SpellSystem());
+	AddGSComponent(new CombatSystem());
+	GetGSComponent<DataRegistry>()->LoadFromFile("Assets/Data/characters.json");
+	GetGSComponent<DataRegistry>()->LoadAllCharacterData("Assets/Data/characters.json");
 	TestOwnershipTransfer();
 	TestUnloadNoLeak();
+	TestLavaDeathEventsOutliveDestroy();
+	RemoveGSComponent<CombatSystem>();
+	RemoveGSComponent<SpellSystem>();
+	RemoveGSComponent<GridSystem>();
+	RemoveGSComponent<EventBus>();
 	RemoveGSComponent<CS230::GameObjectManager>();
 	RemoveGSComponent<CharacterFactory>();
 	RemoveGSComponent<DataRegistry>();
 	TestMemory = false;
   }
+
+  if (TestPathfindingBench)
+  {
+	AddGSComponent(new GridSystem());
+	BenchmarkPathfindingJsonMaps();
+	BenchmarkPathfindingProcedural256();
+	BenchmarkGridQueries();
+	BenchmarkReachability();
+	BenchmarkHoverPath();
+	BenchmarkHierarchicalPathfinding();
+	BenchmarkJumpPointSearch();
+	RemoveGSComponent<GridSystem>();
+	TestPathfindingBench = false;
+  }
+
+  if (TestBattleSnapshot)
+  {
+	AddGSComponent(new GridSystem());
+	AddGSComponent(new BattleHash());
+	TestBattleStateRoundTrip();
+	TestBattleStateCopyIsIndependent();
+	TestBattleHashIsIncremental();
+	TestDecisionCacheHitsOnSameState();
+	TestBattleJournalRoundTrip();
+	TestBattleChecksumIgnoresPointers();
+	RemoveGSComponent<BattleHash>();
+	RemoveGSComponent<GridSystem>();
+	TestBattleSnapshot = false;
+  }
+
+  if (TestFrameAllocations)
+  {
+	AddGSComponent(new CS230::GameObjectManager());
+	AddGSComponent(new EventBus());
+	AddGSComponent(new GridSystem());
+	AddGSComponent(new TurnManager());
+	AddGSComponent(new CharacterFactory());
+	AddGSComponent(new DataRegistry());
+	AddGSComponent(new MapDataRegistry());
+	GetGSComponent<DataRegistry>()->LoadFromFile("Assets/Data/characters.json");
+	GetGSComponent<DataRegistry>()->LoadAllCharacterData("Assets/Data/characters.json");
+	TestBattleFrameAllocationBudget();
+	RemoveGSComponent<MapDataRegistry>();
+	RemoveGSComponent<DataRegistry>();
+	RemoveGSComponent<CharacterFactory>();
+	RemoveGSComponent<TurnManager>();
+	RemoveGSComponent<GridSystem>();
+	RemoveGSComponent<EventBus>();
+	RemoveGSComponent<CS230::GameObjectManager>();
+	TestFrameAllocations = false;
+  }
 }
 
 void ConsoleTest::Draw()
@@ -265,6 +350,21 @@ void ConsoleTest::DrawImGui()
   {
 	TestMemory = true;
   }
+  if (ImGui::Button("TestPathfindingBench"))
+  {
+	TestPathfindingBench = true;
+  }
+  if (ImGui::Button("TestBattleSnapshot"))
+  {
+	TestBattleSnapshot = true;
+  }
+  if (ImGui::Button("TestFrameAllocations"))
+  {
+	TestFrameAllocations = true;
+  }
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(100);
+  ImGui::InputInt("budget", &BattleFrameAllocationBudget);
 
   ImGui::End();
 #endif
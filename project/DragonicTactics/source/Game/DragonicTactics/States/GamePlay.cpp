@@ -26,8 +26,12 @@ Created:    November 5, 2025
 #include "Engine/Camera.h"
 #include "Engine/SoundManager.h"
 #include "Game/DragonicTactics/Factories/CharacterFactory.h"
+#include "Game/DragonicTactics/Objects/Components/MovementComponent.h"
 #include "Game/DragonicTactics/Objects/Components/SpellSlots.h"
+#include "Game/DragonicTactics/Simulation/BattleJournal.h"
+#include "Game/DragonicTactics/Simulation/BattleRecorder.h"
 #include "Game/DragonicTactics/StateComponents/AISystem.h"
+#include "Game/DragonicTactics/StateComponents/BattleHash.h"
 #include "Game/DragonicTactics/StateComponents/CombatSystem.h"
 #include "Game/DragonicTactics/StateComponents/DataRegistry.h"
 #include "Game/DragonicTactics/StateComponents/DiceManager.h"
@@ -43,15 +47,20 @@ Created:    November 5, 2025
 #include "BattleOrchestrator.h"
 #include "GamePlayUIManager.h"
 #include "PlayerInputHandler.h"
+#include <SDL.h>
+#include <imgui.h>
 
 #include "Game/Particles.h"
 #include "./Engine/Particle.h"
 
 int  GamePlay::s_next_map_index = 0;
 bool GamePlay::s_should_restart = false;
+std::string GamePlay::s_replay_path;
 
 namespace
 {
+  constexpr int DICE_SEED = 100;
+
   const char* SfxActionFor(CharacterTypes t)
   {
     switch (t)
@@ -73,6 +82,25 @@ namespace
       default:                      return nullptr;
     }
   }
+
+  // 한 묶음 안에서 같은 효과음은 한 번만 재생 (광역 주문에 맞은 수만큼 겹쳐 울리지 않게)
+  class SfxOnce
+  {
+  public:
+    void Play(const char* sfx)
+    {
+      if (sfx == nullptr || std::find(played_, played_ + count_, sfx) != played_ + count_)
+        return;
+      if (count_ < MAX_SOUNDS)
+        played_[count_++] = sfx;
+      Engine::GetSoundManager().PlaySFX(sfx);
+    }
+
+  private:
+    static constexpr int MAX_SOUNDS = 8;
+    const char*          played_[MAX_SOUNDS] = {};
+    int                  count_              = 0;
+  };
 }
 
 // Computes scale and letterbox offsets from actual window to virtual resolution
@@ -146,11 +174,14 @@ void GamePlay::Load()
   m_input_handler = std::make_unique<PlayerInputHandler>();
   m_ui_manager	  = std::make_unique<GamePlayUIManager>();
   m_orchestrator  = std::make_unique<BattleOrchestrator>();
+  if (Engine::IsHeadless())
+	m_orchestrator->SetAIPacing({ 0.0, 0.0 }); // 화면이 없으면 연출 대기도 필요 없다
   m_ui_manager->InitButtons(m_input_handler.get());
 
   AddGSComponent(new EventBus());
   AddGSComponent(new DiceManager());
   AddGSComponent(new AISystem());
+  AddGSComponent(new BattleHash());
   AddGSComponent(new CombatSystem());
   AddGSComponent(new CS230::GameObjectManager());
   AddGSComponent(new GridSystem());
@@ -162,12 +193,13 @@ void GamePlay::Load()
   AddGSComponent(new MapDataRegistry());
   AddGSComponent(new SpellSystem());
   AddGSComponent(new StatusEffectHandler());
+  AddGSComponent(new BattleRecorder());
 //   AddGSComponent(new CS230::Camera());
   AddGSComponent(new CS230::ParticleManager<Particles::Hit>());
 
 
   GetGSComponent<EventBus>()->Clear();
-  GetGSComponent<DiceManager>()->SetSeed(100);
+  GetGSComponent<DiceManager>()->SetSeed(DICE_SEED);
   GetGSComponent<DebugManager>()->Init();
   GetGSComponent<CombatSystem>()->SetDiceManager(GetGSComponent<DiceManager>());
   GetGSComponent<DataRegistry>()->LoadFromFile("Assets/Data/characters.json");
@@ -198,9 +230,41 @@ void GamePlay::Load()
 	s_next_map_index		 = 0;
   }
 
-  const std::string& selected_map_id = available_json_maps_[static_cast<std::size_t>(selected_json_map_index_)];
-  Engine::GetLogger().LogEvent("Loading map: " + selected_map_id);
-  LoadJSONMap(selected_map_id);
+  // 리플레이 요청: 맵과 주사위 설정은 maps.json 이 아니라 저널 헤더에서 가져온다
+  if (!s_replay_path.empty())
+  {
+	auto		journal = std::make_unique<JournalData>();
+	std::string error;
+	if (BattleJournal::Load(s_replay_path, *journal, error))
+	{
+	  m_replay = std::move(journal);
+	  Engine::GetLogger().LogEvent("Replaying " + s_replay_path + ": " + std::to_string(m_replay->commands.size()) + " commands");
+	}
+	else
+	{
+	  Engine::GetLogger().LogError("Cannot replay " + s_replay_path + ": " + error);
+	}
+	s_replay_path.clear();
+  }
+
+  MapData map_data;
+  if (m_replay)
+  {
+	map_data = m_replay->header.map;
+	if (m_replay->header.counter_dice)
+	  GetGSComponent<DiceManager>()->SetCounterStream(static_cast<std::uint64_t>(m_replay->header.dice_seed), m_replay->header.dice_stream);
+	else
+	  GetGSComponent<DiceManager>()->SetSeed(m_replay->header.dice_seed);
+  }
+  else
+  {
+	const std::string& selected_map_id = available_json_maps_[static_cast<std::size_t>(selected_json_map_index_)];
+	map_data						   = map_registry->GetMapData(selected_map_id);
+	if (map_data.id.empty())
+	  Engine::GetLogger().LogError("Failed to load map: " + selected_map_id);
+  }
+  Engine::GetLogger().LogEvent("Loading map: " + map_data.id);
+  LoadJSONMap(map_data);
 
   if (player == nullptr || enemys.empty())
   {
@@ -231,61 +295,67 @@ void GamePlay::Load()
   Engine::GetLogger().LogEvent("GamePlay::Load - Characters registered to UI Manager");
 
   // EventBus 구독을 StartCombat() 전에 등록 — 첫 TurnStartedEvent를 놓치지 않기 위함
-  GetGSComponent<EventBus>()->Subscribe<TurnStartedEvent>(
-	  [this](const TurnStartedEvent& e)
-	  {
-		if (e.character)
-		  m_ui_manager->OnTurnStarted(e.character->TypeName(), e.turnNumber);
-	  });
-
-  GetGSComponent<EventBus>()->Subscribe<CharacterDamagedEvent>(
-	  [this](const CharacterDamagedEvent& event)
+  // 전투 규칙에 필요한 것(사망 처리)만 즉시 받고, 로그/데미지 텍스트/효과음은 Update 시작의 DispatchDeferred() 에서 묶어서 받는다
+  EventBus* eventBus = GetGSComponent<EventBus>();
+  m_subscriptions.push_back(eventBus->SubscribeBatched<TurnStartedEvent>(
+	  [this](const EventBatch<TurnStartedEvent>& batch)
 	  {
-		this->DisplayDamageAmount(event);
-		std::string att = event.attacker ? event.attacker->TypeName() : "Lava";
-		m_ui_manager->AddBattleLogEntry(
-		  att + "->" + event.target->TypeName()
-		  + " " + std::to_string(event.damageAmount) + "dmg"
-		  + " (HP:" + std::to_string(event.remainingHP) + ")");
-
-		if (event.target)
+		for (const TurnStartedEvent& e : batch)
 		{
-		  if (const char* sfx = SfxHurtFor(event.target->GetCharacterType()))
-			Engine::GetSoundManager().PlaySFX(sfx);
+		  if (e.character)
+			m_ui_manager->OnTurnStarted(e.character->TypeName(), e.turnNumber);
 		}
-	  });
+	  }));
 
-  GetGSComponent<EventBus>()->Subscribe<CharacterAttackedEvent>(
-	  []([[maybe_unused]] const CharacterAttackedEvent& event)
+  m_subscriptions.push_back(eventBus->SubscribeBatched<CharacterDamagedEvent>(
+	  [this](const EventBatch<CharacterDamagedEvent>& batch)
 	  {
-		if (event.attacker)
+		SfxOnce sfx;
+		for (const CharacterDamagedEvent& event : batch)
 		{
-		  if (const char* sfx = SfxActionFor(event.attacker->GetCharacterType()))
-			Engine::GetSoundManager().PlaySFX(sfx);
+		  this->DisplayDamageAmount(event);
+		  std::string att = event.attacker ? event.attacker->TypeName() : "Lava";
+		  m_ui_manager->AddBattleLogEntry(
+			att + "->" + event.target->TypeName()
+			+ " " + std::to_string(event.damageAmount) + "dmg"
+			+ " (HP:" + std::to_string(event.remainingHP) + ")");
+
+		  if (event.target)
+			sfx.Play(SfxHurtFor(event.target->GetCharacterType()));
 		}
-		// 미스 시 hurt 보조 — 적중 시는 CharacterDamagedEvent가 처리하므로 중복 방지
-		if (event.damageAmount == 0 && event.defender)
+	  }));
+
+  m_subscriptions.push_back(eventBus->SubscribeBatched<CharacterAttackedEvent>(
+	  [](const EventBatch<CharacterAttackedEvent>& batch)
+	  {
+		SfxOnce sfx;
+		for (const CharacterAttackedEvent& event : batch)
 		{
-		  if (const char* sfx = SfxHurtFor(event.defender->GetCharacterType()))
-			Engine::GetSoundManager().PlaySFX(sfx);
+		  if (event.attacker)
+			sfx.Play(SfxActionFor(event.attacker->GetCharacterType()));
+		  // 미스 시 hurt 보조 — 적중 시는 CharacterDamagedEvent가 처리하므로 중복 방지
+		  if (event.damageAmount == 0 && event.defender)
+			sfx.Play(SfxHurtFor(event.defender->GetCharacterType()));
 		}
-	  });
+	  }));
 
-  GetGSComponent<EventBus>()->Subscribe<SpellCastEvent>(
-	  [this](const SpellCastEvent& event)
+  m_subscriptions.push_back(eventBus->SubscribeBatched<SpellCastEvent>(
+	  [this](const EventBatch<SpellCastEvent>& batch)
 	  {
-		if (event.caster)
+		SfxOnce sfx;
+		for (const SpellCastEvent& event : batch)
 		{
-		  m_ui_manager->AddBattleLogEntry(
-			event.caster->TypeName() + " cast " + event.spellName
-			+ " Lv." + std::to_string(event.spellLevel));
-
-		  if (const char* sfx = SfxActionFor(event.caster->GetCharacterType()))
-			Engine::GetSoundManager().PlaySFX(sfx);
+		  if (event.caster)
+		  {
+			m_ui_manager->AddBattleLogEntry(
+			  event.caster->TypeName() + " cast " + event.spellName
+			  + " Lv." + std::to_string(event.spellLevel));
+			sfx.Play(SfxActionFor(event.caster->GetCharacterType()));
+		  }
 		}
-	  });
+	  }));
 
-  GetGSComponent<EventBus>()->Subscribe<CharacterDeathEvent>(
+  m_subscriptions.push_back(eventBus->Subscribe<CharacterDeathEvent>(
 	  [this](const CharacterDeathEvent& event)
 	  {
 		// goMgr->UpdateAll()이 메모리를 해제하기 전에 즉시 처리
@@ -297,29 +367,58 @@ void GamePlay::Load()
 		  turnMgr->RemoveFromTurnOrder(event.character);
 
 		this->CheckGameEnd(event);
-		if (event.character)
-		  m_ui_manager->AddBattleLogEntry(event.character->TypeName() + " died!");
-	  });
+	  }));
 
-  GetGSComponent<EventBus>()->Subscribe<CharacterHealedEvent>(
-	  [this](const CharacterHealedEvent& e)
+  // 사망 로그는 그 사망을 만든 피해 로그 뒤에 나오도록 묶음 쪽에서 남긴다
+  m_subscriptions.push_back(eventBus->SubscribeBatched<CharacterDeathEvent>(
+	  [this](const EventBatch<CharacterDeathEvent>& batch)
 	  {
-		std::string src  = e.healer ? e.healer->TypeName() + "->" : "";
-		std::string line = src + e.target->TypeName()
-		                 + " +" + std::to_string(e.healAmount) + "HP"
-		                 + " (" + std::to_string(e.currentHP) + "/"
-		                 + std::to_string(e.maxHP) + ")";
-		m_ui_manager->AddBattleLogEntry(line);
-	  });
+		for (const CharacterDeathEvent& event : batch)
+		{
+		  if (event.character)
+			m_ui_manager->AddBattleLogEntry(event.character->TypeName() + " died!");
+		}
+	  }));
+
+  m_subscriptions.push_back(eventBus->SubscribeBatched<CharacterHealedEvent>(
+	  [this](const EventBatch<CharacterHealedEvent>& batch)
+	  {
+		for (const CharacterHealedEvent& e : batch)
+		{
+		  std::string src  = e.healer ? e.healer->TypeName() + "->" : "";
+		  std::string line = src + e.target->TypeName()
+		                   + " +" + std::to_string(e.healAmount) + "HP"
+		                   + " (" + std::to_string(e.currentHP) + "/"
+		                   + std::to_string(e.maxHP) + ")";
+		  m_ui_manager->AddBattleLogEntry(line);
+		}
+	  }));
+
+  m_orchestrator->Init(GetGSComponent<EventBus>());
+  GetGSComponent<BattleHash>()->Subscribe(GetGSComponent<EventBus>());
 
   TurnManager* turnMgr = GetGSComponent<TurnManager>();
   turnMgr->SetEventBus(GetGSComponent<EventBus>());
   std::vector<Character*> turn_order = { player };
   turn_order.insert(turn_order.end(), enemys.begin(), enemys.end());
   turnMgr->InitializeTurnOrder(turn_order);
+
+  // 전투 저널: 리플레이 중이면 턴마다 체크섬을 대조하고, 아니면 마지막 전투를 기록한다
+  // (헤드리스 실행은 테스트/도구이므로 플레이어의 마지막 저널을 덮어쓰지 않는다)
+  BattleRecorder* recorder = GetGSComponent<BattleRecorder>();
+  recorder->SetRoster(turn_order);
+  if (m_replay)
+	recorder->StartVerifying(*m_replay, eventBus);
+  else if (!Engine::IsHeadless())
+  {
+	JournalHeader header;
+	header.dice_seed = DICE_SEED;
+	header.map		 = map_data;
+	recorder->StartRecording(BattleRecorder::DEFAULT_PATH, header, eventBus);
+  }
   turnMgr->StartCombat();
 
-  GetGSComponent<EventBus>()->Subscribe<CharacterEscapedEvent>(
+  m_subscriptions.push_back(GetGSComponent<EventBus>()->Subscribe<CharacterEscapedEvent>(
 	  [this]([[maybe_unused]] const CharacterEscapedEvent& event)
 	  {
 		this->game_end	= true;
@@ -327,7 +426,7 @@ void GamePlay::Load()
 		msg += event.character->TypeName();
 		msg += " has escaped.";
 		Engine::GetLogger().LogDebug(msg);
-	  });
+	  }));
 
   Engine::GetSoundManager().LoadSFX("Assets/Audio/SFX/SFX_test.wav");
 
@@ -451,6 +550,11 @@ void GamePlay::Update(double dt)
 
     double scaledDt = dt * debugMgr->timeScale;
 
+    // 0. 지난 프레임에 쌓인 표시용 이벤트(로그, 데미지 텍스트, 효과음)를 묶어서 전달합니다.
+    //    지난 프레임에 죽은 캐릭터(이동 중 용암 사망처럼 UpdateAll 안에서 죽은 것 포함)는 아래 UpdateAll 이 시작할 때 해제되므로
+    //    반드시 그 전에 전달해야 이벤트의 포인터가 유효합니다.
+    GetGSComponent<EventBus>()->DispatchDeferred();
+
     // 1. 게임이 끝나더라도 메모리 해제(Destroy 처리)와 파티클, UI 갱신을 위해 기본 시스템 업데이트는 계속 실행합니다.
     if (goMgr) goMgr->UpdateAll(scaledDt);
     if (m_ui_manager) m_ui_manager->Update(dt);
@@ -466,11 +570,52 @@ void GamePlay::Update(double dt)
         current = turnMgr->GetCurrentCharacter();
     }
 
+    if (m_replay)
+    {
+        UpdateReplay(scaledDt, current, debugMgr->timeScale > 1.0f);
+        return;
+    }
+
     if (current != nullptr)
     {
         m_input_handler->Update(scaledDt, current, grid, combatSystem, m_ui_manager->GetButtons(), &m_camera);
     }
-    m_orchestrator->Update(scaledDt, turnMgr, aiSystem);
+    m_orchestrator->Update(scaledDt, turnMgr, aiSystem, debugMgr->timeScale > 1.0f);
+}
+
+void GamePlay::UpdateReplay(double dt, Character* current, bool fast_forward)
+{
+    if (current == nullptr || m_replay_cursor >= m_replay->commands.size())
+        return;
+
+    // 기록 때처럼 이동이 끝나고 연출 간격(지연 주문 효과보다 길다)이 지난 뒤 다음 명령을 실행한다
+    MovementComponent* movement = current->GetGOComponent<MovementComponent>();
+    if (movement != nullptr && movement->IsMoving())
+        return;
+    m_replay_wait -= dt;
+    if (m_replay_wait > 0.0)
+        return;
+    const AIPacing& pacing = m_orchestrator->GetAIPacing();
+    m_replay_wait          = fast_forward ? pacing.fast_forward_delay : pacing.step_delay;
+
+    BattleRecorder*             recorder = GetGSComponent<BattleRecorder>();
+    const JournalCommandRecord& record   = m_replay->commands[m_replay_cursor];
+    if (record.actor != recorder->UnitIndex(current))
+    {
+        Engine::GetLogger().LogError("Replay diverged at command #" + std::to_string(m_replay_cursor) + ": journal unit " + std::to_string(record.actor)
+                                     + ", current unit " + std::to_string(recorder->UnitIndex(current)));
+        m_replay_cursor = m_replay->commands.size();
+        return;
+    }
+    ++m_replay_cursor;
+    record.command.Execute(current);
+
+    if (m_replay_cursor == m_replay->commands.size())
+    {
+        const BattleRecorder::Verification& verification = recorder->GetVerification();
+        Engine::GetLogger().LogEvent("Replay finished: " + std::to_string(verification.checked) + " checksums verified, "
+                                     + std::to_string(verification.mismatches) + " mismatched");
+    }
 }
 
 void GamePlay::Unload()
@@ -482,12 +627,17 @@ void GamePlay::Unload()
 	goMgr->Unload();
   }
 
+  m_subscriptions.clear();
+  if (auto recorder = GetGSComponent<BattleRecorder>())
+	recorder->Stop(game_end);
   ClearGSComponents();
 
   m_input_handler.reset();
   m_ui_manager.reset();
   m_orchestrator.reset();
-
+  m_replay.reset();
+  m_replay_cursor = 0;
+  m_replay_wait   = 0.0;
 
   enemys.clear();
   m_confirmed_dead_.clear();
@@ -570,6 +720,31 @@ void GamePlay::DrawImGui()
 	s_should_restart = true;
   }
 
+  ImGui::Separator();
+  ImGui::Text("Battle Journal:");
+  if (BattleRecorder* recorder = GetGSComponent<BattleRecorder>())
+  {
+	if (m_replay)
+	{
+	  const BattleRecorder::Verification& verification = recorder->GetVerification();
+	  ImGui::Text("Replaying %zu / %zu commands", m_replay_cursor, m_replay->commands.size());
+	  ImGui::Text("Checksums: %d verified, %d mismatched", verification.checked, verification.mismatches);
+	  if (verification.first_mismatch_turn >= 0)
+		ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Desync at turn %d", verification.first_mismatch_turn);
+	}
+	else if (recorder->IsRecording())
+	{
+	  ImGui::Text("Recording %s (%zu bytes)", BattleRecorder::DEFAULT_PATH, recorder->GetBytesWritten());
+	}
+  }
+  if (ImGui::Button("Replay Last Battle"))
+  {
+	// 재시작하면 지금 전투가 기록을 덮어쓰기 전에 (Unload 에서 닫힌 뒤) 저널을 읽는다
+	Engine::GetLogger().LogEvent("Replay requested - will execute on next frame");
+	s_replay_path	 = BattleRecorder::DEFAULT_PATH;
+	s_should_restart = true;
+  }
+
   ImGui::End();
 
   TurnManager* turnMgr = GetGSComponent<TurnManager>();
@@ -592,22 +767,16 @@ gsl::czstring GamePlay::GetName() const
   return "GamePlay";
 }
 
-void GamePlay::LoadJSONMap(const std::string& map_id)
+void GamePlay::LoadJSONMap(const MapData& map_data)
 {
-  Engine::GetLogger().LogEvent("LoadJSONMap - BEGIN: " + map_id);
+  Engine::GetLogger().LogEvent("LoadJSONMap - BEGIN: " + map_data.id);
 
   CS230::GameObjectManager* go_manager		  = GetGSComponent<CS230::GameObjectManager>();
   GridSystem*				grid_system		  = GetGSComponent<GridSystem>();
   CharacterFactory*			character_factory = GetGSComponent<CharacterFactory>();
-  MapDataRegistry*			map_registry	  = GetGSComponent<MapDataRegistry>();
-
-  MapData map_data = map_registry->GetMapData(map_id);
 
   if (map_data.id.empty())
-  {
-	Engine::GetLogger().LogError("Failed to load map: " + map_id);
 	return;
-  }
 
   grid_system->LoadMap(map_data);
 
@@ -640,7 +809,7 @@ void GamePlay::LoadJSONMap(const std::string& map_id)
   }
   else
   {
-	Engine::GetLogger().LogError("No dragon spawn point in map: " + map_id);
+	Engine::GetLogger().LogError("No dragon spawn point in map: " + map_data.id);
   }
 
   // Fighter
@@ -658,7 +827,7 @@ void GamePlay::LoadJSONMap(const std::string& map_id)
   }
   else
   {
-	Engine::GetLogger().LogError("No fighter spawn point in map: " + map_id);
+	Engine::GetLogger().LogError("No fighter spawn point in map: " + map_data.id);
   }
 
   // Cleric
@@ -11,6 +11,7 @@ Created:    November 5, 2025
 #include "Engine/GameState.h"
 #include "Engine/Matrix.h"
 #include "Engine/Vec2.h"
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
 #include <memory>
 #include <set>
 
@@ -37,6 +38,8 @@ class ButtonManager;
 class Fighter;
 class Dragon;
 struct CharacterDamagedEvent;
+struct JournalData;
+struct MapData;
 
 class GamePlay : public CS230::GameState
 {
@@ -53,15 +56,18 @@ class GamePlay : public CS230::GameState
 
   static int s_next_map_index;
   static bool s_should_restart;
+  static std::string s_replay_path; // 비어 있지 않으면 다음 Load 에서 이 저널을 실제 속도로 리플레이
 
   private:
   static constexpr Math::ivec2				  default_window_size = { TacticalCamera::VIRTUAL_W, TacticalCamera::VIRTUAL_H };
   std::unique_ptr<PlayerInputHandler> m_input_handler;
   std::unique_ptr<GamePlayUIManager>  m_ui_manager;
   std::unique_ptr<BattleOrchestrator> m_orchestrator;
+  std::vector<EventBus::Subscription> m_subscriptions; // Load 에서 건 EventBus 구독 — Unload 에서 해지
 
   void DisplayDamageAmount(const CharacterDamagedEvent& event);
 	void CheckGameEnd(const CharacterDeathEvent& event);
+  void UpdateReplay(double dt, Character* current, bool fast_forward);
 
 
   Character* player  = nullptr;
@@ -78,7 +84,12 @@ class GamePlay : public CS230::GameState
   Math::vec2     m_prev_mouse            = { 0.0, 0.0 };
   bool           m_right_mouse_was_down  = false;
 
-  void LoadJSONMap(const std::string& map_id);
+  // 저널 리플레이 (입력/AI 대신 저널의 명령을 순서대로 실행)
+  std::unique_ptr<JournalData> m_replay;
+  std::size_t                  m_replay_cursor = 0;
+  double                       m_replay_wait   = 0.0;
+
+  void LoadJSONMap(const MapData& map_data);
 };
 
 namespace CS230
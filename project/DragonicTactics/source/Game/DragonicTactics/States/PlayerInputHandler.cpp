@@ -32,7 +32,9 @@ Created:    November 24, 2025
 #include "Game/DragonicTactics/Objects/Components/GridPosition.h"
 #include "Game/DragonicTactics/Objects/Dragon.h"
 #include "Game/DragonicTactics/Objects/Fighter.h"
+#include "Game/DragonicTactics/Simulation/BattleCommand.h"
 #include "Game/DragonicTactics/StateComponents/SpellSystem.h"
+#include <imgui.h>
 
 Math::ivec2 PlayerInputHandler::ConvertScreenToGrid(Math::vec2 screen_pos)
 {
@@ -62,7 +64,7 @@ void PlayerInputHandler::OnAttackPressed()
 void PlayerInputHandler::OnEndTurnPressed()
 {
     TurnManager* tm = Engine::GetGameStateManager().GetGSComponent<TurnManager>();
-    if (tm) tm->EndCurrentTurn();
+    if (tm) BattleCommand{}.Execute(tm->GetCurrentCharacter()); // 기본값 = EndTurn (저널에 남기도록 명령으로 실행)
 }
 
 void PlayerInputHandler::Update(double dt, Character* current_character, GridSystem* grid, CombatSystem* combat_system, ButtonManager& btns, const TacticalCamera* camera)
@@ -92,10 +94,15 @@ void PlayerInputHandler::Update(double dt, Character* current_character, GridSys
   // ── Wall Creation 확인 버튼 ──────────────────────────────────────
   if (btns.IsPressed("slot_wall_confirm") && m_state == ActionState::WallPlacementMulti)
   {
-    auto* spell_sys = Engine::GetGameStateManager().GetGSComponent<SpellSystem>();
-    if (spell_sys && !m_wall_placement_tiles.empty())
-      spell_sys->CastWalls(dragon, m_selected_spell_id,
-                           m_wall_placement_tiles, m_selected_upcast_level);
+    if (!m_wall_placement_tiles.empty())
+    {
+      BattleCommand command;
+      command.kind  = BattleCommand::Kind::CastWalls;
+      command.spell = m_selected_spell_id;
+      command.tiles = m_wall_placement_tiles;
+      command.level = m_selected_upcast_level;
+      command.Execute(dragon);
+    }
     m_wall_placement_tiles.clear();
     m_state = ActionState::None;
     btns.SetVisible("slot_wall_confirm", false);
@@ -106,10 +113,15 @@ void PlayerInputHandler::Update(double dt, Character* current_character, GridSys
   // ── Magma Blast 확인 버튼 ──────────────────────────────────────
   if (btns.IsPressed("slot_wall_confirm") && m_state == ActionState::LavaPlacementMulti)
   {
-    auto* spell_sys = Engine::GetGameStateManager().GetGSComponent<SpellSystem>();
-    if (spell_sys && !m_wall_placement_tiles.empty())
-      spell_sys->CastLavaZones(dragon, m_selected_spell_id,
-                               m_wall_placement_tiles, m_selected_upcast_level);
+    if (!m_wall_placement_tiles.empty())
+    {
+      BattleCommand command;
+      command.kind  = BattleCommand::Kind::CastLavaZones;
+      command.spell = m_selected_spell_id;
+      command.tiles = m_wall_placement_tiles;
+      command.level = m_selected_upcast_level;
+      command.Execute(dragon);
+    }
     m_wall_placement_tiles.clear();
     m_state = ActionState::None;
     btns.SetVisible("slot_wall_confirm", false);
@@ -210,11 +222,14 @@ void PlayerInputHandler::HandleMouseClick(Math::vec2 mouse_pos, Dragon* dragon,
 	case ActionState::SelectingMove:
 	  if (grid->IsReachable(grid_pos))
 	  {
-		auto path = grid->FindPath(dragon->GetGridPosition()->Get(), grid_pos);
+		auto path = grid->GetMovementPath(grid_pos);
 
 		if (!path.empty())
 		{
-		  dragon->SetPath(std::move(path));
+		  BattleCommand command;
+		  command.kind	= BattleCommand::Kind::Move;
+		  command.tiles = std::move(path);
+		  command.Execute(dragon);
 		  m_state = ActionState::Moving;
 
 		  Engine::GetLogger().LogEvent("Dragon moving to (" + std::to_string(grid_pos.x) + ", " + std::to_string(grid_pos.y) + ")");
@@ -234,7 +249,12 @@ void PlayerInputHandler::HandleMouseClick(Math::vec2 mouse_pos, Dragon* dragon,
 		if (target && target != dragon)
 		{
 		  if (combat_system)
-			combat_system->ExecuteAttack(dragon, target);
+		  {
+			BattleCommand command;
+			command.kind = BattleCommand::Kind::Attack;
+			command.tile = grid_pos;
+			command.Execute(dragon);
+		  }
 		  grid->DisableAttackRangeMode();
 		  m_state = ActionState::None;
 		}
@@ -266,7 +286,12 @@ void PlayerInputHandler::HandleMouseClick(Math::vec2 mouse_pos, Dragon* dragon,
 		if (spell_sys && spell_sys->CanCast(dragon, m_selected_spell_id,
                                          clicked_tile, m_selected_upcast_level))
 		{
-		  spell_sys->CastSpell(dragon, m_selected_spell_id, clicked_tile, m_selected_upcast_level);
+		  BattleCommand command;
+		  command.kind	= BattleCommand::Kind::CastSpell;
+		  command.spell = m_selected_spell_id;
+		  command.tile	= clicked_tile;
+		  command.level = m_selected_upcast_level;
+		  command.Execute(dragon);
 		  m_state = ActionState::None;
 		  if (grid) grid->DisableSpellTargetingMode();
 		}
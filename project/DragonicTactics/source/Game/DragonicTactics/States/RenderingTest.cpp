@@ -20,6 +20,7 @@
 #include "./Game/MainMenu.h"
 #include "Game/DragonicTactics/Factories/CharacterFactory.h"
 #include "Game/DragonicTactics/Objects/Character.h"
+#include <imgui.h>
 #include <numbers>
 
 RenderingTest::RenderingTest()
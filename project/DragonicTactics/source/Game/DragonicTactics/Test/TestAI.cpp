@@ -16,6 +16,7 @@
 #include "Game/DragonicTactics/StateComponents/AISystem.h"
 #include "Game/DragonicTactics/StateComponents/GridSystem.h"
 #include "Game/DragonicTactics/States/ButtonManager.h"
+#include <thread>
 
 bool TestAITargetsClosestEnemy()
 {
@@ -196,6 +197,181 @@ bool TestAIEndsTurnWhenNoActions()
   return passed;
 }
 
+bool TestDragonAIMovesTowardWeakestEnemy()
+{
+  // Test: 시뮬레이터용 드래곤 AI — 사거리 밖이면 체력이 낮은 적 쪽으로 이동
+  auto&		  gs   = Engine::GetGameStateManager();
+  GridSystem* grid = gs.GetGSComponent<GridSystem>();
+  if (!grid)
+  {
+	std::cout << "  FAILED: GridSystem not found\n";
+	return false;
+  }
+  grid->Reset();
+
+  Dragon testdragon({ 0, 0 });
+  testdragon.SetGridPosition({ 0, 0 });
+  grid->AddCharacter(&testdragon, Math::ivec2{ 0, 0 });
+  testdragon.SetActionPoints(0); // 주문/공격 없이 이동만 판단
+
+  Fighter strong({ 7, 0 });
+  strong.SetGridPosition({ 7, 0 });
+  grid->AddCharacter(&strong, Math::ivec2{ 7, 0 });
+
+  Fighter weak({ 0, 7 });
+  weak.SetGridPosition({ 0, 7 });
+  grid->AddCharacter(&weak, Math::ivec2{ 0, 7 });
+  weak.SetHP(1);
+
+  AISystem	 ai;
+  AIDecision decision = ai.MakeDecision(&testdragon);
+
+  // weak (0, 7) 쪽 = 위로 이동
+  return ASSERT_TRUE(decision.type == AIDecisionType::Move && decision.destination.x == 0 && decision.destination.y > 0);
+}
+
+bool TestDragonAIAttacksWhenAdjacent()
+{
+  auto&		  gs   = Engine::GetGameStateManager();
+  GridSystem* grid = gs.GetGSComponent<GridSystem>();
+  if (!grid)
+  {
+	std::cout << "  FAILED: GridSystem not found\n";
+	return false;
+  }
+  grid->Reset();
+
+  Dragon testdragon({ 3, 3 });
+  testdragon.SetGridPosition({ 3, 3 });
+  grid->AddCharacter(&testdragon, Math::ivec2{ 3, 3 });
+  testdragon.SetActionPoints(2);
+
+  Fighter testfighter({ 3, 4 });
+  testfighter.SetGridPosition({ 3, 4 });
+  grid->AddCharacter(&testfighter, Math::ivec2{ 3, 4 });
+
+  AISystem	 ai;
+  AIDecision decision = ai.MakeDecision(&testdragon);
+
+  return ASSERT_TRUE((decision.type == AIDecisionType::Attack || decision.type == AIDecisionType::UseAbility) && decision.target == &testfighter);
+}
+
+bool TestSearchAIFinishesWeakAdjacentEnemy()
+{
+  // Test: 탐색 드래곤 AI — 한 방에 쓰러뜨릴 수 있는 인접 적을 먼저 친다
+  auto&		  gs   = Engine::GetGameStateManager();
+  GridSystem* grid = gs.GetGSComponent<GridSystem>();
+  if (!grid)
+  {
+	std::cout << "  FAILED: GridSystem not found\n";
+	return false;
+  }
+  grid->Reset();
+
+  Dragon testdragon({ 3, 3 });
+  testdragon.SetGridPosition({ 3, 3 });
+  grid->AddCharacter(&testdragon, Math::ivec2{ 3, 3 });
+  testdragon.SetActionPoints(1);
+
+  Fighter strong({ 3, 5 });
+  strong.SetGridPosition({ 3, 5 });
+  grid->AddCharacter(&strong, Math::ivec2{ 3, 5 });
+
+  Fighter weak({ 4, 3 });
+  weak.SetGridPosition({ 4, 3 });
+  grid->AddCharacter(&weak, Math::ivec2{ 4, 3 });
+  weak.SetHP(2);
+
+  AIStrategyConfig config;
+  config.search_types = { CharacterTypes::Dragon };
+  config.search.node_budget    = 20000; // 시간 대신 노드 수 — 결과가 기계와 무관
+  config.search.time_budget_ms = 0.0;
+
+  AISystem ai;
+  ai.Init(config);
+  AIDecision decision = ai.MakeDecision(&testdragon);
+
+  return ASSERT_TRUE((decision.type == AIDecisionType::Attack || decision.type == AIDecisionType::UseAbility) && decision.target == &weak && ai.GetSearchStats().nodes > 0);
+}
+
+bool TestAsyncDecisionMatchesSync()
+{
+  // Test: 워커 스레드에서 계산한 결정이 같은 스냅샷의 동기 결정과 같다
+  auto&		  gs   = Engine::GetGameStateManager();
+  GridSystem* grid = gs.GetGSComponent<GridSystem>();
+  if (!grid)
+  {
+	std::cout << "  FAILED: GridSystem not found\n";
+	return false;
+  }
+  grid->Reset();
+
+  Dragon testdragon({ 2, 2 });
+  testdragon.SetGridPosition({ 2, 2 });
+  grid->AddCharacter(&testdragon, Math::ivec2{ 2, 2 });
+
+  Fighter testfighter({ 2, 6 });
+  testfighter.SetGridPosition({ 2, 6 });
+  grid->AddCharacter(&testfighter, Math::ivec2{ 2, 6 });
+
+  AIStrategyConfig config;
+  config.search_types			 = { CharacterTypes::Dragon };
+  config.search.node_budget	 = 5000;
+  config.search.time_budget_ms = 0.0;
+
+  AISystem ai;
+  ai.Init(config);
+  const AIDecision sync_decision = ai.MakeDecision(&testdragon);
+
+  // 취소한 작업은 결과를 내지 않는다
+  ai.BeginDecision(&testdragon);
+  ai.CancelDecision();
+  AIDecision async_decision;
+  if (!ASSERT_TRUE(!ai.IsDecisionPending() && !ai.PollDecision(async_decision)))
+	return false;
+
+  ai.BeginDecision(&testdragon);
+  while (!ai.PollDecision(async_decision))
+	std::this_thread::yield();
+
+  return ASSERT_TRUE(async_decision.type == sync_decision.type && async_decision.target == sync_decision.target && async_decision.destination == sync_decision.destination
+					 && async_decision.abilityName == sync_decision.abilityName && ai.GetSearchStats().decisions == 2);
+}
+
+bool TestAIKillReachUsesShortLavaPath()
+{
+  // Test: 비용이 가장 낮은 공격 위치가 이동 범위 밖이어도, 용암을 지나 이동 범위 안에 닿는 위치가 있으면 킬 진입
+  auto&		  gs   = Engine::GetGameStateManager();
+  GridSystem* grid = gs.GetGSComponent<GridSystem>();
+  if (!grid)
+  {
+	std::cout << "  FAILED: GridSystem not found\n";
+	return false;
+  }
+  grid->Reset();
+
+  // (0,3): 용암 두 칸을 지나 3칸 (비용 7) / (2,3): 용암을 돌아 5칸 (비용 5) / (1,4): 7칸
+  grid->SetTileType({ 0, 1 }, GridSystem::TileType::Lava);
+  grid->SetTileType({ 0, 2 }, GridSystem::TileType::Lava);
+  grid->SetTileType({ 1, 2 }, GridSystem::TileType::Lava);
+
+  Fighter testfighter({ 0, 0 });
+  testfighter.SetGridPosition({ 0, 0 });
+  grid->AddCharacter(&testfighter, Math::ivec2{ 0, 0 });
+  testfighter.SetActionPoints(10); // 이동 범위 3, 추정 데미지 50
+
+  Dragon testdragon({ 1, 3 });
+  testdragon.SetGridPosition({ 1, 3 });
+  grid->AddCharacter(&testdragon, Math::ivec2{ 1, 3 });
+  testdragon.SetHP(5);
+
+  AISystem	 ai;
+  AIDecision decision = ai.MakeDecision(&testfighter);
+  grid->Reset();
+
+  return ASSERT_TRUE(decision.type == AIDecisionType::Move && decision.reasoning.rfind("Kill:", 0) == 0);
+}
+
 void RunFighterAITests()
 {
   std::cout << "\n=== FIGHTER AI TESTS ===\n";
@@ -204,6 +380,11 @@ void RunFighterAITests()
   std::cout << (TestAIAttacksWhenInRange() ? "O" : "X") << " AI attacks when in range\n";
   std::cout << (TestAIUsesShieldBashWhenAdjacent() ? "O" : "X") << " AI uses Shield Bash appropriately\n";
   std::cout << (TestAIEndsTurnWhenNoActions() ? "O" : "X") << " AI ends turn when no actions\n";
+  std::cout << (TestDragonAIMovesTowardWeakestEnemy() ? "O" : "X") << " Dragon AI moves toward weakest enemy\n";
+  std::cout << (TestDragonAIAttacksWhenAdjacent() ? "O" : "X") << " Dragon AI attacks adjacent enemy\n";
+  std::cout << (TestSearchAIFinishesWeakAdjacentEnemy() ? "O" : "X") << " Search AI finishes weak adjacent enemy\n";
+  std::cout << (TestAsyncDecisionMatchesSync() ? "O" : "X") << " Async AI decision matches sync decision\n";
+  std::cout << (TestAIKillReachUsesShortLavaPath() ? "O" : "X") << " AI kill reach checks every attack position\n";
   ButtonManager btns;
 btns.AddButton({ "test_btn", {100.0, 100.0}, {80.0, 30.0}, "Test" });
 
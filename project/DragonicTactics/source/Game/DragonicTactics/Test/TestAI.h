@@ -10,6 +10,11 @@ bool TestAIMovesCloserWhenOutOfRange();
 bool TestAIAttacksWhenInRange();
 bool TestAIUsesShieldBashWhenAdjacent();
 bool TestAIEndsTurnWhenNoActions();
+bool TestDragonAIMovesTowardWeakestEnemy();
+bool TestDragonAIAttacksWhenAdjacent();
+bool TestSearchAIFinishesWeakAdjacentEnemy();
+bool TestAsyncDecisionMatchesSync();
+bool TestAIKillReachUsesShortLavaPath();
 void RunFighterAITests();
 
 extern bool TestAI;
\ No newline at end of file
@@ -14,7 +14,9 @@
 #include "./Engine/Vec2.h"
 
 #include "./Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "./Game/DragonicTactics/StateComponents/MapDataRegistry.h"
 #include "./Game/DragonicTactics/Test/TestAssert.h"
+#include "./Game/DragonicTactics/Test/TestPathfindingBenchmark.h"
 
 bool TestPathfindingStraightLine()
 {
@@ -348,3 +350,410 @@ bool TestPathfindingUnwalkableGoal()
   std::cout << "Test_Pathfinding_UnwalkableGoal passed" << std::endl;
   return true;
 }
+
+bool TestPathfindingMatchesReference()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  // Action - 무작위 맵 여러 장에서 모든 (start, goal) 쌍을 기존 구현과 비교
+  int compared   = 0;
+  int mismatches = 0;
+  for (unsigned seed = 1; seed <= 5; ++seed)
+  {
+	gridsys->LoadMap(MakeRandomPathfindingMap(12, 12, seed));
+	for (int penalty : { 0, 2 })
+	{
+	  for (int sy = 0; sy < 12; ++sy)
+		for (int sx = 0; sx < 12; ++sx)
+		  for (int gy = 0; gy < 12; ++gy)
+			for (int gx = 0; gx < 12; ++gx)
+			{
+			  Math::ivec2 start{ sx, sy };
+			  Math::ivec2 goal{ gx, gy };
+			  if (start == goal || gridsys->GetTileType(start) == GridSystem::TileType::Wall)
+				continue;
+
+			  std::vector<Math::ivec2> expected = ReferenceFindPath(*gridsys, start, goal, penalty);
+			  if (expected.empty())
+				continue; // 도달 불가/걸을 수 없는 목표는 FindPath 가 에러 로그를 남기므로 제외
+
+			  ++compared;
+			  // penalty 0 은 JPS 가 처리 — 동률 경로 중 다른 것을 고를 수 있으므로 길이만 비교
+			  std::vector<Math::ivec2> path = gridsys->FindPath(start, goal, penalty);
+			  if (gridsys->UsesJumpPointSearch(penalty) ? path.size() != expected.size() : path != expected)
+				++mismatches;
+			}
+	}
+  }
+
+  // Assertions
+  ASSERT_GE(compared, 1);
+  ASSERT_EQ(mismatches, 0);
+
+  gridsys->Reset();
+  std::cout << "Test_Pathfinding_MatchesReference passed (" << compared << " paths)" << std::endl;
+  return mismatches == 0;
+}
+
+bool TestPathfindingToNearestGoal()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+  gridsys->Reset();
+
+  // Action - (0,6) 은 5칸, (5,0) 은 5칸 → 비용이 같으면 앞쪽 목표, (7,7) 은 벽
+  gridsys->SetTileType({ 7, 7 }, GridSystem::TileType::Wall);
+  GridSystem::NearestPathResult tie = gridsys->FindPathToNearest({ 0, 1 }, { { 7, 7 }, { 0, 6 }, { 5, 1 } });
+
+  // Assertions
+  ASSERT_TRUE(tie.found);
+  ASSERT_EQ(tie.goal, { 0, 6 });
+  ASSERT_EQ(tie.cost, 5);
+  ASSERT_EQ(static_cast<int>(tie.path.size()), 5);
+
+  // Action - 가까운 목표 앞이 용암이면 패널티 포함 비용으로 먼 목표를 선택
+  gridsys->SetTileType({ 1, 0 }, GridSystem::TileType::Lava);
+  gridsys->SetTileType({ 1, 1 }, GridSystem::TileType::Wall);
+  GridSystem::NearestPathResult lava = gridsys->FindPathToNearest({ 0, 0 }, { { 2, 0 }, { 0, 3 } }, 2);
+
+  ASSERT_TRUE(lava.found);
+  ASSERT_EQ(lava.goal, { 0, 3 });
+  ASSERT_EQ(lava.cost, 3);
+
+  // Action - 패널티 없으면 더 가까운 (2,0)
+  GridSystem::NearestPathResult no_penalty = gridsys->FindPathToNearest({ 0, 0 }, { { 2, 0 }, { 0, 3 } }, 0);
+  ASSERT_EQ(no_penalty.goal, { 2, 0 });
+  ASSERT_EQ(no_penalty.cost, 2);
+
+  // Action - 걸을 수 있는 목표가 없음
+  GridSystem::NearestPathResult none = gridsys->FindPathToNearest({ 0, 0 }, { { 7, 7 }, { -1, 0 } });
+  ASSERT_FALSE(none.found);
+
+  bool passed = tie.found && tie.goal == Math::ivec2{ 0, 6 } && tie.cost == 5 && lava.found && lava.goal == Math::ivec2{ 0, 3 } && lava.cost == 3 && no_penalty.goal == Math::ivec2{ 2, 0 } && !none.found;
+  std::cout << "Test_Pathfinding_ToNearestGoal " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool TestDistanceFieldCache()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+  gridsys->Reset();
+  gridsys->ResetDistanceFieldStats();
+
+  // Action - 같은 source 두 번 → miss 1, hit 1
+  int first  = gridsys->GetPathCost({ 0, 0 }, { 3, 0 });
+  int second = gridsys->GetPathCost({ 0, 0 }, { 3, 0 });
+  GridSystem::DistanceFieldStats after_lookup = gridsys->GetDistanceFieldStats();
+
+  // Assertions
+  ASSERT_EQ(first, 3);
+  ASSERT_EQ(second, 3);
+  ASSERT_EQ(after_lookup.misses, 1);
+  ASSERT_EQ(after_lookup.hits, 1);
+
+  // Action - 경로 위에 벽 → 필드 무효화 후 우회 비용으로 재계산
+  gridsys->SetTileType({ 1, 0 }, GridSystem::TileType::Wall);
+  int detour = gridsys->GetPathCost({ 0, 0 }, { 3, 0 });
+  GridSystem::DistanceFieldStats after_wall = gridsys->GetDistanceFieldStats();
+
+  ASSERT_EQ(detour, 5);
+  ASSERT_EQ(after_wall.invalidations, 1);
+  ASSERT_EQ(after_wall.misses, 2);
+
+  // Action - 도달 불가 영역 안쪽 변경은 필드를 버리지 않는다: (7,7) 을 벽으로 가둔 뒤 내부 변경
+  gridsys->SetTileType({ 6, 7 }, GridSystem::TileType::Wall);
+  gridsys->SetTileType({ 7, 6 }, GridSystem::TileType::Wall);
+  gridsys->GetPathCost({ 0, 0 }, { 3, 0 });
+  GridSystem::DistanceFieldStats before_inner = gridsys->GetDistanceFieldStats();
+  gridsys->SetTileType({ 7, 7 }, GridSystem::TileType::Lava);
+  gridsys->GetPathCost({ 0, 0 }, { 3, 0 });
+  GridSystem::DistanceFieldStats after_inner = gridsys->GetDistanceFieldStats();
+
+  ASSERT_EQ(after_inner.invalidations, before_inner.invalidations);
+  ASSERT_EQ(after_inner.hits, before_inner.hits + 1);
+
+  // Action - FindPath 는 캐시된 (0,0) 필드를 그대로 쓰고, 캐시에 없는 start 는 필드를 새로 만들지 않는다
+  std::vector<Math::ivec2> cached_path = gridsys->FindPath({ 0, 0 }, { 3, 0 });
+  GridSystem::DistanceFieldStats after_find = gridsys->GetDistanceFieldStats();
+  std::vector<Math::ivec2> searched_path = gridsys->FindPath({ 3, 3 }, { 3, 0 });
+  GridSystem::DistanceFieldStats after_search = gridsys->GetDistanceFieldStats();
+
+  ASSERT_EQ(static_cast<int>(cached_path.size()), 5);
+  ASSERT_EQ(after_find.hits, after_inner.hits + 1);
+  ASSERT_EQ(static_cast<int>(searched_path.size()), 3);
+  ASSERT_EQ(after_search.misses, after_find.misses);
+  ASSERT_EQ(after_search.cached, after_find.cached);
+
+  // Action - 이동 범위 조회는 변경된 타일을 그대로 반영
+  std::vector<Math::ivec2> reachable = gridsys->GetReachableTiles({ 0, 0 }, 2);
+  ASSERT_EQ(static_cast<int>(reachable.size()), 3); // (0,1) (0,2) (1,1) — (1,0) 은 벽
+
+  // Action - 캐시가 MAX_DISTANCE_FIELDS 까지 차는 동안 앞서 받은 필드는 옮겨지지 않는다
+  const DistanceField* held = &gridsys->GetDistanceField({ 0, 0 });
+  for (int x = 1; x < 8; ++x)
+	gridsys->GetDistanceField({ x, 4 });
+  bool stable = &gridsys->GetDistanceField({ 0, 0 }) == held && held->source == Math::ivec2{ 0, 0 };
+  ASSERT_TRUE(stable);
+
+  bool passed = first == 3 && second == 3 && after_lookup.misses == 1 && after_lookup.hits == 1 && detour == 5 && after_inner.invalidations == before_inner.invalidations &&
+				cached_path.size() == 5 && cached_path.back() == Math::ivec2{ 3, 0 } && after_find.hits == after_inner.hits + 1 && searched_path.size() == 3 &&
+				after_search.misses == after_find.misses && reachable.size() == 3 && stable;
+  gridsys->Reset();
+  std::cout << "Test_DistanceFieldCache " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool TestReachableTiles()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+  gridsys->Reset();
+  gridsys->SetTileType({ 1, 0 }, GridSystem::TileType::Lava);
+
+  // Action - 칸당 1: (1,0) (0,1) (2,0) (1,1) (0,2)
+  const ReachableTiles& uniform		  = gridsys->ComputeReachable({ 0, 0 }, 2);
+  int					uniform_count = static_cast<int>(uniform.tiles.size());
+  int					uniform_bits  = uniform.mask.Count();
+  bool					has_lava	  = uniform.Contains({ 1, 0 });
+  bool					has_start	  = uniform.Contains({ 0, 0 });
+
+  ASSERT_EQ(uniform_count, 5);
+  ASSERT_EQ(uniform_bits, 5);
+  ASSERT_TRUE(has_lava);
+  ASSERT_FALSE(has_start);
+
+  // Action - 용암 패널티 2: (1,0) 비용 3 → 제외, (2,0) 은 어느 쪽으로도 4 → 제외
+  const ReachableTiles& weighted		= gridsys->ComputeReachable({ 0, 0 }, 2, 2);
+  int					weighted_count	= static_cast<int>(weighted.tiles.size());
+  bool					weighted_lava	= weighted.Contains({ 1, 0 });
+  bool					weighted_corner = weighted.Contains({ 1, 1 });
+
+  ASSERT_EQ(weighted_count, 3);
+  ASSERT_FALSE(weighted_lava);
+  ASSERT_TRUE(weighted_corner);
+
+  // Action - 이동 모드의 IsReachable 은 같은 비트마스크를 사용
+  gridsys->EnableMovementMode({ 0, 0 }, 2);
+  bool reach_near = gridsys->IsReachable({ 1, 1 });
+  bool reach_far  = gridsys->IsReachable({ 2, 1 });
+  bool reach_out  = gridsys->IsReachable({ -1, 0 });
+  gridsys->DisableMovementMode();
+  bool reach_after_disable = gridsys->IsReachable({ 1, 1 });
+
+  ASSERT_TRUE(reach_near);
+  ASSERT_FALSE(reach_far);
+  ASSERT_FALSE(reach_out);
+  ASSERT_FALSE(reach_after_disable);
+
+  bool passed = uniform_count == 5 && uniform_bits == 5 && has_lava && !has_start && weighted_count == 3 && !weighted_lava && weighted_corner && reach_near && !reach_far &&
+				!reach_out && !reach_after_disable;
+  gridsys->Reset();
+  std::cout << "Test_ReachableTiles " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool TestMovementModePath()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+  gridsys->Reset();
+
+  // Action - 탐색 트리에서 경로 추출
+  gridsys->EnableMovementMode({ 0, 0 }, 4);
+  std::vector<Math::ivec2> path = gridsys->GetMovementPath({ 2, 2 });
+  bool					   ends_at_goal = !path.empty() && path.back() == Math::ivec2{ 2, 2 };
+
+  ASSERT_EQ(static_cast<int>(path.size()), 4);
+  ASSERT_TRUE(ends_at_goal);
+
+  // Action - 같은 인자로 다시 켜도 그리드 버전이 그대로면 결과 동일
+  unsigned version = gridsys->GetGridVersion();
+  gridsys->EnableMovementMode({ 0, 0 }, 4);
+  bool same_version = gridsys->GetGridVersion() == version;
+  ASSERT_TRUE(same_version);
+
+  // Action - 그리드가 바뀌면 트리 재계산: (0,0) 을 벽으로 둘러싸면 도달 불가
+  gridsys->SetTileType({ 1, 0 }, GridSystem::TileType::Wall);
+  gridsys->SetTileType({ 0, 1 }, GridSystem::TileType::Wall);
+  std::vector<Math::ivec2> blocked = gridsys->GetMovementPath({ 2, 2 });
+  bool					   still_reachable = gridsys->IsReachable({ 2, 2 });
+
+  ASSERT_TRUE(blocked.empty());
+  ASSERT_FALSE(still_reachable);
+
+  // Action - 범위 밖 목표
+  gridsys->SetTileType({ 1, 0 }, GridSystem::TileType::Empty);
+  std::vector<Math::ivec2> too_far = gridsys->GetMovementPath({ 5, 5 });
+  ASSERT_TRUE(too_far.empty());
+
+  gridsys->DisableMovementMode();
+  bool passed = path.size() == 4 && ends_at_goal && same_version && blocked.empty() && !still_reachable && too_far.empty();
+  gridsys->Reset();
+  std::cout << "Test_MovementModePath " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool TestHierarchicalPathfinding()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  MapData map		= MakeRandomPathfindingMap(48, 48, 7u);
+  map.pathfinding	= "hierarchical";
+  map.cluster_size	= 8;
+  gridsys->LoadMap(map);
+  bool hierarchical = gridsys->GetPathfindingMode() == GridSystem::PathfindingMode::Hierarchical;
+  ASSERT_TRUE(hierarchical);
+
+  // Action - 평면 A* 와 도달 여부가 같고, 경로가 이어져 있으며, 비용이 최적 이상인지
+  PathfindingEngine		   flat;
+  std::vector<Math::ivec2> expected;
+  int					   compared = 0;
+  int					   invalid	= 0;
+  for (int i = 0; i < 40; ++i)
+  {
+	Math::ivec2 start{ (i * 7) % 48, (i * 13) % 48 };
+	Math::ivec2 goal{ 47 - (i * 5) % 48, 47 - (i * 11) % 48 };
+	if (!gridsys->IsWalkable(start) || gridsys->GetTileType(goal) != GridSystem::TileType::Empty || start == goal)
+	  continue;
+
+	flat.FindPath(*gridsys, start, goal, 0, expected);
+	std::vector<Math::ivec2> path = gridsys->FindPath(start, goal);
+	++compared;
+	if (path.empty() != expected.empty() || path.size() < expected.size())
+	{
+	  ++invalid;
+	  continue;
+	}
+	Math::ivec2 prev = start;
+	for (const Math::ivec2& tile : path)
+	{
+	  const GridSystem::TileType type = gridsys->GetTileType(tile);
+	  if (gridsys->ManhattanDistance(prev, tile) != 1 || (type != GridSystem::TileType::Empty && type != GridSystem::TileType::Lava))
+	  {
+		++invalid;
+		break;
+	  }
+	  prev = tile;
+	}
+  }
+
+  ASSERT_GE(compared, 1);
+  ASSERT_EQ(invalid, 0);
+
+  // Action - 벽 하나는 해당 클러스터와 이웃(최대 5개)만 다시 만든다
+  const int rebuilt_before = gridsys->GetHierarchicalStats().rebuilt_clusters;
+  gridsys->SetTileType({ 20, 20 }, GridSystem::TileType::Wall);
+  gridsys->FindPath({ 0, 0 }, { 47, 47 });
+  const int rebuilt = gridsys->GetHierarchicalStats().rebuilt_clusters - rebuilt_before;
+
+  ASSERT_GE(rebuilt, 1);
+  ASSERT_TRUE(rebuilt <= 5);
+
+  bool passed = hierarchical && compared >= 1 && invalid == 0 && rebuilt >= 1 && rebuilt <= 5;
+  gridsys->SetPathfindingMode(GridSystem::PathfindingMode::Flat);
+  gridsys->Reset();
+  std::cout << "Test_HierarchicalPathfinding " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool TestJumpPointMatchesAStar()
+{
+  // Setup
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  // Action - 무작위 맵(크기/시드 여러 개)의 모든 (start, goal) 쌍에서 두 해법 비교
+  PathfindingEngine		   astar;
+  PathfindingEngine		   jps;
+  std::vector<Math::ivec2> expected;
+  std::vector<Math::ivec2> path;
+  int					   compared	  = 0;
+  int					   mismatches = 0;
+  for (unsigned seed = 1; seed <= 8; ++seed)
+  {
+	const int width	 = 6 + static_cast<int>(seed % 5) * 3;
+	const int height = 5 + static_cast<int>(seed % 4) * 3;
+	gridsys->LoadMap(MakeRandomPathfindingMap(width, height, seed * 17u));
+
+	for (int s = 0; s < width * height; ++s)
+	  for (int g = 0; g < width * height; ++g)
+	  {
+		const Math::ivec2 start{ s % width, s / width };
+		const Math::ivec2 goal{ g % width, g / width };
+		if (start == goal || !gridsys->IsPassableAt(g))
+		  continue;
+
+		const bool found_astar = astar.FindPath(*gridsys, start, goal, 0, expected);
+		const bool found_jps   = jps.FindPathJumpPoint(*gridsys, start, goal, path);
+		++compared;
+
+		bool same = found_astar == found_jps && path.size() == expected.size();
+		// 길이가 같아도 경로가 실제로 이어져 있고 통과 가능한 타일만 지나는지 확인
+		Math::ivec2 prev = start;
+		for (std::size_t i = 0; same && i < path.size(); ++i)
+		{
+		  same = gridsys->ManhattanDistance(prev, path[i]) == 1 && gridsys->IsPassableAt(gridsys->TileIndex(path[i]));
+		  prev = path[i];
+		}
+		if (!same)
+		  ++mismatches;
+	  }
+  }
+
+  // 자동 선택: penalty 가 있어도 Lava 가 없으면 JPS, Lava 가 생기면 가중치 A*
+  gridsys->Reset();
+  const bool jps_without_lava = gridsys->UsesJumpPointSearch(2);
+  gridsys->SetTileType({ 3, 3 }, GridSystem::TileType::Lava);
+  const bool astar_with_lava = !gridsys->UsesJumpPointSearch(2) && gridsys->UsesJumpPointSearch(0);
+  gridsys->SetTileType({ 3, 3 }, GridSystem::TileType::Empty);
+  const bool jps_after_clear = gridsys->UsesJumpPointSearch(2);
+
+  // Assertions
+  ASSERT_GE(compared, 1);
+  ASSERT_EQ(mismatches, 0);
+  ASSERT_TRUE(jps_without_lava);
+  ASSERT_TRUE(astar_with_lava);
+  ASSERT_TRUE(jps_after_clear);
+
+  gridsys->Reset();
+  bool passed = mismatches == 0 && jps_without_lava && astar_with_lava && jps_after_clear;
+  std::cout << "Test_JumpPointMatchesAStar " << (passed ? "passed" : "failed") << " (" << compared << " paths)" << std::endl;
+  return passed;
+}
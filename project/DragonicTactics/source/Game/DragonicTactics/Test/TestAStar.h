@@ -21,4 +21,12 @@ bool TestPathfindingInvalidStart();
 bool TestPathfindingInvalidGoal();
 bool TestPathfindingUnwalkableGoal();
 
+bool TestPathfindingMatchesReference();
+bool TestPathfindingToNearestGoal();
+bool TestDistanceFieldCache();
+bool TestReachableTiles();
+bool TestMovementModePath();
+bool TestHierarchicalPathfinding();
+bool TestJumpPointMatchesAStar();
+
 extern bool TestAStar;
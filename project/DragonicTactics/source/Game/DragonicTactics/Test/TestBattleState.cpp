@@ -0,0 +1,240 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "TestBattleState.h"
+
+#include "TestAssert.h"
+
+#include "./Engine/GameStateManager.h"
+#include "Game/DragonicTactics/Objects/Components/StatusEffectComponent.h"
+#include "Game/DragonicTactics/Objects/Dragon.h"
+#include "Game/DragonicTactics/Objects/Fighter.h"
+#include "Game/DragonicTactics/Simulation/BattleJournal.h"
+#include "Game/DragonicTactics/Simulation/BattleRecorder.h"
+#include "Game/DragonicTactics/Simulation/BattleState.h"
+#include "Game/DragonicTactics/StateComponents/AISystem.h"
+#include "Game/DragonicTactics/StateComponents/BattleHash.h"
+#include "Game/DragonicTactics/StateComponents/GridSystem.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+bool TestBattleStateRoundTrip()
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  grid->Reset();
+
+  Fighter fighter({ 4, 4 });
+  fighter.SetGridPosition({ 4, 4 });
+  grid->AddCharacter(&fighter, { 4, 4 });
+  Dragon dragon({ 1, 1 });
+  dragon.SetGridPosition({ 1, 1 });
+  grid->AddCharacter(&dragon, { 1, 1 });
+
+  BattleState			  saved;
+  std::vector<Character*> roster;
+  const bool			  extracted = BattleStateBridge::Extract(saved, roster);
+  const int				  fighter_hp = fighter.GetHP();
+  const int				  fighter_ap = fighter.GetActionPoints();
+
+  // 미리보기처럼 라이브 상태를 바꾼 뒤 되돌린다
+  grid->MoveCharacter({ 4, 4 }, { 5, 5 });
+  fighter.SetGridPosition({ 5, 5 });
+  fighter.SetHP(1);
+  fighter.SetActionPoints(0);
+  fighter.GetGOComponent<StatusEffectComponent>()->AddEffect("Fear", 2);
+  grid->SetTileType({ 2, 2 }, GridSystem::TileType::Wall);
+
+  BattleStateBridge::Apply(saved, roster);
+
+  const bool restored = extracted && saved.unit_count == 2 && roster[0] == &dragon // 타일 순: (1,1) 이 먼저
+					 && grid->GetCharacterAt({ 4, 4 }) == &fighter && grid->GetCharacterAt({ 5, 5 }) == nullptr
+					 && fighter.GetGridPosition()->Get() == Math::ivec2{ 4, 4 } && fighter.GetHP() == fighter_hp
+					 && fighter.GetActionPoints() == fighter_ap && !fighter.Has("Fear")
+					 && grid->GetTileType({ 2, 2 }) == GridSystem::TileType::Empty;
+
+  grid->Reset();
+  return ASSERT_TRUE(restored);
+}
+
+bool TestBattleStateCopyIsIndependent()
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  grid->Reset();
+
+  Fighter fighter({ 3, 3 });
+  fighter.SetGridPosition({ 3, 3 });
+  grid->AddCharacter(&fighter, { 3, 3 });
+
+  BattleState			  root;
+  std::vector<Character*> roster;
+  BattleStateBridge::Extract(root, roster);
+
+  // 분기는 대입 한 번 — 자식을 바꿔도 부모는 그대로
+  BattleState child		  = root;
+  child.units[0].hp		  = 0;
+  child.units[0].position = { 0, 0 };
+  child.tiles[0]		  = static_cast<std::uint8_t>(GridSystem::TileType::Lava);
+
+  const bool independent = root.units[0].IsAlive() && root.UnitAt({ 3, 3 }) == 0 && child.UnitAt({ 0, 0 }) == -1
+						&& root.TileAt({ 0, 0 }) == GridSystem::TileType::Empty;
+
+  Engine::GetLogger().LogEvent("BattleState size: " + std::to_string(sizeof(BattleState)) + " bytes");
+
+  grid->Reset();
+  return ASSERT_TRUE(independent);
+}
+
+bool TestBattleHashIsIncremental()
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  BattleHash* hash = Engine::GetGameStateManager().GetGSComponent<BattleHash>();
+  grid->Reset();
+  hash->Clear();
+
+  Fighter fighter({ 4, 4 });
+  fighter.SetGridPosition({ 4, 4 });
+  grid->AddCharacter(&fighter, { 4, 4 });
+  hash->Refresh(&fighter);
+  const std::uint64_t start = hash->GetHash();
+
+  // 타일, 배치, 유닛 상태를 하나씩 바꿀 때마다 해시가 달라지고, 되돌리면 처음 값으로 돌아온다
+  grid->SetTileType({ 2, 2 }, GridSystem::TileType::Lava);
+  const bool tile_changed = hash->GetHash() != start;
+  grid->MoveCharacter({ 4, 4 }, { 5, 4 });
+  const bool move_changed = hash->GetHash() != start;
+  fighter.SetHP(fighter.GetHP() - 1);
+  hash->Refresh(&fighter);
+  const bool hp_changed = hash->GetHash() != start;
+
+  fighter.SetHP(fighter.GetHP() + 1);
+  hash->Refresh(&fighter);
+  grid->MoveCharacter({ 5, 4 }, { 4, 4 });
+  grid->SetTileType({ 2, 2 }, GridSystem::TileType::Empty);
+  const bool restored = hash->GetHash() == start;
+
+  grid->RemoveCharacter({ 4, 4 });
+  hash->Forget(&fighter);
+  return ASSERT_TRUE(tile_changed && move_changed && hp_changed && restored && hash->GetHash() == 0);
+}
+
+bool TestDecisionCacheHitsOnSameState()
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  BattleHash* hash = Engine::GetGameStateManager().GetGSComponent<BattleHash>();
+  grid->Reset();
+  hash->Clear();
+
+  Dragon dragon({ 1, 1 });
+  dragon.SetGridPosition({ 1, 1 });
+  grid->AddCharacter(&dragon, { 1, 1 });
+  Fighter fighter({ 6, 1 });
+  fighter.SetGridPosition({ 6, 1 });
+  grid->AddCharacter(&fighter, { 6, 1 });
+
+  AISystem		   ai;
+  const AIDecision first  = ai.MakeDecision(&fighter);
+  const AIDecision second = ai.MakeDecision(&fighter); // 상태가 같으므로 캐시
+  grid->MoveCharacter({ 1, 1 }, { 1, 2 });
+  dragon.SetGridPosition({ 1, 2 });
+  ai.MakeDecision(&fighter); // 드래곤이 움직였으니 다시 계산
+
+  const AISystem::DecisionCacheStats& stats = ai.GetDecisionCacheStats();
+  const bool same = first.type == second.type && first.destination == second.destination && first.target == second.target;
+
+  grid->RemoveCharacter({ 1, 2 });
+  grid->RemoveCharacter({ 6, 1 });
+  return ASSERT_TRUE(same && stats.hits == 1 && stats.misses == 2);
+}
+
+bool TestBattleJournalRoundTrip()
+{
+  const char* path = "test_battle_journal.dtj";
+
+  JournalHeader header;
+  header.dice_seed			   = 42;
+  header.map.id				   = "journal_map";
+  header.map.width			   = 3;
+  header.map.height			   = 2;
+  header.map.tiles			   = { "w.l", "..." };
+  header.map.legend			   = { { 'w', "wall" }, { 'l', "lava" } };
+  header.map.spawn_points["dragon"] = { 1, 1 };
+
+  BattleCommand move;
+  move.kind	 = BattleCommand::Kind::Move;
+  move.tiles = { { 1, 0 }, { 2, 0 } };
+  BattleCommand spell;
+  spell.kind  = BattleCommand::Kind::CastSpell;
+  spell.spell = "S_ATK_010";
+  spell.tile  = { 2, 1 };
+  spell.level = 2;
+  BattleCommand ai;
+  ai.kind			= BattleCommand::Kind::AIDecision;
+  ai.decision_type	= AIDecisionType::Move;
+  ai.destination	= { 0, 1 };
+  ai.lava_penalty	= 3;
+
+  BattleJournal journal;
+  journal.Open(path, header);
+  journal.WriteCommand(0, move);
+  journal.WriteEvent(JournalEvent::Damaged, { 1, 7, -2, -1 });
+  journal.WriteChecksum({ 0, 1, 2, 1, 0x0123456789ABCDEFULL });
+  journal.WriteCommand(1, spell);
+  journal.WriteCommand(2, ai);
+  journal.Close(true);
+
+  JournalData loaded;
+  std::string error;
+  const bool  ok = BattleJournal::Load(path, loaded, error);
+
+  const bool same = ok && loaded.finished && !loaded.truncated && loaded.header.dice_seed == 42 && loaded.header.map.tiles == header.map.tiles
+				 && loaded.header.map.legend == header.map.legend && loaded.header.map.spawn_points == header.map.spawn_points
+				 && loaded.commands.size() == 3 && loaded.commands[0].command.tiles == move.tiles && loaded.commands[1].actor == 1
+				 && loaded.commands[1].command.spell == "S_ATK_010" && loaded.commands[1].command.level == 2
+				 && loaded.commands[2].command.tile == Math::ivec2{ -1, -1 } && loaded.commands[2].command.lava_penalty == 3
+				 && loaded.events.size() == 1 && loaded.events[0].values == std::vector<int>{ 1, 7, -2, -1 } && loaded.checksums.size() == 1
+				 && loaded.checksums[0].checksum == 0x0123456789ABCDEFULL && loaded.checksums[0].sequence == 2;
+
+  // 기록 중 크래시: 마지막 레코드가 잘려도 그 앞까지는 읽힌다
+  std::ifstream				file(path, std::ios::binary);
+  std::vector<std::uint8_t> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+  file.close();
+  std::remove(path);
+  bytes.resize(bytes.size() - 4); // End 레코드(2바이트) + 마지막 명령의 끝
+  JournalData cut;
+  const bool	partial = BattleJournal::Parse(bytes, cut, error) && cut.truncated && !cut.finished && cut.commands.size() == 2;
+
+  return ASSERT_TRUE(same && partial);
+}
+
+bool TestBattleChecksumIgnoresPointers()
+{
+  GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  grid->Reset();
+
+  // 다른 실행의 같은 상태 = 다른 주소의 같은 캐릭터 — 체크섬은 같아야 한다
+  std::uint64_t checksums[2] = {};
+  for (std::uint64_t& checksum : checksums)
+  {
+	auto fighter = std::make_unique<Fighter>(Math::ivec2{ 4, 4 });
+	fighter->SetGridPosition({ 4, 4 });
+	grid->AddCharacter(fighter.get(), { 4, 4 });
+	checksum = BattleRecorder::ComputeChecksum(1);
+	grid->RemoveCharacter({ 4, 4 });
+  }
+
+  Fighter fighter({ 4, 4 });
+  fighter.SetGridPosition({ 4, 4 });
+  grid->AddCharacter(&fighter, { 4, 4 });
+  fighter.SetHP(fighter.GetHP() - 1);
+  const bool hp_changes	   = BattleRecorder::ComputeChecksum(1) != checksums[0];
+  const bool round_changes = BattleRecorder::ComputeChecksum(2) != BattleRecorder::ComputeChecksum(1);
+  grid->RemoveCharacter({ 4, 4 });
+
+  return ASSERT_TRUE(checksums[0] == checksums[1] && hp_changes && round_changes);
+}
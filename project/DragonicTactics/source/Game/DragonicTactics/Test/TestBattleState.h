@@ -0,0 +1,15 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+extern bool TestBattleSnapshot;
+
+bool TestBattleStateRoundTrip();
+bool TestBattleStateCopyIsIndependent();
+bool TestBattleHashIsIncremental();
+bool TestDecisionCacheHitsOnSameState();
+bool TestBattleJournalRoundTrip();
+bool TestBattleChecksumIgnoresPointers();
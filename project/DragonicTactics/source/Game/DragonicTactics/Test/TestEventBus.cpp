@@ -22,9 +22,9 @@ void test_multiple_different_events()
   bool deathCalled	= false;
   bool spellCalled	= false;
 
-  eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { damageCalled = true; });
-  eventbus.Subscribe<CharacterDeathEvent>([&]([[maybe_unused]] const CharacterDeathEvent&) { deathCalled = true; });
-  eventbus.Subscribe<SpellCastEvent>([&]([[maybe_unused]] const SpellCastEvent&) { spellCalled = true; });
+  auto sub1 = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { damageCalled = true; });
+  auto sub2 = eventbus.Subscribe<CharacterDeathEvent>([&]([[maybe_unused]] const CharacterDeathEvent&) { deathCalled = true; });
+  auto sub3 = eventbus.Subscribe<SpellCastEvent>([&]([[maybe_unused]] const SpellCastEvent&) { spellCalled = true; });
 
   MockCharacter character("TestChar");
   eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
@@ -47,7 +47,7 @@ void test_EventData_CompleteTransfer()
   MockCharacter			victim("Victim"), attacker("Attacker");
   CharacterDamagedEvent receivedEvent;
 
-  eventbus.Subscribe<CharacterDamagedEvent>([&](const CharacterDamagedEvent& e) { receivedEvent = e; });
+  auto sub = eventbus.Subscribe<CharacterDamagedEvent>([&](const CharacterDamagedEvent& e) { receivedEvent = e; });
 
   CharacterDamagedEvent originalEvent{ reinterpret_cast<Character*>(&victim), 42, 58, reinterpret_cast<Character*>(&attacker), true };
   eventbus.Publish(originalEvent);
@@ -71,7 +71,7 @@ void test_subscribe_publish_singleSubscriber()
   MockCharacter			character("TestDragon");
   const int				damage = 30;
   CharacterDamagedEvent event{ reinterpret_cast<Character*>(&character), damage, 70, nullptr, false };
-  eventbus.Subscribe<CharacterDamagedEvent>(
+  auto sub = eventbus.Subscribe<CharacterDamagedEvent>(
 	[&](const CharacterDamagedEvent& e)
 	{
 	  callbackInvoked = true;
@@ -95,9 +95,9 @@ void test_multiple_subscribers_sameEvent()
   int callback2Count = 0;
   int callback3Count = 0;
 
-  eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback1Count++; });
-  eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback2Count++; });
-  eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback3Count++; });
+  auto sub1 = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback1Count++; });
+  auto sub2 = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback2Count++; });
+  auto sub3 = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { callback3Count++; });
 
   MockCharacter character("TestChar");
   eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
@@ -113,7 +113,7 @@ void test_EventData_MultiplePublishes()
   eventbus.Clear();
 
   std::vector<int> damages;
-  eventbus.Subscribe<CharacterDamagedEvent>([&](const CharacterDamagedEvent& e) { damages.push_back(e.damageAmount); });
+  auto sub = eventbus.Subscribe<CharacterDamagedEvent>([&](const CharacterDamagedEvent& e) { damages.push_back(e.damageAmount); });
 
   MockCharacter character("TestChar");
   eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
@@ -125,3 +125,113 @@ void test_EventData_MultiplePublishes()
   ASSERT_EQ(damages[1], 20);
   ASSERT_EQ(damages[2], 30);
 }
+
+void test_subscription_handle_unsubscribes()
+{
+  EventBus eventbus;
+  eventbus.Clear();
+
+  int			count = 0;
+  MockCharacter character("TestChar");
+  {
+	auto sub = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { count++; });
+	eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
+	ASSERT_EQ(eventbus.GetSubscriberCount<CharacterDamagedEvent>(), std::size_t{ 1 });
+  }
+  // 핸들이 사라졌으니 더 이상 받지 않는다
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 80, nullptr, false });
+  ASSERT_EQ(count, 1);
+  ASSERT_EQ(eventbus.GetSubscriberCount<CharacterDamagedEvent>(), std::size_t{ 0 });
+
+  // 버스보다 오래 사는 핸들도 안전해야 한다
+  EventBus::Subscription outlives;
+  {
+	EventBus temporary;
+	outlives = temporary.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { count++; });
+  }
+  outlives.Reset();
+  ASSERT_EQ(count, 1);
+}
+
+void test_subscribe_unsubscribe_during_publish()
+{
+  EventBus eventbus;
+  eventbus.Clear();
+
+  int firstCount  = 0;
+  int secondCount = 0;
+  int lateCount	  = 0;
+
+  EventBus::Subscription second;
+  EventBus::Subscription late;
+  auto					 first = eventbus.Subscribe<CharacterDamagedEvent>(
+	[&]([[maybe_unused]] const CharacterDamagedEvent&)
+	{
+	  firstCount++;
+	  if (firstCount == 1)
+	  {
+		second.Reset(); // 뒤에 있는 구독을 해지 — 이번 발행부터 받지 않아야 한다
+		late = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { lateCount++; });
+	  }
+	});
+  second = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { secondCount++; });
+
+  MockCharacter character("TestChar");
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
+  ASSERT_EQ(firstCount, 1);
+  ASSERT_EQ(secondCount, 0);
+  ASSERT_EQ(lateCount, 0); // 발행 중 추가된 구독은 다음 발행부터
+
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 80, nullptr, false });
+  ASSERT_EQ(firstCount, 2);
+  ASSERT_EQ(secondCount, 0);
+  ASSERT_EQ(lateCount, 1);
+  ASSERT_EQ(eventbus.GetSubscriberCount<CharacterDamagedEvent>(), std::size_t{ 2 });
+}
+
+void test_batched_subscriber_receives_frame_batch()
+{
+  EventBus eventbus;
+  eventbus.Clear();
+
+  int				 immediateCount = 0;
+  std::vector<int> batchSizes;
+  std::vector<int> damages;
+
+  auto immediate = eventbus.Subscribe<CharacterDamagedEvent>([&]([[maybe_unused]] const CharacterDamagedEvent&) { immediateCount++; });
+  auto batched	 = eventbus.SubscribeBatched<CharacterDamagedEvent>(
+	  [&](const EventBatch<CharacterDamagedEvent>& batch)
+	  {
+		batchSizes.push_back(static_cast<int>(batch.size()));
+		for (const CharacterDamagedEvent& e : batch)
+		  damages.push_back(e.damageAmount);
+		// 전달 중에 발행된 이벤트는 다음 DispatchDeferred 로 넘어간다
+		if (batchSizes.size() == 1)
+		  eventbus.Publish(CharacterDamagedEvent{ nullptr, 99, 0, nullptr, false });
+	  });
+
+  MockCharacter character("TestChar");
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 10, 90, nullptr, false });
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 20, 70, nullptr, false });
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 30, 40, nullptr, false });
+
+  ASSERT_EQ(immediateCount, 3);
+  ASSERT_TRUE(batchSizes.empty());
+  ASSERT_EQ(eventbus.GetQueuedEventCount(), std::size_t{ 3 });
+
+  eventbus.DispatchDeferred();
+  ASSERT_EQ(static_cast<int>(batchSizes.size()), 1);
+  ASSERT_EQ(batchSizes[0], 3);
+  ASSERT_EQ(damages[2], 30);
+  ASSERT_EQ(eventbus.GetQueuedEventCount(), std::size_t{ 1 });
+
+  eventbus.DispatchDeferred();
+  ASSERT_EQ(static_cast<int>(batchSizes.size()), 2);
+  ASSERT_EQ(damages.back(), 99);
+
+  // 지연을 끄면 묶음 구독자도 바로 받는다
+  eventbus.SetDeferred(false);
+  eventbus.Publish(CharacterDamagedEvent{ reinterpret_cast<Character*>(&character), 5, 35, nullptr, false });
+  ASSERT_EQ(static_cast<int>(batchSizes.size()), 3);
+  ASSERT_EQ(batchSizes.back(), 1);
+}
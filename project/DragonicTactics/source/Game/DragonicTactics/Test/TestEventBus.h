@@ -10,5 +10,8 @@ void test_multiple_subscribers_sameEvent();
 void test_multiple_different_events();
 void test_EventData_CompleteTransfer();
 void test_EventData_MultiplePublishes();
+void test_subscription_handle_unsubscribes();
+void test_subscribe_unsubscribe_during_publish();
+void test_batched_subscriber_receives_frame_batch();
 
 extern bool TestEventBus;
\ No newline at end of file
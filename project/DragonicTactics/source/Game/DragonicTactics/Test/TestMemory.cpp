@@ -5,10 +5,21 @@
  * \copyright DigiPen Institute of Technology
  */
 #include "TestMemory.h"
+#include "./Engine/AllocationTracker.h"
 #include "Game/DragonicTactics/Factories/CharacterFactory.h"
 #include "Game/DragonicTactics/Objects/Character.h"
+#include "Game/DragonicTactics/Objects/Components/GridPosition.h"
+#include "Game/DragonicTactics/Objects/Components/StatsComponent.h"
+#include "Game/DragonicTactics/StateComponents/CombatSystem.h"
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
+#include "Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "Game/DragonicTactics/StateComponents/MapDataRegistry.h"
+#include "Game/DragonicTactics/StateComponents/SpellSystem.h"
+#include "Game/DragonicTactics/StateComponents/TurnManager.h"
 #include "TestAssert.h"
 #include "pch.h"
+#include <algorithm>
+#include <iostream>
 #include <memory>
 
 void TestOwnershipTransfer()
@@ -44,4 +55,179 @@ void TestUnloadNoLeak()
   go_manager->Unload();
 
   ASSERT_TRUE(go_manager->GetAllRaw().size() == 0);
-}
\ No newline at end of file
+}
+bool TestLavaDeathEventsOutliveDestroy()
+{
+  auto& gs		   = Engine::GetGameStateManager();
+  auto* go_manager = gs.GetGSComponent<CS230::GameObjectManager>();
+  auto* grid	   = gs.GetGSComponent<GridSystem>();
+  auto* bus		   = gs.GetGSComponent<EventBus>();
+  auto* spells	   = gs.GetGSComponent<SpellSystem>();
+  if (!go_manager || !grid || !bus || !spells || !gs.GetGSComponent<CombatSystem>())
+  {
+	Engine::GetLogger().LogEvent("TestLavaDeathEventsOutliveDestroy: components aren't uploaded!");
+	return false;
+  }
+
+  // 파이터가 HP 1 로 용암 한 칸을 밟는다 — 이동 중 피해/사망/Destroy 가 모두 UpdateAll 안에서 일어난다
+  grid->Reset();
+  grid->SetTileType({ 1, 0 }, GridSystem::TileType::Lava);
+  spells->SetTerrainEffects({ TerrainEffect{ { { 1, 0 } }, 10, 0, 3 } });
+
+  auto	   character = CharacterFactory::Create(CharacterTypes::Fighter, { 0, 0 });
+  Character* fighter	 = character.get();
+  fighter->SetGridSystem(grid);
+  go_manager->Add(std::move(character));
+  grid->AddCharacter(fighter, { 0, 0 });
+  fighter->SetHP(1);
+
+  // GamePlay 의 묶음 구독자처럼 전달 시점에 캐릭터를 읽는다
+  std::string damaged_name;
+  std::string died_name;
+  int		  damaged_max_hp = 0;
+  Math::ivec2 damaged_tile{ -1, -1 };
+  auto		  on_damaged = bus->SubscribeBatched<CharacterDamagedEvent>(
+	  [&](const EventBatch<CharacterDamagedEvent>& batch)
+	  {
+		for (const CharacterDamagedEvent& e : batch)
+		{
+		  damaged_name	 = e.target->TypeName();
+		  damaged_max_hp = e.target->GetStatsComponent()->GetMaxHP();
+		  damaged_tile	 = e.target->GetGridPosition()->Get();
+		}
+	  });
+  auto on_died = bus->SubscribeBatched<CharacterDeathEvent>(
+	  [&](const EventBatch<CharacterDeathEvent>& batch)
+	  {
+		for (const CharacterDeathEvent& e : batch)
+		  died_name = e.character->TypeName();
+	  });
+
+  fighter->SetPath({ { 1, 0 } });
+  for (int frame = 0; frame < 10 && !go_manager->GetAllRaw().empty(); ++frame)
+	go_manager->UpdateAll(1.0 / 30.0);
+  const bool removed = go_manager->GetAllRaw().empty();
+
+  // 다음 프레임 시작 — GamePlay::Update 와 같은 순서로 전달 후 갱신
+  bus->DispatchDeferred();
+  go_manager->UpdateAll(1.0 / 30.0);
+
+  spells->SetTerrainEffects({});
+  go_manager->Unload();
+  grid->Reset();
+
+  ASSERT_TRUE(removed);
+  ASSERT_TRUE(damaged_name == "Fighter" && died_name == "Fighter");
+  ASSERT_TRUE(damaged_max_hp == 90 && damaged_tile == Math::ivec2{ 1, 0 });
+  return removed && damaged_name == "Fighter" && died_name == "Fighter" && damaged_max_hp == 90 && damaged_tile == Math::ivec2{ 1, 0 };
+}
+
+bool TestBattleFrameAllocationBudget()
+{
+  auto& gs		   = Engine::GetGameStateManager();
+  auto* go_manager = gs.GetGSComponent<CS230::GameObjectManager>();
+  auto* grid	   = gs.GetGSComponent<GridSystem>();
+  auto* bus		   = gs.GetGSComponent<EventBus>();
+  auto* turn_mgr   = gs.GetGSComponent<TurnManager>();
+  auto* maps	   = gs.GetGSComponent<MapDataRegistry>();
+  if (!go_manager || !grid || !bus || !turn_mgr || !maps)
+  {
+	Engine::GetLogger().LogEvent("TestBattleFrameAllocationBudget: battle components aren't uploaded!");
+	return false;
+  }
+  if (!CS230::AllocationTracker::IsCompiledIn())
+  {
+	Engine::GetLogger().LogEvent("TestBattleFrameAllocationBudget: skipped (allocation tracking compiled out)");
+	return true;
+  }
+
+  // 드래곤 vs 파이터, 드래곤 턴의 이동 모드에서 마우스가 타일 위를 옮겨 다니는 상태
+  maps->LoadMaps("Assets/Data/maps.json");
+  const MapData map_data = maps->GetMapData("first_map");
+  grid->LoadMap(map_data);
+  std::vector<Character*> order;
+  for (const auto& [name, type] : { std::pair{ "dragon", CharacterTypes::Dragon }, std::pair{ "fighter", CharacterTypes::Fighter } })
+  {
+	const auto it = map_data.spawn_points.find(name);
+	if (it == map_data.spawn_points.end())
+	  continue;
+	auto	   character = CharacterFactory::Create(type, it->second);
+	Character* raw		 = character.get();
+	raw->SetGridSystem(grid);
+	go_manager->Add(std::move(character));
+	grid->AddCharacter(raw, it->second);
+	order.push_back(raw);
+  }
+  ASSERT_TRUE(order.size() == 2);
+  if (order.size() != 2)
+	return false;
+
+  turn_mgr->SetEventBus(bus);
+  turn_mgr->InitializeTurnOrder(order);
+  turn_mgr->StartCombat();
+  Character*		current = turn_mgr->GetCurrentCharacter();
+  const Math::ivec2 source	= current->GetGridPosition()->Get();
+  grid->EnableMovementMode(source, current->GetMovementRange());
+  const ReachableTiles&	   reachable = grid->ComputeReachable(source, current->GetMovementRange());
+  std::vector<Math::ivec2> hovers(reachable.tiles.begin(), reachable.tiles.end());
+  if (hovers.empty())
+	hovers.push_back(source);
+
+  // 상대(AI) 쪽 공격 위치 경로 — 전략의 이동 탐색처럼 위치마다 FindPath (도달 불가 위치는 오류 로그를 남기니 뺀다)
+  constexpr int			   AI_LAVA_PENALTY = 2; // FighterStrategy / DragonStrategy 의 LAVA_TILE_PENALTY
+  Character*			   opponent		   = order[0] == current ? order[1] : order[0];
+  const Math::ivec2		   ai_source	   = opponent->GetGridPosition()->Get();
+  std::vector<Math::ivec2> attack_positions;
+  for (const Math::ivec2 offset : { Math::ivec2{ 0, 1 }, Math::ivec2{ 0, -1 }, Math::ivec2{ -1, 0 }, Math::ivec2{ 1, 0 } })
+  {
+	const Math::ivec2 target = source + offset;
+	if (grid->IsValidTile(target) && grid->IsWalkable(target) && grid->GetPathCost(ai_source, target, AI_LAVA_PENALTY) > 0)
+	  attack_positions.push_back(target);
+  }
+  ASSERT_TRUE(!attack_positions.empty());
+
+  // GamePlay::Update 의 프레임 작업 (표시 이벤트 전달, 오브젝트 갱신) + 호버 경로 + AI 경로
+  constexpr int	   WARMUP_FRAMES   = 30;
+  constexpr int	   MEASURED_FRAMES = 120;
+  constexpr double FRAME_DT		   = 1.0 / 60.0;
+  std::size_t	   hover_index	   = 0;
+  auto			   run_frame	   = [&]()
+  {
+	bus->DispatchDeferred();
+	go_manager->UpdateAll(FRAME_DT);
+	const std::vector<Math::ivec2> path = grid->GetMovementPath(hovers[hover_index++ % hovers.size()]);
+	static_cast<void>(path);
+	for (const Math::ivec2& target : attack_positions)
+	{
+	  const std::vector<Math::ivec2> ai_path = grid->FindPath(ai_source, target, AI_LAVA_PENALTY);
+	  static_cast<void>(ai_path);
+	}
+  };
+  for (int i = 0; i < WARMUP_FRAMES; ++i)
+	run_frame();
+
+  std::uint64_t							 worst = 0;
+  CS230::AllocationTracker::TagCounters worst_frame{};
+  for (int i = 0; i < MEASURED_FRAMES; ++i)
+  {
+	const CS230::AllocationTracker::TagCounters before = CS230::AllocationTracker::ThisThread();
+	run_frame();
+	const CS230::AllocationTracker::TagCounters frame = CS230::AllocationTracker::Difference(CS230::AllocationTracker::ThisThread(), before);
+	const std::uint64_t							allocations = CS230::AllocationTracker::Sum(frame).allocations;
+	if (allocations > worst)
+	{
+	  worst		  = allocations;
+	  worst_frame = frame;
+	}
+  }
+
+  std::cout << " [frame allocations] worst=" << worst << " budget=" << BattleFrameAllocationBudget;
+  for (std::size_t i = 0; i < CS230::AllocationTracker::TAG_COUNT; ++i)
+	std::cout << ' ' << CS230::AllocationTracker::TagName(static_cast<CS230::AllocationTag>(i)) << '=' << worst_frame[i].allocations;
+  std::cout << std::endl;
+
+  grid->DisableMovementMode();
+  turn_mgr->EndCombat();
+  go_manager->Unload();
+  return ASSERT_TRUE(worst <= static_cast<std::uint64_t>(std::max(BattleFrameAllocationBudget, 0)));
+}
@@ -6,6 +6,10 @@
  */
 #pragma once
 extern bool TestMemory;
+extern bool TestFrameAllocations;
+extern int	BattleFrameAllocationBudget; // 정상 상태 전투 프레임 하나에 허용하는 할당 수
 
 void TestOwnershipTransfer();
-void TestUnloadNoLeak();
\ No newline at end of file
+void TestUnloadNoLeak();
+bool TestLavaDeathEventsOutliveDestroy();
+bool TestBattleFrameAllocationBudget();
\ No newline at end of file
@@ -0,0 +1,745 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "TestPathfindingBenchmark.h"
+
+#include "./Engine/Engine.h"
+#include "./Engine/GameStateManager.h"
+#include "./Engine/Logger.h"
+#include "./Engine/Timer.h"
+
+#include "./Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "./Game/DragonicTactics/StateComponents/MapDataRegistry.h"
+#include "./Game/DragonicTactics/StateComponents/PathfindingEngine.h"
+#include "./Game/DragonicTactics/Test/TestAssert.h"
+#include <algorithm>
+#include <bit>
+#include <queue>
+#include <random>
+#include <set>
+
+namespace
+{
+  struct RefNode
+  {
+	Math::ivec2 position;
+	int			gCost;
+	int			hCost;
+	RefNode*	parent;
+
+	int fCost() const
+	{
+	  return gCost + hCost;
+	}
+  };
+
+  bool IsPassable(const GridSystem& grid, Math::ivec2 pos)
+  {
+	GridSystem::TileType type = grid.GetTileType(pos);
+	return (type == GridSystem::TileType::Empty || type == GridSystem::TileType::Lava) && !grid.IsOccupied(pos);
+  }
+
+  struct QueryPair
+  {
+	Math::ivec2 start;
+	Math::ivec2 goal;
+  };
+
+  /// 같은 질의 목록을 기존 구현/새 엔진으로 각각 돌려 시간과 경로 일치 여부를 출력
+  bool RunComparison(const std::string& label, const GridSystem& grid, const std::vector<QueryPair>& queries, int lava_penalty)
+  {
+	std::vector<std::vector<Math::ivec2>> reference_paths;
+	reference_paths.reserve(queries.size());
+
+	util::Timer timer;
+	for (const QueryPair& q : queries)
+	{
+	  reference_paths.push_back(ReferenceFindPath(grid, q.start, q.goal, lava_penalty));
+	}
+	const double reference_seconds = timer.GetElapsedSeconds();
+
+	PathfindingEngine		 engine;
+	std::vector<Math::ivec2> path;
+	int						 mismatches = 0;
+	double					 engine_seconds = 0.0;
+
+	timer.ResetTimeStamp();
+	for (std::size_t i = 0; i < queries.size(); ++i)
+	{
+	  engine.FindPath(grid, queries[i].start, queries[i].goal, lava_penalty, path);
+	  if (path != reference_paths[i])
+		++mismatches;
+	}
+	engine_seconds = timer.GetElapsedSeconds();
+
+	const double speedup = engine_seconds > 0.0 ? reference_seconds / engine_seconds : 0.0;
+	std::cout << " [" << label << "] queries=" << queries.size() << " penalty=" << lava_penalty << " reference=" << reference_seconds * 1000.0 << "ms"
+			  << " engine=" << engine_seconds * 1000.0 << "ms" << " speedup=x" << speedup << " mismatches=" << mismatches << std::endl;
+
+	return ASSERT_EQ(mismatches, 0);
+  }
+
+  /// 경로 비용 (칸당 1 + 용암 패널티) — 계층/평면 경로 품질 비교용
+  int PathCost(const GridSystem& grid, const std::vector<Math::ivec2>& path, int lava_penalty)
+  {
+	int cost = 0;
+	for (const Math::ivec2& tile : path)
+	  cost += 1 + (lava_penalty > 0 && grid.GetTileType(tile) == GridSystem::TileType::Lava ? lava_penalty : 0);
+	return cost;
+  }
+
+  /// 비트셋 엔진 이전의 GetReachableTiles (std::set visited + std::queue, 매 타일 GetNeighbors)
+  std::vector<Math::ivec2> ReferenceReachableTiles(const GridSystem& grid, Math::ivec2 start, int max_distance)
+  {
+	std::vector<Math::ivec2>				reachable;
+	std::queue<std::pair<Math::ivec2, int>> queue;
+	std::set<Math::ivec2>					visited;
+
+	queue.push({ start, 0 });
+	visited.insert(start);
+	while (!queue.empty())
+	{
+	  auto [current_pos, distance] = queue.front();
+	  queue.pop();
+	  if (current_pos != start)
+		reachable.push_back(current_pos);
+	  if (distance >= max_distance)
+		continue;
+	  for (const auto& neighbor : grid.GetNeighbors(current_pos))
+	  {
+		if (visited.find(neighbor) == visited.end() && IsPassable(grid, neighbor))
+		{
+		  visited.insert(neighbor);
+		  queue.push({ neighbor, distance + 1 });
+		}
+	  }
+	}
+	return reachable;
+  }
+
+  /// 평면 저장소 이전의 GridSystem 조회 방식 (행별 vector) — BenchmarkGridQueries 비교용
+  struct NestedGrid
+  {
+	int											   width  = 0;
+	int											   height = 0;
+	std::vector<std::vector<GridSystem::TileType>> tiles;
+	std::vector<std::vector<Character*>>		   characters;
+
+	bool IsValidTile(Math::ivec2 pos) const
+	{
+	  return pos.x >= 0 && pos.x < width && pos.y >= 0 && pos.y < height;
+	}
+
+	GridSystem::TileType GetTileType(Math::ivec2 pos) const
+	{
+	  if (!IsValidTile(pos))
+		return GridSystem::TileType::Invalid;
+	  return tiles[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)];
+	}
+
+	bool IsOccupied(Math::ivec2 pos) const
+	{
+	  if (!IsValidTile(pos))
+		return true;
+	  return characters[static_cast<std::size_t>(pos.y)][static_cast<std::size_t>(pos.x)] != nullptr;
+	}
+
+	bool IsWalkable(Math::ivec2 pos) const
+	{
+	  return GetTileType(pos) == GridSystem::TileType::Empty && !IsOccupied(pos);
+	}
+  };
+}
+
+std::vector<Math::ivec2> ReferenceFindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty)
+{
+  std::vector<RefNode*>					  openSet;
+  std::vector<RefNode*>					  closedSet;
+  std::map<std::pair<int, int>, RefNode*> allNodes;
+
+  RefNode* startNode = new RefNode{ start, 0, grid.ManhattanDistance(start, goal), nullptr };
+  openSet.push_back(startNode);
+  allNodes[{ start.x, start.y }] = startNode;
+
+  RefNode* goalNode = nullptr;
+
+  while (!openSet.empty())
+  {
+	auto minIt = std::min_element(std::begin(openSet), std::end(openSet), [](RefNode* a, RefNode* b) { return a->fCost() < b->fCost(); });
+
+	RefNode* current = *minIt;
+	openSet.erase(minIt);
+	closedSet.push_back(current);
+
+	if (current->position == goal)
+	{
+	  goalNode = current;
+	  break;
+	}
+
+	for (const Math::ivec2& neighborPos : grid.GetNeighbors(current->position))
+	{
+	  if (!IsPassable(grid, neighborPos))
+		continue;
+
+	  bool inClosedSet = false;
+	  for (RefNode* closed : closedSet)
+	  {
+		if (closed->position == neighborPos)
+		{
+		  inClosedSet = true;
+		  break;
+		}
+	  }
+	  if (inClosedSet)
+		continue;
+
+	  int tile_cost = 1 + (lava_penalty > 0 && grid.GetTileType(neighborPos) == GridSystem::TileType::Lava ? lava_penalty : 0);
+	  int newGCost	= current->gCost + tile_cost;
+
+	  auto nodeKey = std::make_pair(neighborPos.x, neighborPos.y);
+	  auto nodeIt  = allNodes.find(nodeKey);
+	  if (nodeIt == allNodes.end())
+	  {
+		RefNode* neighborNode = new RefNode{ neighborPos, newGCost, grid.ManhattanDistance(neighborPos, goal), current };
+		openSet.push_back(neighborNode);
+		allNodes[nodeKey] = neighborNode;
+	  }
+	  else
+	  {
+		RefNode* neighborNode = nodeIt->second;
+		bool	 inOpen		  = std::find(openSet.begin(), openSet.end(), neighborNode) != openSet.end();
+		if (inOpen && newGCost < neighborNode->gCost)
+		{
+		  neighborNode->gCost  = newGCost;
+		  neighborNode->parent = current;
+		}
+	  }
+	}
+  }
+
+  std::vector<Math::ivec2> path;
+  for (RefNode* node = goalNode; node != nullptr; node = node->parent)
+  {
+	if (node->position != start)
+	  path.push_back(node->position);
+  }
+  std::reverse(path.begin(), path.end());
+
+  for (auto& pair : allNodes)
+  {
+	delete pair.second;
+  }
+  return path;
+}
+
+MapData MakeRandomPathfindingMap(int width, int height, unsigned seed)
+{
+  MapData map;
+  map.id	 = "procedural_" + std::to_string(width) + "x" + std::to_string(height) + "_" + std::to_string(seed);
+  map.name	 = map.id;
+  map.width	 = width;
+  map.height = height;
+  map.legend = {
+	{ '#',  "wall" },
+	{ '.', "floor" },
+	{ 'L',  "lava" },
+	{ '~', "water" }
+  };
+
+  std::mt19937						  rng(seed);
+  std::uniform_int_distribution<int> roll(0, 99);
+  for (int y = 0; y < height; ++y)
+  {
+	std::string row(static_cast<std::size_t>(width), '.');
+	for (char& c : row)
+	{
+	  int r = roll(rng);
+	  if (r < 25)
+		c = '#';
+	  else if (r < 35)
+		c = 'L';
+	  else if (r < 38)
+		c = '~';
+	}
+	map.tiles.push_back(row);
+  }
+  return map;
+}
+
+bool BenchmarkPathfindingJsonMaps()
+{
+  MapDataRegistry registry;
+  registry.LoadMaps("Assets/Data/maps.json");
+
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  bool passed = true;
+  for (const std::string& map_id : registry.GetAllMapIds())
+  {
+	gridsys->LoadMap(registry.GetMapData(map_id));
+
+	// 통과 가능한 모든 (start, goal) 쌍
+	std::vector<Math::ivec2> passable;
+	for (int y = 0; y < gridsys->GetHeight(); ++y)
+	  for (int x = 0; x < gridsys->GetWidth(); ++x)
+		if (IsPassable(*gridsys, { x, y }))
+		  passable.push_back({ x, y });
+
+	std::vector<QueryPair> queries;
+	for (Math::ivec2 s : passable)
+	  for (Math::ivec2 g : passable)
+		if (s != g)
+		  queries.push_back({ s, g });
+
+	passed = RunComparison(map_id, *gridsys, queries, 0) && passed;
+	passed = RunComparison(map_id, *gridsys, queries, 2) && passed;
+  }
+
+  std::cout << "Benchmark_Pathfinding_JsonMaps " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkPathfindingProcedural256()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int	 kSize		 = 256;
+  constexpr int	 kQueries	 = 200;
+  constexpr int	 kMinSteps	 = 16;
+  constexpr int	 kMaxSteps	 = 48; // 기존 구현은 closed 선형 탐색이라 먼 쌍은 비교가 끝나지 않는다
+  constexpr unsigned kSeeds[] = { 1u, 2u, 3u };
+
+  bool passed = true;
+  for (unsigned seed : kSeeds)
+  {
+	gridsys->LoadMap(MakeRandomPathfindingMap(kSize, kSize, seed));
+
+	// 질의 쌍 선택: 무작위 시작점에서 BFS 로 kMinSteps~kMaxSteps 걸음 거리의 도착점을 고른다
+	std::mt19937					   rng(seed * 7919u);
+	std::uniform_int_distribution<int> coord(0, kSize - 1);
+	std::vector<QueryPair>			   queries;
+	std::vector<int>				   dist(static_cast<std::size_t>(kSize * kSize));
+	while (static_cast<int>(queries.size()) < kQueries)
+	{
+	  Math::ivec2 start{ coord(rng), coord(rng) };
+	  if (!IsPassable(*gridsys, start))
+		continue;
+
+	  std::fill(dist.begin(), dist.end(), -1);
+	  std::queue<Math::ivec2>  frontier;
+	  std::vector<Math::ivec2> candidates;
+	  dist[static_cast<std::size_t>(start.y * kSize + start.x)] = 0;
+	  frontier.push(start);
+	  while (!frontier.empty())
+	  {
+		Math::ivec2 cur = frontier.front();
+		frontier.pop();
+		int d = dist[static_cast<std::size_t>(cur.y * kSize + cur.x)];
+		if (d >= kMinSteps)
+		  candidates.push_back(cur);
+		if (d == kMaxSteps)
+		  continue;
+		for (const Math::ivec2& n : gridsys->GetNeighbors(cur))
+		{
+		  std::size_t idx = static_cast<std::size_t>(n.y * kSize + n.x);
+		  if (dist[idx] < 0 && IsPassable(*gridsys, n))
+		  {
+			dist[idx] = d + 1;
+			frontier.push(n);
+		  }
+		}
+	  }
+	  if (candidates.empty())
+		continue;
+
+	  std::uniform_int_distribution<std::size_t> pick(0, candidates.size() - 1);
+	  queries.push_back({ start, candidates[pick(rng)] });
+	}
+
+	const std::string label = "procedural 256x256 seed " + std::to_string(seed);
+	passed					= RunComparison(label, *gridsys, queries, 0) && passed;
+	passed					= RunComparison(label, *gridsys, queries, 2) && passed;
+  }
+
+  std::cout << "Benchmark_Pathfinding_Procedural256 " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkGridQueries()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int kSize	 = 1024;
+  constexpr int kQueries = 4'000'000;
+  gridsys->LoadMap(MakeRandomPathfindingMap(kSize, kSize, 11u));
+
+  // 같은 내용을 행별 vector 로 복사 (캐릭터 자리는 더미 포인터로 표시만 한다)
+  NestedGrid nested;
+  nested.width	= kSize;
+  nested.height = kSize;
+  nested.tiles.assign(kSize, std::vector<GridSystem::TileType>(kSize, GridSystem::TileType::Empty));
+  nested.characters.assign(kSize, std::vector<Character*>(kSize, nullptr));
+  for (int y = 0; y < kSize; ++y)
+	for (int x = 0; x < kSize; ++x)
+	  nested.tiles[static_cast<std::size_t>(y)][static_cast<std::size_t>(x)] = gridsys->GetTileType({ x, y });
+
+  // 질의 좌표: 일부는 맵 밖 (IsValidTile 분기 포함)
+  std::mt19937					   rng(5u);
+  std::uniform_int_distribution<int> coord(-8, kSize + 7);
+  std::vector<Math::ivec2>		   queries(kQueries);
+  for (Math::ivec2& q : queries)
+	q = { coord(rng), coord(rng) };
+
+  util::Timer timer;
+  long long	  nested_sum = 0;
+  for (const Math::ivec2& q : queries)
+	nested_sum += (nested.IsWalkable(q) ? 1 : 0) + (nested.IsOccupied(q) ? 2 : 0) + static_cast<int>(nested.GetTileType(q));
+  const double nested_seconds = timer.GetElapsedSeconds();
+
+  timer.ResetTimeStamp();
+  long long flat_sum = 0;
+  for (const Math::ivec2& q : queries)
+	flat_sum += (gridsys->IsWalkable(q) ? 1 : 0) + (gridsys->IsOccupied(q) ? 2 : 0) + static_cast<int>(gridsys->GetTileType(q));
+  const double flat_seconds = timer.GetElapsedSeconds();
+
+  // 비트보드 워드 단위 집계: 통과 가능 && 비점유 타일 수
+  timer.ResetTimeStamp();
+  int									passable_count = 0;
+  const std::vector<std::uint64_t>& passable	   = gridsys->GetPassableBits().Words();
+  const std::vector<std::uint64_t>& occupied	   = gridsys->GetOccupiedBits().Words();
+  for (std::size_t i = 0; i < passable.size(); ++i)
+	passable_count += std::popcount(passable[i] & ~occupied[i]);
+  const double bitboard_seconds = timer.GetElapsedSeconds();
+
+  int scalar_count = 0;
+  for (int y = 0; y < kSize; ++y)
+	for (int x = 0; x < kSize; ++x)
+	{
+	  GridSystem::TileType type = nested.GetTileType({ x, y });
+	  if ((type == GridSystem::TileType::Empty || type == GridSystem::TileType::Lava) && !nested.IsOccupied({ x, y }))
+		++scalar_count;
+	}
+
+  std::cout << " [grid queries 1024x1024] queries=" << kQueries << " nested=" << nested_seconds * 1000.0 << "ms" << " flat=" << flat_seconds * 1000.0 << "ms"
+			<< " speedup=x" << (flat_seconds > 0.0 ? nested_seconds / flat_seconds : 0.0) << std::endl;
+  std::cout << " [passable count] bitboard=" << bitboard_seconds * 1000.0 << "ms count=" << passable_count << std::endl;
+
+  bool passed = ASSERT_EQ(flat_sum, nested_sum);
+  passed		= ASSERT_EQ(passable_count, scalar_count) && passed;
+  gridsys->Reset();
+  std::cout << "Benchmark_GridQueries " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkReachability()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int kSize	 = 256;
+  constexpr int kQueries = 2000;
+  constexpr int kRanges[] = { 5, 12, 30 };
+  gridsys->LoadMap(MakeRandomPathfindingMap(kSize, kSize, 21u));
+
+  std::mt19937					   rng(9u);
+  std::uniform_int_distribution<int> coord(0, kSize - 1);
+  std::vector<Math::ivec2>		   starts;
+  while (static_cast<int>(starts.size()) < kQueries)
+  {
+	Math::ivec2 start{ coord(rng), coord(rng) };
+	if (IsPassable(*gridsys, start))
+	  starts.push_back(start);
+  }
+
+  bool passed = true;
+  for (int range : kRanges)
+  {
+	std::vector<std::vector<Math::ivec2>> reference;
+	reference.reserve(starts.size());
+	util::Timer timer;
+	for (const Math::ivec2& start : starts)
+	  reference.push_back(ReferenceReachableTiles(*gridsys, start, range));
+	const double reference_seconds = timer.GetElapsedSeconds();
+
+	int mismatches = 0;
+	timer.ResetTimeStamp();
+	for (std::size_t i = 0; i < starts.size(); ++i)
+	{
+	  if (gridsys->ComputeReachable(starts[i], range).tiles != reference[i])
+		++mismatches;
+	}
+	const double engine_seconds = timer.GetElapsedSeconds();
+
+	timer.ResetTimeStamp();
+	std::size_t weighted_total = 0;
+	for (const Math::ivec2& start : starts)
+	  weighted_total += gridsys->ComputeReachable(start, range, 2).tiles.size();
+	const double weighted_seconds = timer.GetElapsedSeconds();
+
+	std::cout << " [reachability 256x256] range=" << range << " queries=" << kQueries << " reference=" << reference_seconds * 1000.0 << "ms"
+			  << " bitset=" << engine_seconds * 1000.0 << "ms" << " speedup=x" << (engine_seconds > 0.0 ? reference_seconds / engine_seconds : 0.0)
+			  << " weighted(penalty 2)=" << weighted_seconds * 1000.0 << "ms avg_tiles=" << static_cast<double>(weighted_total) / kQueries << " mismatches=" << mismatches
+			  << std::endl;
+	passed = ASSERT_EQ(mismatches, 0) && passed;
+  }
+
+  gridsys->Reset();
+  std::cout << "Benchmark_Reachability " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkHoverPath()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int kSizes[]  = { 64, 256, 1024 };
+  constexpr int kRanges[] = { 6, 20, 40 };
+  constexpr int kHovers	  = 2000;
+
+  bool passed = true;
+  for (int size : kSizes)
+  {
+	gridsys->LoadMap(MakeRandomPathfindingMap(size, size, 31u));
+	std::mt19937					   rng(static_cast<unsigned>(size));
+	std::uniform_int_distribution<int> coord(0, size - 1);
+	Math::ivec2						   source{ size / 2, size / 2 };
+	while (!IsPassable(*gridsys, source))
+	  source = { coord(rng), coord(rng) };
+
+	for (int range : kRanges)
+	{
+	  gridsys->DisableMovementMode();
+	  gridsys->EnableMovementMode(source, range);
+	  const ReachableTiles& reachable = gridsys->ComputeReachable(source, range);
+	  if (reachable.tiles.empty())
+		continue;
+	  std::vector<Math::ivec2> targets(reachable.tiles.begin(), reachable.tiles.end());
+
+	  // 호버 한 번 = 새 타일로 이동 → 경로 갱신
+	  util::Timer timer;
+	  std::size_t astar_total = 0;
+	  for (int i = 0; i < kHovers; ++i)
+		astar_total += gridsys->FindPath(source, targets[static_cast<std::size_t>(i) % targets.size()]).size();
+	  const double astar_seconds = timer.GetElapsedSeconds();
+
+	  timer.ResetTimeStamp();
+	  std::size_t tree_total = 0;
+	  for (int i = 0; i < kHovers; ++i)
+		tree_total += gridsys->GetMovementPath(targets[static_cast<std::size_t>(i) % targets.size()]).size();
+	  const double tree_seconds = timer.GetElapsedSeconds();
+
+	  std::cout << " [hover path " << size << "x" << size << "] range=" << range << " hovers=" << kHovers << " astar=" << astar_seconds * 1e6 / kHovers << "us/hover"
+				<< " tree=" << tree_seconds * 1e6 / kHovers << "us/hover" << std::endl;
+	  passed = ASSERT_EQ(tree_total, astar_total) && passed; // 둘 다 최단 경로 → 길이 합이 같아야 한다
+	}
+	gridsys->DisableMovementMode();
+  }
+
+  gridsys->Reset();
+  std::cout << "Benchmark_HoverPath " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkHierarchicalPathfinding()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int kSizes[]	 = { 512, 1024 };
+  constexpr int kQueries	 = 100;
+  constexpr int kClusterSize = 16;
+
+  bool passed = true;
+  for (int size : kSizes)
+  {
+	MapData map		 = MakeRandomPathfindingMap(size, size, 41u);
+	map.pathfinding	 = "hierarchical";
+	map.cluster_size = kClusterSize;
+
+	util::Timer timer;
+	gridsys->LoadMap(map);
+	const double load_seconds = timer.GetElapsedSeconds();
+
+	std::mt19937					   rng(static_cast<unsigned>(size) + 1u);
+	std::uniform_int_distribution<int> coord(0, size - 1);
+	std::vector<QueryPair>			   queries;
+	while (static_cast<int>(queries.size()) < kQueries)
+	{
+	  QueryPair q{ { coord(rng), coord(rng) }, { coord(rng), coord(rng) } };
+	  if (q.start != q.goal && IsPassable(*gridsys, q.start) && IsPassable(*gridsys, q.goal))
+		queries.push_back(q);
+	}
+
+	for (int penalty : { 0, 2 })
+	{
+	  std::vector<std::vector<Math::ivec2>> flat_paths;
+	  gridsys->SetPathfindingMode(GridSystem::PathfindingMode::Flat);
+	  timer.ResetTimeStamp();
+	  for (const QueryPair& q : queries)
+		flat_paths.push_back(gridsys->FindPath(q.start, q.goal, penalty));
+	  const double flat_seconds = timer.GetElapsedSeconds();
+
+	  timer.ResetTimeStamp();
+	  gridsys->SetPathfindingMode(GridSystem::PathfindingMode::Hierarchical, kClusterSize);
+	  const double build_seconds = timer.GetElapsedSeconds();
+
+	  // 첫 질의에 penalty 별 클러스터 비용이 채워지므로 한 번 돌린 뒤 측정
+	  gridsys->FindPath(queries[0].start, queries[0].goal, penalty);
+	  std::vector<std::vector<Math::ivec2>> hpa_paths;
+	  timer.ResetTimeStamp();
+	  for (const QueryPair& q : queries)
+		hpa_paths.push_back(gridsys->FindPath(q.start, q.goal, penalty));
+	  const double hpa_seconds = timer.GetElapsedSeconds();
+
+	  int	 found_mismatch = 0;
+	  int	 compared		= 0;
+	  double ratio_sum		= 0.0;
+	  double worst_ratio	= 1.0;
+	  for (std::size_t i = 0; i < queries.size(); ++i)
+	  {
+		if (flat_paths[i].empty() != hpa_paths[i].empty())
+		  ++found_mismatch;
+		if (flat_paths[i].empty() || hpa_paths[i].empty())
+		  continue;
+		const double ratio = static_cast<double>(PathCost(*gridsys, hpa_paths[i], penalty)) / PathCost(*gridsys, flat_paths[i], penalty);
+		ratio_sum += ratio;
+		worst_ratio = std::max(worst_ratio, ratio);
+		++compared;
+	  }
+
+	  std::cout << " [hpa " << size << "x" << size << "] penalty=" << penalty << " build=" << build_seconds * 1000.0 << "ms" << " flat=" << flat_seconds * 1000.0 / kQueries
+				<< "ms/q" << " hpa=" << hpa_seconds * 1000.0 / kQueries << "ms/q" << " speedup=x" << (hpa_seconds > 0.0 ? flat_seconds / hpa_seconds : 0.0)
+				<< " cost_ratio(avg/worst)=" << (compared > 0 ? ratio_sum / compared : 0.0) << "/" << worst_ratio << " found_mismatch=" << found_mismatch << std::endl;
+	  passed = ASSERT_EQ(found_mismatch, 0) && passed;
+	}
+
+	// 벽 생성 (CastWalls 와 같은 SetTileType 경로) 후 첫 질의: 바뀐 클러스터만 다시 만든다
+	const int rebuilt_before = gridsys->GetHierarchicalStats().rebuilt_clusters;
+	for (int i = 0; i < 5; ++i)
+	{
+	  Math::ivec2 tile{ coord(rng), coord(rng) };
+	  if (gridsys->GetTileType(tile) == GridSystem::TileType::Empty && !gridsys->IsOccupied(tile))
+		gridsys->SetTileType(tile, GridSystem::TileType::Wall);
+	}
+	timer.ResetTimeStamp();
+	gridsys->FindPath(queries[1].start, queries[1].goal);
+	const double update_seconds = timer.GetElapsedSeconds();
+	const HierarchicalPathfinder::Stats& stats = gridsys->GetHierarchicalStats();
+
+	std::cout << " [hpa " << size << "x" << size << "] load=" << load_seconds * 1000.0 << "ms clusters=" << stats.clusters << " entrances=" << stats.entrances
+			  << " | 5 walls -> rebuilt " << stats.rebuilt_clusters - rebuilt_before << " clusters, first query " << update_seconds * 1000.0 << "ms" << std::endl;
+  }
+
+  gridsys->SetPathfindingMode(GridSystem::PathfindingMode::Flat);
+  gridsys->Reset();
+  std::cout << "Benchmark_HierarchicalPathfinding " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
+
+bool BenchmarkJumpPointSearch()
+{
+  GridSystem* gridsys = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+  if (!gridsys)
+  {
+	Engine::GetLogger().LogEvent("GridSystem isn't uploaded!");
+	return false;
+  }
+
+  constexpr int kSizes[]	= { 64, 256, 1024 };
+  constexpr int kQueries = 50;
+
+  PathfindingEngine		   astar;
+  PathfindingEngine		   jps;
+  std::vector<Math::ivec2> path;
+  bool					   passed = true;
+  for (int size : kSizes)
+  {
+	for (bool open_field : { true, false })
+	{
+	  // open_field: 장애물 없는 맵 (JPS 최선), 아니면 무작위 벽 25%
+	  MapData map = MakeRandomPathfindingMap(size, size, 51u);
+	  if (open_field)
+	  {
+		for (std::string& row : map.tiles)
+		  row.assign(row.size(), '.');
+	  }
+	  gridsys->LoadMap(map);
+
+	  std::mt19937					   rng(static_cast<unsigned>(size));
+	  std::uniform_int_distribution<int> coord(0, size - 1);
+	  std::vector<QueryPair>			   queries;
+	  while (static_cast<int>(queries.size()) < kQueries)
+	  {
+		QueryPair q{ { coord(rng), coord(rng) }, { coord(rng), coord(rng) } };
+		if (q.start != q.goal && IsPassable(*gridsys, q.start) && IsPassable(*gridsys, q.goal))
+		  queries.push_back(q);
+	  }
+
+	  std::vector<std::size_t> lengths;
+	  long long				   astar_expanded = 0;
+	  util::Timer			   timer;
+	  for (const QueryPair& q : queries)
+	  {
+		astar.FindPath(*gridsys, q.start, q.goal, 0, path);
+		lengths.push_back(path.size());
+		astar_expanded += astar.GetLastExpandedCount();
+	  }
+	  const double astar_seconds = timer.GetElapsedSeconds();
+
+	  int		length_mismatches = 0;
+	  long long jps_expanded		= 0;
+	  timer.ResetTimeStamp();
+	  for (std::size_t i = 0; i < queries.size(); ++i)
+	  {
+		jps.FindPathJumpPoint(*gridsys, queries[i].start, queries[i].goal, path);
+		jps_expanded += jps.GetLastExpandedCount();
+		if (path.size() != lengths[i])
+		  ++length_mismatches;
+	  }
+	  const double jps_seconds = timer.GetElapsedSeconds();
+
+	  std::cout << " [jps " << size << "x" << size << (open_field ? " open" : " walls") << "] astar=" << astar_seconds * 1000.0 / kQueries << "ms/q (expanded "
+				<< astar_expanded / kQueries << ") jps=" << jps_seconds * 1000.0 / kQueries << "ms/q (expanded " << jps_expanded / kQueries << ")"
+				<< " speedup=x" << (jps_seconds > 0.0 ? astar_seconds / jps_seconds : 0.0) << " length_mismatches=" << length_mismatches << std::endl;
+	  passed = ASSERT_EQ(length_mismatches, 0) && passed;
+	}
+  }
+
+  gridsys->Reset();
+  std::cout << "Benchmark_JumpPointSearch " << (passed ? "passed" : "failed") << std::endl;
+  return passed;
+}
@@ -0,0 +1,29 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+#include "./Engine/Vec2.h"
+#include <vector>
+
+class GridSystem;
+struct MapData;
+
+/// @brief 엔진 교체 이전의 FindPath 구현 (vector open set + min_element, 매 노드 new)
+///        새 엔진과 경로가 완전히 같은지 비교하는 기준. 유효성 검사/로그는 하지 않는다.
+std::vector<Math::ivec2> ReferenceFindPath(const GridSystem& grid, Math::ivec2 start, Math::ivec2 goal, int lava_penalty);
+
+/// @brief 시드 고정 난수로 만든 벽/용암 맵 (벤치마크, 비교 테스트용)
+MapData MakeRandomPathfindingMap(int width, int height, unsigned seed);
+
+bool BenchmarkPathfindingJsonMaps();
+bool BenchmarkPathfindingProcedural256();
+bool BenchmarkGridQueries();
+bool BenchmarkReachability();
+bool BenchmarkHoverPath();
+bool BenchmarkHierarchicalPathfinding();
+bool BenchmarkJumpPointSearch();
+
+extern bool TestPathfindingBench;
@@ -25,6 +25,7 @@ Created:    May 6, 2025
 #include "Game/DragonicTactics/States/RenderingTest.h"
 #include "OpenGL/Environment.h"
 #include "States.h"
+#include <SDL.h>
 
 // (0.0 = 0%, 1.0 = 100%)
 namespace
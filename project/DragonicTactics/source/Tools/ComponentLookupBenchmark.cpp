@@ -0,0 +1,146 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Engine/ComponentManager.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+// ComponentManager 조회 마이크로 벤치마크
+//   dragonic_component_bench [--counts 4,12,32] [--iterations N] [--out file.csv]
+// 컴포넌트 N 개를 가진 매니저에서 GetComponent<T> (타입 번호 표) 와 FindComponentPolymorphic<T> (dynamic_cast 선형 탐색) 를
+// 맨 앞 / 맨 뒤 / 없는 타입 / 기반 타입(파생으로 등록) 조회로 나눠 재고 CSV (components,metric,iterations,total_ms,per_op_ns) 로 출력한다.
+// GamePlay 의 GS 컴포넌트는 14 개 안팎이다.
+namespace
+{
+  struct Options
+  {
+	std::vector<int> counts		= { 4, 12, 32 };
+	long long		 iterations = 10'000'000;
+	std::string		 out_path;
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg		  = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--counts" && has_value)
+	  {
+		options.counts.clear();
+		std::stringstream list(argv[++i]);
+		std::string		  item;
+		while (std::getline(list, item, ','))
+		  options.counts.push_back(std::clamp(std::stoi(item), 1, 64));
+	  }
+	  else if (arg == "--iterations" && has_value)
+		options.iterations = std::max(1LL, std::stoll(argv[++i]));
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else
+	  {
+		std::cerr << "usage: dragonic_component_bench [--counts 4,12,32] [--iterations N] [--out file.csv]\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+
+  // 서로 다른 컴포넌트 타입 64 개 (실제 GS 컴포넌트와 같이 가상 함수 표만 가진 작은 객체)
+  template <int N>
+  class BenchComponent : public CS230::Component
+  {
+  };
+
+  class BenchBase : public CS230::Component
+  {
+  };
+
+  class BenchDerived : public BenchBase
+  {
+  };
+
+  class BenchMissing : public CS230::Component
+  {
+  };
+
+  volatile std::uintptr_t g_sink = 0;
+
+  template <int... N>
+  void AddComponents(CS230::ComponentManager& manager, int count, std::integer_sequence<int, N...>)
+  {
+	((N < count ? manager.AddComponent(new BenchComponent<N>()) : void()), ...);
+  }
+
+  template <typename Lookup>
+  void Measure(std::ostream& csv, int count, const char* metric, long long iterations, Lookup&& lookup)
+  {
+	std::uintptr_t sink	 = 0;
+	const auto	   start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < iterations; ++i)
+	  sink += reinterpret_cast<std::uintptr_t>(lookup());
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	csv << count << ',' << metric << ',' << iterations << ',' << ms << ',' << ms * 1e6 / static_cast<double>(iterations) << '\n';
+	g_sink = sink; // 최적화로 조회가 사라지지 않도록
+  }
+
+  void Run(const Options& options, std::ostream& csv)
+  {
+	csv << "components,metric,iterations,total_ms,per_op_ns\n";
+	for (const int count : options.counts)
+	{
+	  CS230::ComponentManager manager;
+	  AddComponents(manager, count, std::make_integer_sequence<int, 64>{});
+	  manager.AddComponent(new BenchDerived()); // 맨 뒤 — 선형 탐색의 최악
+
+	  const long long n = options.iterations;
+	  Measure(csv, count, "first_table", n, [&] { return manager.GetComponent<BenchComponent<0>>(); });
+	  Measure(csv, count, "first_scan", n, [&] { return manager.FindComponentPolymorphic<BenchComponent<0>>(); });
+	  Measure(csv, count, "last_table", n, [&] { return manager.GetComponent<BenchDerived>(); });
+	  Measure(csv, count, "last_scan", n, [&] { return manager.FindComponentPolymorphic<BenchDerived>(); });
+	  Measure(csv, count, "base_table", n, [&] { return manager.GetComponent<BenchBase>(); });
+	  Measure(csv, count, "base_scan", n, [&] { return manager.FindComponentPolymorphic<BenchBase>(); });
+	  Measure(csv, count, "missing_table", n, [&] { return manager.GetComponent<BenchMissing>(); });
+	  Measure(csv, count, "missing_scan", n, [&] { return manager.FindComponentPolymorphic<BenchMissing>(); });
+
+	  // 추가/제거 후 첫 조회는 표를 다시 채운다 — 그 비용까지 포함한 값
+	  Measure(csv, count, "after_change_table", std::max(1LL, n / 100),
+			  [&]
+			  {
+				manager.AddComponent(new BenchMissing());
+				manager.RemoveComponent<BenchMissing>();
+				return manager.GetComponent<BenchBase>();
+			  });
+	}
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+  Run(options, csv);
+  return 0;
+}
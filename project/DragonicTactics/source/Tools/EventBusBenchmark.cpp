@@ -0,0 +1,160 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <typeindex>
+
+// EventBus 발행 비용 마이크로 벤치마크
+//   dragonic_eventbus_bench [--subscribers 1,2,5,10,25,50,100] [--iterations N] [--out file.csv]
+// 구독자 수별로 EventBus::Publish 와 이전 구현(type_index map + std::function 두 겹)의 발행 한 번 비용,
+// 구독 + 해지 한 번의 비용을 재고 CSV (subscribers,metric,iterations,total_ms,per_op_ns) 로 출력한다.
+namespace
+{
+  struct Options
+  {
+	std::vector<int> subscribers = { 1, 2, 5, 10, 25, 50, 100 };
+	long long		 iterations	 = 2'000'000;
+	std::string		 out_path;
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg		  = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--subscribers" && has_value)
+	  {
+		options.subscribers.clear();
+		std::stringstream list(argv[++i]);
+		std::string		  item;
+		while (std::getline(list, item, ','))
+		  options.subscribers.push_back(std::clamp(std::stoi(item), 1, 10000));
+	  }
+	  else if (arg == "--iterations" && has_value)
+		options.iterations = std::max(1LL, std::stoll(argv[++i]));
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else
+	  {
+		std::cerr << "usage: dragonic_eventbus_bench [--subscribers 1,2,5,10,25,50,100] [--iterations N] [--out file.csv]\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+
+  struct BenchEvent
+  {
+	int value;
+  };
+
+  struct OtherEvent
+  {
+	int value;
+  };
+
+  // 이전 EventBus 와 같은 구조 (비교 기준)
+  class LegacyBus
+  {
+	public:
+	template <typename T>
+	void Subscribe(std::function<void(const T&)> callback)
+	{
+	  subscribers[std::type_index(typeid(T))].push_back([callback](const void* data) { callback(*static_cast<const T*>(data)); });
+	}
+
+	template <typename T>
+	void Publish(const T& event)
+	{
+	  auto typeIndex = std::type_index(typeid(T));
+	  if (subscribers.find(typeIndex) != subscribers.end())
+	  {
+		for (auto& callback : subscribers[typeIndex])
+		  callback(&event);
+	  }
+	}
+
+	private:
+	std::map<std::type_index, std::vector<std::function<void(const void*)>>> subscribers;
+  };
+
+  volatile long long g_sink = 0;
+
+  template <typename Body>
+  void Measure(std::ostream& csv, int subscribers, const char* metric, long long iterations, Body&& body)
+  {
+	const auto start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < iterations; ++i)
+	  body(static_cast<int>(i));
+	const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	csv << subscribers << ',' << metric << ',' << iterations << ',' << ms << ',' << ms * 1e6 / static_cast<double>(iterations) << '\n';
+  }
+
+  void Run(const Options& options, std::ostream& csv)
+  {
+	csv << "subscribers,metric,iterations,total_ms,per_op_ns\n";
+	for (const int count : options.subscribers)
+	{
+	  // 구독자 수가 늘어도 총 호출 수가 비슷하도록 반복 횟수를 나눈다
+	  const long long n		= std::max(1000LL, options.iterations / count);
+	  long long		  total = 0;
+
+	  LegacyBus legacy;
+	  for (int s = 0; s < count; ++s)
+		legacy.Subscribe<BenchEvent>([&total](const BenchEvent& e) { total += e.value; });
+	  legacy.Subscribe<OtherEvent>([&total](const OtherEvent& e) { total -= e.value; });
+	  Measure(csv, count, "publish_legacy", n, [&](int i) { legacy.Publish(BenchEvent{ i }); });
+
+	  EventBus							  bus;
+	  std::vector<EventBus::Subscription> subscriptions;
+	  for (int s = 0; s < count; ++s)
+		subscriptions.push_back(bus.Subscribe<BenchEvent>([&total](const BenchEvent& e) { total += e.value; }));
+	  subscriptions.push_back(bus.Subscribe<OtherEvent>([&total](const OtherEvent& e) { total -= e.value; }));
+	  Measure(csv, count, "publish_bus", n, [&](int i) { bus.Publish(BenchEvent{ i }); });
+
+	  // 구독자가 count 개 있는 채널에 하나를 더 걸었다 푼다 (맨 뒤 해지 — 선형 탐색 최악)
+	  Measure(csv, count, "subscribe_reset_bus", std::max(1000LL, n / 10),
+			  [&](int)
+			  {
+				EventBus::Subscription temporary = bus.Subscribe<BenchEvent>([&total](const BenchEvent& e) { total ^= e.value; });
+				temporary.Reset();
+			  });
+
+	  g_sink = total; // 최적화로 호출이 사라지지 않도록
+	}
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+  Run(options, csv);
+  return 0;
+}
@@ -0,0 +1,272 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Logger.h"
+#include "Engine/Timer.h"
+#include "Game/DragonicTactics/Simulation/BattleJournal.h"
+#include "Game/DragonicTactics/Simulation/BattleSimulator.h"
+
+#include <fstream>
+#include <iostream>
+
+// 헤드리스 전투 시뮬레이터 — 드래곤까지 AI 로 전투를 끝까지 돌린다 (창/사운드/프레임 간격 없음)
+//   dragonic_simulator [--battles N] [--seed N] [--map id | --size N --map-seed N] [--max-rounds N] [--record file.dtj] [--log-binary prefix] [--verbose] [--out file.csv]
+//   dragonic_simulator --replay file.dtj [--verbose]
+//   dragonic_simulator --dump file.dtj
+// 전투마다 한 줄씩 CSV 를 쓰고, 끝에 승률/평균 턴/피해 출처 요약을 stderr 로 출력한다.
+// --record 는 전투 저널을 남기고 (여러 판이면 file_0.dtj, file_1.dtj ...),
+// --replay 는 저널을 렌더링 없이 최대 속도로 다시 돌려 턴마다 체크섬을 대조한다 (어긋나면 종료 코드 1).
+// --log-binary 는 Debug 까지의 로그를 바이너리 세그먼트(prefix.0000.dtl ...) 로 남긴다 (dragonic_logdecode 로 읽는다).
+namespace
+{
+  struct Options
+  {
+	int			   battles	  = 100;
+	int			   seed		  = 100;
+	bool		   verbose	  = false;
+	std::string	   out_path;
+	std::string	   record_path;
+	std::string	   log_binary_prefix;
+	std::string	   replay_path;
+	std::string	   dump_path;
+	BattleSettings battle;
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	options.battle.map_id = "first_map";
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg		  = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--battles" && has_value)
+		options.battles = std::max(1, std::stoi(argv[++i]));
+	  else if (arg == "--seed" && has_value)
+		options.seed = std::stoi(argv[++i]);
+	  else if (arg == "--map" && has_value)
+		options.battle.map_id = argv[++i];
+	  else if (arg == "--size" && has_value)
+	  {
+		options.battle.map_id			 = "";
+		options.battle.procedural.width	 = std::stoi(argv[++i]);
+		options.battle.procedural.height = options.battle.procedural.width;
+	  }
+	  else if (arg == "--map-seed" && has_value)
+		options.battle.procedural.seed = std::stoull(argv[++i]);
+	  else if (arg == "--max-rounds" && has_value)
+		options.battle.max_rounds = std::max(1, std::stoi(argv[++i]));
+	  else if (arg == "--verbose")
+		options.verbose = true;
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else if (arg == "--record" && has_value)
+		options.record_path = argv[++i];
+	  else if (arg == "--log-binary" && has_value)
+		options.log_binary_prefix = argv[++i];
+	  else if (arg == "--replay" && has_value)
+		options.replay_path = argv[++i];
+	  else if (arg == "--dump" && has_value)
+		options.dump_path = argv[++i];
+	  else
+	  {
+		std::cerr << "usage: dragonic_simulator [--battles N] [--seed N] [--map id | --size N --map-seed N] [--max-rounds N] [--record file.dtj] [--log-binary prefix] [--verbose] [--out file.csv]\n"
+				  << "       dragonic_simulator --replay file.dtj [--verbose]\n"
+				  << "       dragonic_simulator --dump file.dtj\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+
+  /// 여러 판을 기록할 때 battle_0.dtj, battle_1.dtj ... 로 나눈다
+  std::string RecordPathFor(const std::string& path, int battle, int battles)
+  {
+	if (path.empty() || battles == 1)
+	  return path;
+	const std::size_t dot  = path.find_last_of('.');
+	const std::string stem = dot == std::string::npos ? path : path.substr(0, dot);
+	const std::string ext  = dot == std::string::npos ? "" : path.substr(dot);
+	return stem + "_" + std::to_string(battle) + ext;
+  }
+
+  std::string TileText(Math::ivec2 tile)
+  {
+	return "(" + std::to_string(tile.x) + "," + std::to_string(tile.y) + ")";
+  }
+
+  std::string CommandText(const BattleCommand& command)
+  {
+	std::string tiles;
+	for (Math::ivec2 tile : command.tiles)
+	  tiles += TileText(tile);
+	switch (command.kind)
+	{
+	  case BattleCommand::Kind::Move: return "Move " + tiles;
+	  case BattleCommand::Kind::Attack: return "Attack " + TileText(command.tile);
+	  case BattleCommand::Kind::CastSpell: return "CastSpell " + command.spell + " L" + std::to_string(command.level) + " " + TileText(command.tile);
+	  case BattleCommand::Kind::CastWalls: return "CastWalls " + command.spell + " L" + std::to_string(command.level) + " " + tiles;
+	  case BattleCommand::Kind::CastLavaZones: return "CastLavaZones " + command.spell + " L" + std::to_string(command.level) + " " + tiles;
+	  case BattleCommand::Kind::AIDecision:
+		return "AI type=" + std::to_string(static_cast<int>(command.decision_type)) + " target=" + TileText(command.tile) + " dest=" + TileText(command.destination) +
+			   (command.spell.empty() ? "" : " " + command.spell + " L" + std::to_string(command.level));
+	  case BattleCommand::Kind::EndTurn:
+	  default: return "EndTurn";
+	}
+  }
+
+  /// 레코드를 파일 순서대로 한 줄씩 출력
+  void DumpJournal(const JournalData& journal, std::ostream& out)
+  {
+	const JournalHeader& header = journal.header;
+	out << "map " << header.map.id << " " << header.map.width << "x" << header.map.height << ", dice " << (header.counter_dice ? "counter " : "seed ") << header.dice_seed;
+	if (header.counter_dice)
+	  out << " stream " << header.dice_stream;
+	out << ", " << journal.commands.size() << " commands, " << journal.events.size() << " events, " << journal.checksums.size() << " checksums"
+		<< (journal.finished ? "" : " (unfinished)") << (journal.truncated ? " (truncated)" : "") << '\n';
+
+	std::size_t c = 0, e = 0, k = 0;
+	const auto	next = [](const auto& records, std::size_t i) { return i < records.size() ? records[i].sequence : std::numeric_limits<int>::max(); };
+	while (c < journal.commands.size() || e < journal.events.size() || k < journal.checksums.size())
+	{
+	  const int sequence = std::min({ next(journal.commands, c), next(journal.events, e), next(journal.checksums, k) });
+	  if (sequence == next(journal.commands, c))
+	  {
+		const JournalCommandRecord& record = journal.commands[c++];
+		out << sequence << "  cmd   unit " << record.actor << "  " << CommandText(record.command) << '\n';
+	  }
+	  else if (sequence == next(journal.events, e))
+	  {
+		const JournalEventRecord& record = journal.events[e++];
+		out << sequence << "  event " << JournalEventName(record.kind);
+		for (const int value : record.values)
+		  out << ' ' << value;
+		if (!record.text.empty())
+		  out << ' ' << record.text;
+		out << '\n';
+	  }
+	  else
+	  {
+		const JournalChecksumRecord& record = journal.checksums[k++];
+		out << sequence << "  turn  " << record.turn << " round " << record.round << " unit " << record.actor << " checksum " << std::hex << record.checksum << std::dec << '\n';
+	  }
+	}
+  }
+
+  int DumpOrReplay(const Options& options)
+  {
+	const std::string& path = options.dump_path.empty() ? options.replay_path : options.dump_path;
+	JournalData		   journal;
+	std::string		   error;
+	if (!BattleJournal::Load(path, journal, error))
+	{
+	  std::cerr << path << ": " << error << '\n';
+	  return 1;
+	}
+	if (!options.dump_path.empty())
+	{
+	  DumpJournal(journal, std::cout);
+	  return 0;
+	}
+
+	Engine& engine = Engine::Instance();
+	engine.StartHeadless();
+	if (!options.verbose)
+	  Engine::GetLogger().SetMinLevel(CS230::Logger::Severity::Error);
+
+	BattleSettings settings = options.battle;
+	settings.replay			= &journal;
+	const BattleResult result = BattleSimulator::Run(settings);
+	engine.Stop();
+
+	std::cerr << path << ": " << journal.commands.size() << " commands replayed in " << result.seconds * 1000.0 << " ms, winner " << BattleSimulator::WinnerName(result.winner)
+			  << ", rounds " << result.rounds << '\n';
+	std::cerr << "  checksums " << result.checksums_verified << "/" << journal.checksums.size() << " verified, " << result.checksum_mismatches << " mismatched";
+	if (result.first_mismatch_turn >= 0)
+	  std::cerr << " (first at turn " << result.first_mismatch_turn << ")";
+	std::cerr << (result.replay_diverged ? ", command stream diverged" : "") << '\n';
+	return result.checksum_mismatches == 0 && !result.replay_diverged ? 0 : 1;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+  if (!options.replay_path.empty() || !options.dump_path.empty())
+	return DumpOrReplay(options);
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+
+  Engine& engine = Engine::Instance();
+  engine.StartHeadless();
+  if (!options.log_binary_prefix.empty())
+  {
+	// 바이너리 로그는 장시간 대전 기록용 — 텍스트로는 너무 커지는 Debug 까지 남긴다
+	if (!Engine::GetLogger().OpenBinaryLog(options.log_binary_prefix))
+	{
+	  std::cerr << "cannot open " << options.log_binary_prefix << ".0000.dtl\n";
+	  return 1;
+	}
+	Engine::GetLogger().SetMinLevel(CS230::Logger::Severity::Debug);
+  }
+  else if (!options.verbose)
+	Engine::GetLogger().SetMinLevel(CS230::Logger::Severity::Error);
+
+  int						 wins[3]	 = {};
+  long long					 total_turns = 0;
+  std::map<std::string, int> damage_by_source;
+  util::Timer				 timer;
+
+  csv << "battle,dice_seed,winner,rounds,turns,actions,dragon_hp_left,ms\n";
+  for (int i = 0; i < options.battles; ++i)
+  {
+	BattleSettings settings = options.battle;
+	settings.dice_seed		= options.seed + i;
+	settings.record_path	= RecordPathFor(options.record_path, i, options.battles);
+
+	const BattleResult result = BattleSimulator::Run(settings);
+	++wins[static_cast<int>(result.winner)];
+	total_turns += result.turns;
+	for (const auto& [source, damage] : result.damage_by_source)
+	  damage_by_source[source] += damage;
+
+	csv << i << ',' << settings.dice_seed << ',' << BattleSimulator::WinnerName(result.winner) << ',' << result.rounds << ',' << result.turns << ',' << result.actions << ','
+		<< result.dragon_hp_left << ',' << result.seconds * 1000.0 << '\n';
+  }
+  const double seconds = timer.GetElapsedSeconds();
+
+  const double battles = static_cast<double>(options.battles);
+  std::cerr << options.battles << " battles in " << seconds << " s (" << battles / seconds << " battles/s)\n";
+  std::cerr << "  Dragon win   " << 100.0 * wins[static_cast<int>(BattleWinner::Dragon)] / battles << "%\n";
+  std::cerr << "  Invaders win " << 100.0 * wins[static_cast<int>(BattleWinner::Invaders)] / battles << "%\n";
+  std::cerr << "  Draw         " << 100.0 * wins[static_cast<int>(BattleWinner::Draw)] / battles << "%\n";
+  std::cerr << "  avg turns    " << static_cast<double>(total_turns) / battles << '\n';
+  for (const auto& [source, damage] : damage_by_source)
+	std::cerr << "  damage " << source << ": " << damage << '\n';
+  if (!options.log_binary_prefix.empty())
+  {
+	Engine::GetLogger().Flush();
+	std::cerr << "  binary log   " << Engine::GetLogger().GetBinaryBytesWritten() << " bytes\n";
+	Engine::GetLogger().CloseBinaryLog();
+  }
+
+  engine.Stop();
+  return 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Engine/BinaryLog.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+// 바이너리 로그(.dtl) 디코더 / 필터
+//   dragonic_logdecode <prefix | file.dtl>... [--csv] [--min-level Verbose|Debug|Event|Error] [--match text] [--template text] [--stats] [--out file]
+// prefix 를 주면 prefix.0000.dtl, prefix.0001.dtl ... 을 번호 순으로 읽는다.
+// 기본 출력은 Trace.log 와 같은 텍스트 줄, --csv 는 seconds,severity,template,text,인자... (인자 수는 템플릿마다 다르다),
+// --stats 는 템플릿별 메시지 수와 텍스트로 풀었을 때의 크기를 세그먼트 크기와 비교해 보여 준다.
+namespace
+{
+  using CS230::BinaryLogMessage;
+  using Severity = CS230::Logger::Severity;
+
+  struct Options
+  {
+	std::vector<std::string> inputs;
+	bool					 csv	   = false;
+	bool					 stats	   = false;
+	Severity				 min_level = Severity::Verbose;
+	std::string				 match;
+	std::string				 template_match;
+	std::string				 out_path;
+  };
+
+  const char* SeverityName(Severity severity)
+  {
+	switch (severity)
+	{
+	  case Severity::Verbose: return "Verbose";
+	  case Severity::Debug: return "Debug";
+	  case Severity::Event: return "Event";
+	  case Severity::Error:
+	  default: return "Error";
+	}
+  }
+
+  bool ParseSeverity(const std::string& name, Severity& out)
+  {
+	for (const Severity severity : { Severity::Verbose, Severity::Debug, Severity::Event, Severity::Error })
+	{
+	  if (name == SeverityName(severity))
+	  {
+		out = severity;
+		return true;
+	  }
+	}
+	return false;
+  }
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg		  = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--csv")
+		options.csv = true;
+	  else if (arg == "--stats")
+		options.stats = true;
+	  else if (arg == "--min-level" && has_value && ParseSeverity(argv[i + 1], options.min_level))
+		++i;
+	  else if (arg == "--match" && has_value)
+		options.match = argv[++i];
+	  else if (arg == "--template" && has_value)
+		options.template_match = argv[++i];
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else if (arg.rfind("--", 0) != 0)
+		options.inputs.push_back(arg);
+	  else
+	  {
+		options.inputs.clear();
+		break;
+	  }
+	}
+	if (options.inputs.empty())
+	{
+	  std::cerr << "usage: dragonic_logdecode <prefix | file.dtl>... [--csv] [--min-level Verbose|Debug|Event|Error] [--match text] [--template text] [--stats] [--out file]\n";
+	  return false;
+	}
+	return true;
+  }
+
+  void WriteCsvField(std::ostream& out, const std::string& field)
+  {
+	if (field.find_first_of(",\"\n") == std::string::npos)
+	{
+	  out << field;
+	  return;
+	}
+	out << '"';
+	for (const char c : field)
+	  out << (c == '"' ? "\"\"" : std::string(1, c));
+	out << '"';
+  }
+
+  struct TemplateStats
+  {
+	long long	  messages	 = 0;
+	std::uint64_t text_bytes = 0;
+  };
+
+  void WriteMessage(const Options& options, const BinaryLogMessage& message, const std::string& text, std::ostream& out)
+  {
+	char seconds[32];
+	std::snprintf(seconds, sizeof(seconds), "%.4f", static_cast<double>(message.nanoseconds) * 1e-9);
+	if (!options.csv)
+	{
+	  out << '[' << seconds << "]\t" << SeverityName(message.severity) << '\t' << text << '\n';
+	  return;
+	}
+	out << seconds << ',' << SeverityName(message.severity) << ',';
+	WriteCsvField(out, message.format);
+	out << ',';
+	WriteCsvField(out, text);
+	for (const std::string& argument : message.arguments)
+	{
+	  out << ',';
+	  WriteCsvField(out, argument);
+	}
+	out << '\n';
+  }
+
+  int Run(const Options& options, std::ostream& out)
+  {
+	std::vector<std::string> segments;
+	for (const std::string& input : options.inputs)
+	{
+	  if (std::filesystem::is_regular_file(input))
+		segments.push_back(input);
+	  else
+	  {
+		const std::vector<std::string> found = CS230::BinaryLogReader::ListSegments(input);
+		if (found.empty())
+		  std::cerr << input << ": no segments found\n";
+		segments.insert(segments.end(), found.begin(), found.end());
+	  }
+	}
+	if (segments.empty())
+	  return 1;
+
+	if (options.csv && !options.stats)
+	  out << "seconds,severity,template,text,arguments...\n";
+
+	std::map<std::string, TemplateStats> stats;
+	std::uint64_t						 binary_bytes = 0;
+	long long							 shown		  = 0;
+	for (const std::string& path : segments)
+	{
+	  std::vector<BinaryLogMessage> messages;
+	  std::string					error;
+	  if (!CS230::BinaryLogReader::ReadSegment(path, messages, error))
+	  {
+		std::cerr << path << ": " << error << '\n';
+		return 1;
+	  }
+	  std::error_code ignored;
+	  binary_bytes += std::filesystem::file_size(path, ignored);
+
+	  for (const BinaryLogMessage& message : messages)
+	  {
+		if (message.severity < options.min_level)
+		  continue;
+		if (!options.template_match.empty() && message.format.find(options.template_match) == std::string::npos)
+		  continue;
+		const std::string text = message.Text();
+		if (!options.match.empty() && text.find(options.match) == std::string::npos)
+		  continue;
+
+		++shown;
+		if (options.stats)
+		{
+		  TemplateStats& entry = stats[message.dropped != 0 ? std::string("(dropped)") : message.format];
+		  ++entry.messages;
+		  char			 seconds[32];
+		  const int		 stamp = std::snprintf(seconds, sizeof(seconds), "%.4f", static_cast<double>(message.nanoseconds) * 1e-9);
+		  entry.text_bytes += static_cast<std::uint64_t>(stamp) + std::strlen(SeverityName(message.severity)) + text.size() + 5; // "[" "]\t" "\t" "\n"
+		}
+		else
+		  WriteMessage(options, message, text, out);
+	  }
+	}
+
+	if (options.stats)
+	{
+	  std::vector<std::pair<std::string, TemplateStats>> sorted(stats.begin(), stats.end());
+	  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.messages > b.second.messages; });
+	  std::uint64_t text_bytes = 0;
+	  out << "messages,text_bytes,template\n";
+	  for (const auto& [format, entry] : sorted)
+	  {
+		text_bytes += entry.text_bytes;
+		out << entry.messages << ',' << entry.text_bytes << ',';
+		WriteCsvField(out, format);
+		out << '\n';
+	  }
+	  std::cerr << shown << " messages, " << sorted.size() << " templates in " << segments.size() << " segment(s): " << binary_bytes << " bytes binary vs ~" << text_bytes
+				<< " bytes as text\n";
+	}
+	return 0;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& out = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+  return Run(options, out);
+}
@@ -0,0 +1,224 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Engine/Logger.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <thread>
+
+// Logger 호출 한 번의 비용 마이크로 벤치마크
+//   dragonic_logger_bench [--iterations N] [--burst N] [--threads N] [--out file.csv]
+// 이전 구현(호출마다 map + 문자열 조립 + ofstream 쓰기)과 비동기 Logger 를 꺼진 레벨 / 켜진 레벨로 나눠 재고
+// CSV (metric,iterations,total_ms,per_op_ns) 로 출력한다.
+// 켜진 레벨은 링 버퍼에 들어가는 크기(burst)씩 찍고, 로거 스레드가 파일에 쓰는 시간(flush_*)은 따로 보고한다.
+// 로그는 현재 디렉터리의 Trace.log / LoggerBench_legacy.log 에 쓰인다.
+namespace
+{
+  struct Options
+  {
+	long long iterations = 1'000'000;
+	long long burst		 = 1000;
+	int		  threads	 = 4;
+	std::string out_path;
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg		  = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--iterations" && has_value)
+		options.iterations = std::max(1LL, std::stoll(argv[++i]));
+	  else if (arg == "--burst" && has_value)
+		options.burst = std::clamp(std::stoll(argv[++i]), 1LL, 100'000LL);
+	  else if (arg == "--threads" && has_value)
+		options.threads = std::clamp(std::stoi(argv[++i]), 1, 64);
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else
+	  {
+		std::cerr << "usage: dragonic_logger_bench [--iterations N] [--burst N] [--threads N] [--out file.csv]\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+
+  using Severity = CS230::Logger::Severity;
+
+  // 이전 Logger 와 같은 구조 (비교 기준) — 레벨 검사 전에 레벨 이름 map 과 메시지를 만든다
+  class LegacyLogger
+  {
+	public:
+	LegacyLogger(Severity severity, std::chrono::system_clock::time_point start) : min_level(severity), out_stream("LoggerBench_legacy.log"), start_time(start)
+	{
+	}
+
+	void LogDebug(std::string text)
+	{
+	  log(Severity::Debug, text);
+	}
+
+	void LogEvent(std::string text)
+	{
+	  log(Severity::Event, text);
+	}
+
+	void Flush()
+	{
+	  out_stream.flush();
+	}
+
+	private:
+	void log(Severity severity, std::string message)
+	{
+	  std::map<Severity, std::string> get_error_level = {
+		{ Severity::Verbose, "Verbose" },
+		{	  Severity::Debug,   "Debug" },
+		{	  Severity::Event,   "Event" },
+		{	  Severity::Error,   "Error" }
+	  };
+	  std::string answer = get_error_level[severity] + "\t" + message;
+	  if (static_cast<int>(min_level) <= static_cast<int>(severity))
+	  {
+		out_stream.precision(4);
+		out_stream << '[' << std::fixed << std::chrono::duration<double>(std::chrono::system_clock::now() - start_time).count() << "]\t";
+		out_stream << answer << "\n";
+	  }
+	}
+
+	Severity							  min_level;
+	std::ofstream						  out_stream;
+	std::chrono::system_clock::time_point start_time;
+  };
+
+  // 호출부가 실제로 넘기는 것과 비슷한 인자 (캐릭터 이름 + 정수 몇 개)
+  const std::string g_name = "Dragon";
+
+  void WriteRow(std::ostream& csv, const char* metric, long long iterations, double ms)
+  {
+	csv << metric << ',' << iterations << ',' << ms << ',' << ms * 1e6 / static_cast<double>(iterations) << '\n';
+  }
+
+  template <typename Body>
+  void Measure(std::ostream& csv, const char* metric, long long iterations, Body&& body)
+  {
+	const auto start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < iterations; ++i)
+	  body(static_cast<int>(i));
+	WriteRow(csv, metric, iterations, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+  }
+
+  // burst 개씩 찍고 flush 는 잰 시간에서 뺀다 — 호출한 스레드가 실제로 기다리는 시간만 per_op 에 남긴다
+  template <typename Body, typename FlushFn>
+  void MeasureBursts(std::ostream& csv, const char* metric, const char* flush_metric, long long iterations, long long burst, Body&& body, FlushFn&& flush)
+  {
+	double	  call_ms  = 0.0;
+	double	  flush_ms = 0.0;
+	long long done	   = 0;
+	while (done < iterations)
+	{
+	  const long long count = std::min(burst, iterations - done);
+	  const auto	  start = std::chrono::steady_clock::now();
+	  for (long long i = 0; i < count; ++i)
+		body(static_cast<int>(done + i));
+	  const auto middle = std::chrono::steady_clock::now();
+	  flush();
+	  const auto end = std::chrono::steady_clock::now();
+	  call_ms += std::chrono::duration<double, std::milli>(middle - start).count();
+	  flush_ms += std::chrono::duration<double, std::milli>(end - middle).count();
+	  done += count;
+	}
+	WriteRow(csv, metric, iterations, call_ms);
+	WriteRow(csv, flush_metric, iterations, flush_ms);
+  }
+
+  void Run(const Options& options, std::ostream& csv)
+  {
+	const auto		start = std::chrono::system_clock::now();
+	const long long n	  = options.iterations;
+	csv << "metric,iterations,total_ms,per_op_ns\n";
+
+	// 꺼진 레벨 (min_level = Event 에서 LogDebug)
+	{
+	  LegacyLogger legacy(Severity::Event, start);
+	  Measure(csv, "disabled_legacy", n, [&](int i) { legacy.LogDebug("CombatSystem: " + g_name + " took " + std::to_string(i) + " damage"); });
+
+	  CS230::Logger logger(Severity::Event, false, start);
+	  Measure(csv, "disabled_string", n, [&](int i) { logger.LogDebug("CombatSystem: " + g_name + " took " + std::to_string(i) + " damage"); });
+	  Measure(csv, "disabled_format", n, [&](int i) { logger.LogDebug("CombatSystem: {} took {} damage", g_name, i); });
+	}
+
+	// 켜진 레벨 (LogEvent)
+	{
+	  LegacyLogger legacy(Severity::Debug, start);
+	  MeasureBursts(
+		csv, "enabled_legacy", "flush_legacy", n, options.burst,
+		[&](int i) { legacy.LogEvent("CombatSystem: " + g_name + " took " + std::to_string(i) + " damage (" + std::to_string(i + 10) + " -> 10 HP)"); },
+		[&]() { legacy.Flush(); });
+
+	  CS230::Logger logger(Severity::Debug, false, start);
+	  MeasureBursts(
+		csv, "enabled_string", "flush_string", n, options.burst,
+		[&](int i) { logger.LogEvent("CombatSystem: " + g_name + " took " + std::to_string(i) + " damage (" + std::to_string(i + 10) + " -> 10 HP)"); },
+		[&]() { logger.Flush(); });
+	  MeasureBursts(
+		csv, "enabled_format", "flush_format", n, options.burst, [&](int i) { logger.LogEvent("CombatSystem: {} took {} damage ({} -> {} HP)", g_name, i, i + 10, 10); },
+		[&]() { logger.Flush(); });
+
+	  // 여러 스레드가 동시에 찍는다 (스레드마다 burst 개씩, 링이 넘치면 Event 는 자리가 날 때까지 기다린다)
+	  const long long per_thread = std::max(1LL, n / options.threads);
+	  double		  call_ms	 = 0.0;
+	  for (long long done = 0; done < per_thread; done += options.burst)
+	  {
+		const long long			 count = std::min(options.burst, per_thread - done);
+		std::vector<std::thread> workers;
+		const auto				 burst_start = std::chrono::steady_clock::now();
+		for (int t = 0; t < options.threads; ++t)
+		  workers.emplace_back(
+			[&logger, count, t]()
+			{
+			  for (long long i = 0; i < count; ++i)
+				logger.LogEvent("Worker {}: {} took {} damage", t, g_name, i);
+			});
+		for (std::thread& worker : workers)
+		  worker.join();
+		call_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - burst_start).count();
+		logger.Flush();
+	  }
+	  // 스레드 생성/합류 시간이 포함된 벽시계 기준 — 호출 하나의 비용은 총 호출 수로 나눈다
+	  WriteRow(csv, "enabled_format_threads", per_thread * options.threads, call_ms);
+	  std::cerr << "dropped (ring full): " << logger.GetDroppedCount() << '\n';
+	}
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+  Run(options, csv);
+  return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "Engine/Engine.h"
+#include "Engine/Logger.h"
+#include "Game/DragonicTactics/Simulation/MonteCarloRunner.h"
+
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <set>
+
+// 몬테카를로 밸런스 러너 — 헤드리스 전투를 work-stealing 풀에서 병렬로 돌린다
+//   dragonic_montecarlo [--battles N] [--threads N] [--seed N] [--map id | --size N --map-seed N] [--max-rounds N] [--out file.csv]
+//                       [--search dragon,fighter,cleric] [--search-ms N] [--search-nodes N] [--search-depth N]
+// --search 로 고른 타입은 SearchStrategy 로 돌린다. 같은 --seed 로 --search 유무를 비교하면 기존 스크립트 전략 대비 승률이 나온다.
+// --search-nodes 를 주면 시간 대신 노드 수로 예산을 끊어 스레드 수/기계와 관계없이 재현 가능하다.
+// 요약(승률/평균 턴/처리량)은 stderr 로, 피해 출처별 CSV(source,total_damage,per_battle)는 stdout 또는 --out 으로 쓴다.
+// 같은 --seed/--battles 면 --threads 값과 관계없이 결과가 같다.
+namespace
+{
+  bool ParseSearchTypes(const std::string& list, std::set<CharacterTypes>& types)
+  {
+	std::size_t begin = 0;
+	while (begin <= list.size())
+	{
+	  const std::size_t end  = std::min(list.find(',', begin), list.size());
+	  const std::string name = list.substr(begin, end - begin);
+	  if (name == "dragon")
+		types.insert(CharacterTypes::Dragon);
+	  else if (name == "fighter")
+		types.insert(CharacterTypes::Fighter);
+	  else if (name == "cleric")
+		types.insert(CharacterTypes::Cleric);
+	  else
+		return false;
+	  begin = end + 1;
+	}
+	return true;
+  }
+
+  bool ParseOptions(int argc, char* argv[], MonteCarloSettings& settings, std::string& out_path)
+  {
+	settings.battle.map_id    = "first_map";
+	settings.battle.dice_seed = 1;
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg       = argv[i];
+	  const bool        has_value = i + 1 < argc;
+	  if (arg == "--battles" && has_value)
+		settings.battles = std::max(1, std::stoi(argv[++i]));
+	  else if (arg == "--threads" && has_value)
+		settings.threads = std::max(0, std::stoi(argv[++i]));
+	  else if (arg == "--seed" && has_value)
+		settings.battle.dice_seed = std::stoi(argv[++i]);
+	  else if (arg == "--map" && has_value)
+		settings.battle.map_id = argv[++i];
+	  else if (arg == "--size" && has_value)
+	  {
+		settings.battle.map_id            = "";
+		settings.battle.procedural.width  = std::stoi(argv[++i]);
+		settings.battle.procedural.height = settings.battle.procedural.width;
+	  }
+	  else if (arg == "--map-seed" && has_value)
+		settings.battle.procedural.seed = std::stoull(argv[++i]);
+	  else if (arg == "--max-rounds" && has_value)
+		settings.battle.max_rounds = std::max(1, std::stoi(argv[++i]));
+	  else if (arg == "--out" && has_value)
+		out_path = argv[++i];
+	  else if (arg == "--search" && has_value && ParseSearchTypes(argv[i + 1], settings.battle.ai.search_types))
+		++i;
+	  else if (arg == "--search-ms" && has_value)
+		settings.battle.ai.search.time_budget_ms = std::stod(argv[++i]);
+	  else if (arg == "--search-nodes" && has_value)
+	  {
+		settings.battle.ai.search.node_budget    = std::stoll(argv[++i]);
+		settings.battle.ai.search.time_budget_ms = 0.0;
+	  }
+	  else if (arg == "--search-depth" && has_value)
+		settings.battle.ai.search.max_depth = std::max(1, std::stoi(argv[++i]));
+	  else
+	  {
+		std::cerr << "usage: dragonic_montecarlo [--battles N] [--threads N] [--seed N] [--map id | --size N --map-seed N] [--max-rounds N] [--out file.csv]\n"
+				  << "                           [--search dragon,fighter,cleric] [--search-ms N] [--search-nodes N] [--search-depth N]\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  MonteCarloSettings settings;
+  std::string        out_path;
+  if (!ParseOptions(argc, argv, settings, out_path))
+	return 1;
+
+  std::ofstream file;
+  if (!out_path.empty())
+  {
+	file.open(out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+
+  Engine& engine = Engine::Instance();
+  engine.StartHeadless();
+  Engine::GetLogger().SetMinLevel(CS230::Logger::Severity::Error);
+
+  std::atomic<int>  progress{ 0 };
+  auto              pending = std::async(std::launch::async, [&] { return MonteCarloRunner::Run(settings, &progress); });
+  while (pending.wait_for(std::chrono::milliseconds(500)) != std::future_status::ready)
+	std::cerr << "\r  " << progress.load(std::memory_order_relaxed) << " / " << settings.battles << std::flush;
+  const MonteCarloSummary summary = pending.get();
+  std::cerr << '\r';
+
+  const double battles = static_cast<double>(summary.battles);
+  std::cerr << summary.battles << " battles on " << summary.threads << " threads in " << summary.seconds << " s (" << battles / summary.seconds << " battles/s, "
+			<< summary.stolen_tasks << " stolen)\n";
+  std::cerr << "  Dragon win   " << 100.0 * summary.DragonWinRate() << "%\n";
+  std::cerr << "  Invaders win " << 100.0 * summary.invader_wins / battles << "%\n";
+  std::cerr << "  Draw         " << 100.0 * summary.draws / battles << "%\n";
+  std::cerr << "  turns        avg " << summary.AverageTurns() << ", min " << summary.min_turns << ", max " << summary.max_turns << '\n';
+  if (summary.search_nodes > 0)
+	std::cerr << "  search       " << summary.search_nodes << " nodes, " << summary.SearchNodesPerSecond() << " nodes/s per thread\n";
+
+  csv << "source,total_damage,per_battle\n";
+  for (const auto& [source, damage] : summary.damage_by_source)
+	csv << source << ',' << damage << ',' << static_cast<double>(damage) / battles << '\n';
+
+  engine.Stop();
+  return 0;
+}
@@ -0,0 +1,306 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \copyright DigiPen Institute of Technology
+ */
+#include "pch.h"
+
+#include "CS200/IRenderer2D.h"
+#include "Engine/Engine.h"
+#include "Engine/GameObjectManager.h"
+#include "Engine/GameState.h"
+#include "Engine/GameStateManager.h"
+#include "Engine/Logger.h"
+#include "Engine/Matrix.h"
+#include "Engine/TextureManager.h"
+#include "Engine/Timer.h"
+
+#include "Game/DragonicTactics/Factories/CharacterFactory.h"
+#include "Game/DragonicTactics/Factories/MapGenerator.h"
+#include "Game/DragonicTactics/Objects/Character.h"
+#include "Game/DragonicTactics/Objects/Components/GridPosition.h"
+#include "Game/DragonicTactics/StateComponents/AISystem.h"
+#include "Game/DragonicTactics/StateComponents/CombatSystem.h"
+#include "Game/DragonicTactics/StateComponents/DataRegistry.h"
+#include "Game/DragonicTactics/StateComponents/DiceManager.h"
+#include "Game/DragonicTactics/StateComponents/EventBus.h"
+#include "Game/DragonicTactics/StateComponents/GridSystem.h"
+#include "Game/DragonicTactics/StateComponents/SpellSystem.h"
+#include "Game/DragonicTactics/StateComponents/StatusEffectHandler.h"
+#include "Game/DragonicTactics/StateComponents/TurnManager.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// 헤드리스 스케일링 벤치마크
+//   dragonic_benchmark [--sizes 16,64,256,1024,2048] [--seed N] [--iterations N] [--hierarchical] [--out file.csv]
+// 크기마다 시드 고정 절차적 맵을 만들고 FindPath / GetReachableTiles / 스펠 범위 / AI 결정 / GridSystem::Draw(CPU)
+// 시간을 재서 CSV (size,seed,metric,iterations,total_ms,per_op_us) 로 출력한다.
+namespace
+{
+  struct Options
+  {
+	std::vector<int> sizes		  = { 16, 64, 256, 1024, 2048 };
+	std::uint64_t	 seed		  = 1;
+	int				 iterations	  = 200;
+	bool			 hierarchical = false;
+	std::string		 out_path;
+  };
+
+  bool ParseOptions(int argc, char* argv[], Options& options)
+  {
+	for (int i = 1; i < argc; ++i)
+	{
+	  const std::string arg	 = argv[i];
+	  const bool		has_value = i + 1 < argc;
+	  if (arg == "--sizes" && has_value)
+	  {
+		options.sizes.clear();
+		std::stringstream list(argv[++i]);
+		std::string		  item;
+		while (std::getline(list, item, ','))
+		  options.sizes.push_back(std::stoi(item));
+	  }
+	  else if (arg == "--seed" && has_value)
+		options.seed = std::stoull(argv[++i]);
+	  else if (arg == "--iterations" && has_value)
+		options.iterations = std::max(1, std::stoi(argv[++i]));
+	  else if (arg == "--hierarchical")
+		options.hierarchical = true;
+	  else if (arg == "--out" && has_value)
+		options.out_path = argv[++i];
+	  else
+	  {
+		std::cerr << "usage: dragonic_benchmark [--sizes 16,64,...] [--seed N] [--iterations N] [--hierarchical] [--out file.csv]\n";
+		return false;
+	  }
+	}
+	return true;
+  }
+
+  /// @brief splitmix64 — 질의 위치 선택용 (맵 생성기와 같은 수열 규칙, 시드만 다르게)
+  class QueryRandom
+  {
+	public:
+	explicit QueryRandom(std::uint64_t seed) : state_(seed ^ 0xA5A5A5A5A5A5A5A5ull)
+	{
+	}
+
+	int Below(int bound)
+	{
+	  std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+	  z				  = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	  z				  = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	  z				  = z ^ (z >> 31);
+	  return static_cast<int>(z % static_cast<std::uint64_t>(bound));
+	}
+
+	private:
+	std::uint64_t state_;
+  };
+
+  class ScalingBenchmark : public CS230::GameState
+  {
+	public:
+	void Load() override
+	{
+	  AddGSComponent(new EventBus());
+	  AddGSComponent(new DiceManager());
+	  AddGSComponent(new AISystem());
+	  AddGSComponent(new CombatSystem());
+	  AddGSComponent(new CS230::GameObjectManager());
+	  AddGSComponent(new GridSystem());
+	  AddGSComponent(new TurnManager());
+	  AddGSComponent(new CharacterFactory());
+	  AddGSComponent(new DataRegistry());
+	  AddGSComponent(new SpellSystem());
+	  AddGSComponent(new StatusEffectHandler());
+
+	  GetGSComponent<DiceManager>()->SetSeed(100);
+	  GetGSComponent<CombatSystem>()->SetDiceManager(GetGSComponent<DiceManager>());
+	  GetGSComponent<DataRegistry>()->LoadFromFile("Assets/Data/characters.json");
+	  GetGSComponent<DataRegistry>()->LoadAllCharacterData("Assets/Data/characters.json");
+	  GetGSComponent<SpellSystem>()->LoadFromCSV("Assets/Data/spell_table.csv");
+	}
+
+	void Update([[maybe_unused]] double dt) override
+	{
+	}
+
+	void Unload() override
+	{
+	  GetGSComponent<CS230::GameObjectManager>()->Unload();
+	  ClearGSComponents();
+	}
+
+	void Draw() override
+	{
+	}
+
+	void DrawImGui() override
+	{
+	}
+
+	gsl::czstring GetName() const override
+	{
+	  return "ScalingBenchmark";
+	}
+  };
+
+  void Report(std::ostream& csv, int size, std::uint64_t seed, const char* metric, int iterations, double seconds)
+  {
+	const double total_ms = seconds * 1000.0;
+	csv << size << ',' << seed << ',' << metric << ',' << iterations << ',' << total_ms << ',' << (total_ms * 1000.0 / iterations) << '\n';
+	csv.flush();
+  }
+
+  Character* Spawn(CharacterTypes type, Math::ivec2 position)
+  {
+	GridSystem* grid = Engine::GetGameStateManager().GetGSComponent<GridSystem>();
+	auto		ptr	 = CharacterFactory::Create(type, position);
+	Character*	raw	 = ptr.get();
+	raw->SetGridSystem(grid);
+	Engine::GetGameStateManager().GetGSComponent<CS230::GameObjectManager>()->Add(std::move(ptr));
+	grid->AddCharacter(raw, position);
+	return raw;
+  }
+
+  void RunSize(int size, const Options& options, std::ostream& csv)
+  {
+	CS230::GameStateManager& gsm	= Engine::GetGameStateManager();
+	GridSystem*				 grid	= gsm.GetGSComponent<GridSystem>();
+	SpellSystem*			 spells = gsm.GetGSComponent<SpellSystem>();
+	AISystem*				 ai		= gsm.GetGSComponent<AISystem>();
+	const int				 n		= options.iterations;
+	QueryRandom				 random(options.seed + static_cast<std::uint64_t>(size));
+	util::Timer				 timer;
+
+	ProceduralMapSettings settings;
+	settings.width	   = size;
+	settings.height	   = size;
+	settings.seed		 = options.seed;
+	settings.pathfinding = options.hierarchical ? "hierarchical" : "flat";
+
+	timer.ResetTimeStamp();
+	const MapData map = MapGenerator::Generate(settings);
+	Report(csv, size, options.seed, "generate_map", 1, timer.GetElapsedSeconds());
+
+	gsm.GetGSComponent<CS230::GameObjectManager>()->Unload();
+	timer.ResetTimeStamp();
+	grid->LoadMap(map);
+	Report(csv, size, options.seed, "load_map", 1, timer.GetElapsedSeconds());
+
+	Character* dragon  = Spawn(CharacterTypes::Dragon, map.spawn_points.at("dragon"));
+	Character* fighter = Spawn(CharacterTypes::Fighter, map.spawn_points.at("fighter"));
+	Character* cleric  = Spawn(CharacterTypes::Cleric, map.spawn_points.at("cleric"));
+
+	// 질의 위치: 통과 가능한 타일만 (벽 위 질의는 즉시 실패해서 평균을 왜곡한다)
+	std::vector<Math::ivec2> floor_tiles;
+	while (static_cast<int>(floor_tiles.size()) < n * 2)
+	{
+	  const Math::ivec2 tile{ random.Below(size), random.Below(size) };
+	  if (grid->IsPassableAt(grid->TileIndex(tile)))
+		floor_tiles.push_back(tile);
+	}
+
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  grid->FindPath(floor_tiles[static_cast<std::size_t>(2 * i)], floor_tiles[static_cast<std::size_t>(2 * i + 1)]);
+	Report(csv, size, options.seed, "find_path", n, timer.GetElapsedSeconds());
+
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  grid->FindPath(floor_tiles[static_cast<std::size_t>(2 * i)], floor_tiles[static_cast<std::size_t>(2 * i + 1)], 2);
+	Report(csv, size, options.seed, "find_path_lava_penalty", n, timer.GetElapsedSeconds());
+
+	const Math::ivec2 dragon_tile = dragon->GetGridPosition()->Get();
+	const int		  speed		  = dragon->GetMovementRange();
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  grid->GetReachableTiles(floor_tiles[static_cast<std::size_t>(i)], speed);
+	Report(csv, size, options.seed, "reachable_tiles", n, timer.GetElapsedSeconds());
+
+	// 스펠 범위: 드래곤이 쓸 수 있는 스펠마다 타게팅 모드 + CanCast 한 번씩
+	const std::vector<std::string> available = spells->GetAvailableSpells(dragon);
+	int							 spell_ops = 0;
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	{
+	  for (const std::string& spell_id : available)
+	  {
+		const SpellData* data = spells->GetSpellData(spell_id);
+		if (data == nullptr)
+		  continue;
+		const int range = data->targeting.range < 0 ? size : data->targeting.range;
+		grid->EnableSpellTargetingMode(dragon_tile, data->targeting.geometry, range);
+		spells->CanCast(dragon, spell_id, floor_tiles[static_cast<std::size_t>(i)]);
+		++spell_ops;
+	  }
+	}
+	grid->DisableSpellTargetingMode();
+	Report(csv, size, options.seed, "spell_targeting", std::max(spell_ops, 1), timer.GetElapsedSeconds());
+
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  grid->EnableAttackRangeMode(dragon_tile, dragon->GetAttackRange());
+	grid->DisableAttackRangeMode();
+	Report(csv, size, options.seed, "attack_range", n, timer.GetElapsedSeconds());
+
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  ai->MakeDecision(fighter);
+	Report(csv, size, options.seed, "ai_decision_fighter", n, timer.GetElapsedSeconds());
+
+	timer.ResetTimeStamp();
+	for (int i = 0; i < n; ++i)
+	  ai->MakeDecision(cleric);
+	Report(csv, size, options.seed, "ai_decision_cleric", n, timer.GetElapsedSeconds());
+
+	// Draw 는 타일 수에 비례하므로 큰 맵에서는 반복 횟수를 줄인다
+	CS200::IRenderer2D* renderer   = Engine::GetTextureManager().GetRenderer2D();
+	const int			draw_count = std::max(1, std::min(n, 4096 * 64 / (size * size)));
+	timer.ResetTimeStamp();
+	for (int i = 0; i < draw_count; ++i)
+	{
+	  renderer->BeginScene(Math::TransformationMatrix{});
+	  grid->Draw();
+	  renderer->EndScene();
+	}
+	Report(csv, size, options.seed, "grid_draw_cpu", draw_count, timer.GetElapsedSeconds());
+  }
+
+  void Run(const Options& options, std::ostream& csv)
+  {
+	csv << "size,seed,metric,iterations,total_ms,per_op_us\n";
+	for (int size : options.sizes)
+	  RunSize(size, options, csv);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  Options options;
+  if (!ParseOptions(argc, argv, options))
+	return 1;
+
+  std::ofstream file;
+  if (!options.out_path.empty())
+  {
+	file.open(options.out_path);
+	if (!file.is_open())
+	{
+	  std::cerr << "cannot open " << options.out_path << '\n';
+	  return 1;
+	}
+  }
+  std::ostream& csv = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+
+  Engine& engine = Engine::Instance();
+  engine.StartHeadless();
+  engine.GetGameStateManager().PushState<ScalingBenchmark>();
+  Run(options, csv);
+  engine.Stop();
+  return 0;
+}
@@ -6,9 +6,14 @@
  */
 
 #include "Engine/Engine.h"
+#include "Engine/FrameStats.h"
 #include "Engine/GameStateManager.h"
+#include "Engine/Logger.h"
 #include "Engine/Window.h"
 #include "Game/Splash.h"
+#include <cstdlib>
+#include <string>
+#include <string_view>
 
 namespace
 {
@@ -68,10 +73,26 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 
 
 #if !defined(__EMSCRIPTEN__)
+  // 자동 성능 측정용: --frame-stats out.csv 는 끝날 때 프레임 시간 기록을 쓰고, --frames N 은 N 프레임 뒤 끝낸다
+  std::string	frame_stats_path;
+  std::uint64_t max_frames = 0;
+  for (int i = 1; i + 1 < argc; ++i)
+  {
+	const std::string_view arg = argv[i];
+	if (arg == "--frame-stats")
+	  frame_stats_path = argv[++i];
+	else if (arg == "--frames")
+	  max_frames = std::strtoull(argv[++i], nullptr, 10);
+  }
+
   while (engine.HasGameEnded() == false)
   {
 	engine.Update();
+	if (max_frames != 0 && Engine::GetWindowEnvironment().FrameCount >= max_frames)
+	  break;
   }
+  if (!frame_stats_path.empty() && !Engine::GetFrameStats().WriteCsv(frame_stats_path))
+	Engine::GetLogger().LogError("cannot write " + frame_stats_path);
   engine.Stop();
 #else
   // https://emscripten.org/docs/api_reference/emscripten.h.html#c.emscripten_set_main_loop
@@ -45,9 +45,6 @@
 
 //#include "Game/DragonicTactics/States/ButtonManager.h"
 
-#include <SDL.h>
-#include <imgui.h>
-
 #include <gsl/gsl>
 
 // Cross-platform function name macro